@@ -0,0 +1,232 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Online identification of simulated first order plants y[k] = a y[k-1] + b u[k-1], driven by a random binary
+ * input with a little measurement noise. Every plant is estimated by the stateless update, by the stateful
+ * wrapper for the first plant and by one batch update across all of them; the three must agree exactly. After each
+ * half of the run the estimates must be close to the true a and b and the internal model control gains close to
+ * those of the true plant. Halfway through, every plant's gain changes, and the forgetting factor must let the
+ * estimates follow.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/adaptive sources and -I src.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <adaptive/adaptive.h>
+#include <adaptive/adaptiveBatch.h>
+#include <adaptive/adaptiveStateless.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Adaptive::Adaptive;
+using ControlAlgorithms::Adaptive::AdaptiveBatch;
+using ControlAlgorithms::Adaptive::AdaptiveInput;
+using ControlAlgorithms::Adaptive::AdaptiveOutput;
+using ControlAlgorithms::Adaptive::AdaptiveSettings;
+using ControlAlgorithms::Adaptive::AdaptiveStateless;
+
+const float DELTA_T = 0.01f;
+const uint32_t STEPS = 4000;
+const uint32_t HOLD_STEPS = 10;
+const float NOISE = 0.0001f;
+// Gain of every plant after the change halfway through
+const float GAIN_CHANGE = 1.5f;
+const float PARAMETER_TOLERANCE = 0.001f;
+const float GAIN_TOLERANCE = 0.05f;
+
+// True plants: a and b
+struct Plant {
+  float a;
+  float b;
+};
+const Plant PLANTS[] = {
+  {0.95f, 0.1f},
+  {0.99f, 0.02f},
+  {0.8f, 0.5f},
+};
+const size_t LOOPS = sizeof(PLANTS) / sizeof(PLANTS[0]);
+
+AdaptiveSettings settings;
+Adaptive adaptive;
+AdaptiveOutput outputs[LOOPS];
+
+// Plant state and the batch form's arrays
+float plant_b[LOOPS];
+float measurement[LOOPS];
+float control[LOOPS];
+float delta_t[LOOPS];
+float param_a[LOOPS];
+float param_b[LOOPS];
+float covariance_aa[LOOPS];
+float covariance_ab[LOOPS];
+float covariance_bb[LOOPS];
+float previous_measurement[LOOPS];
+uint16_t samples[LOOPS];
+float proportional_gain[LOOPS];
+float integral_gain[LOOPS];
+float derivative_gain[LOOPS];
+
+uint32_t noise_state = 2463534242u;
+uint32_t failures;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+uint32_t nextBits() {
+  noise_state ^= noise_state << 13;
+  noise_state ^= noise_state >> 17;
+  noise_state ^= noise_state << 5;
+  return noise_state;
+}
+
+// Uniform in [-1, 1)
+float uniform() {
+  return (float)(nextBits() >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+void check(bool passed, const char *what, size_t loop) {
+  if(!passed) {
+    char line[96];
+    snprintf(line, sizeof(line), "FAILED: %s, plant %lu", what, (unsigned long)loop);
+    printLine(line);
+    ++failures;
+  }
+}
+
+void configure() {
+  settings.setClosedLoopTimeConstant(0.5f);
+  settings.setDerivativeFraction(0.1f);
+  adaptive.setSettings(settings);
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    plant_b[loop] = PLANTS[loop].b;
+    delta_t[loop] = DELTA_T;
+  }
+}
+
+// Compare the estimates with the true plant and the gains with those of the true plant, computed in double
+void checkEstimates(size_t loop) {
+  double a = PLANTS[loop].a;
+  double b = plant_b[loop];
+  double time_constant = -(double)DELTA_T / log(a);
+  double kp = time_constant / (b / (1.0 - a) * (double)settings.getClosedLoopTimeConstant());
+  double ki = kp / time_constant;
+  double kd = kp * (double)settings.getDerivativeFraction() * time_constant;
+
+  const AdaptiveOutput &out = outputs[loop];
+  check(out.getValid(), "gains valid", loop);
+  check(fabs(out.getState().getA() - a) <= PARAMETER_TOLERANCE, "a converged", loop);
+  check(fabs(out.getState().getB() - b) <= PARAMETER_TOLERANCE, "b converged", loop);
+  check(fabs(out.getProportionalGain() - kp) <= GAIN_TOLERANCE * kp, "proportional gain", loop);
+  check(fabs(out.getIntegralGain() - ki) <= GAIN_TOLERANCE * ki, "integral gain", loop);
+  check(fabs(out.getDerivativeGain() - kd) <= GAIN_TOLERANCE * kd, "derivative gain", loop);
+
+  char line[160];
+  snprintf(line, sizeof(line),
+           "plant %lu: a %.4f (%.4f), b %.4f (%.4f), Kp %.4g (%.4g), Ki %.4g (%.4g), Kd %.4g (%.4g)", (unsigned long)loop,
+           out.getState().getA(), a, out.getState().getB(), b, out.getProportionalGain(), kp, out.getIntegralGain(), ki,
+           out.getDerivativeGain(), kd);
+  printLine(line);
+}
+
+// One sample: hold a random binary input for a few steps, advance the plants and update every estimator
+void tick(uint32_t step) {
+  if(step % HOLD_STEPS == 0) {
+    for(size_t loop = 0; loop < LOOPS; ++loop) {
+      control[loop] = (nextBits() & 1) ? 1.0f : -1.0f;
+    }
+  }
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    float plant_output = PLANTS[loop].a * measurement[loop] + plant_b[loop] * control[loop];
+    measurement[loop] = plant_output + NOISE * uniform();
+  }
+
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    AdaptiveInput input;
+    input.setMeasurement(measurement[loop]);
+    input.setControl(control[loop]);
+    input.setDeltaT(DELTA_T);
+    input.setState(outputs[loop].getState());
+    AdaptiveStateless::update(input, settings, outputs[loop]);
+  }
+  adaptive.update(measurement[0], control[0], DELTA_T);
+  AdaptiveBatch::update(measurement, control, delta_t, settings, param_a, param_b, covariance_aa, covariance_ab,
+                        covariance_bb, previous_measurement, samples, proportional_gain, integral_gain,
+                        derivative_gain, LOOPS);
+
+  // Same kernels, so the same bits
+  check(adaptive.getA() == outputs[0].getState().getA() && adaptive.getB() == outputs[0].getState().getB(),
+        "stateful matches stateless", 0);
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    const AdaptiveOutput &out = outputs[loop];
+    check(param_a[loop] == out.getState().getA() && param_b[loop] == out.getState().getB(),
+          "batch model matches stateless", loop);
+    check(!out.getValid() || (proportional_gain[loop] == out.getProportionalGain() &&
+                              integral_gain[loop] == out.getIntegralGain() &&
+                              derivative_gain[loop] == out.getDerivativeGain()),
+          "batch gains match stateless", loop);
+  }
+}
+
+void runAll() {
+  for(uint32_t step = 0; step < STEPS; ++step) {
+    tick(step);
+    if(step == STEPS / 2 - 1 || step == STEPS - 1) {
+      char line[64];
+      snprintf(line, sizeof(line), "after %lu samples (true values in brackets)", (unsigned long)(step + 1));
+      printLine(line);
+      for(size_t loop = 0; loop < LOOPS; ++loop) {
+        checkEstimates(loop);
+        plant_b[loop] *= GAIN_CHANGE;
+      }
+    }
+  }
+  printLine(failures == 0 ? "passed" : "FAILED");
+}
+
+#if defined(ARDUINO)
+void setup() {
+  Serial.begin(115200);
+  configure();
+  runAll();
+}
+
+void loop() {
+}
+#else
+int main() {
+  configure();
+  runAll();
+  return failures == 0 ? 0 : 1;
+}
+#endif
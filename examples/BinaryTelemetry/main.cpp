@@ -0,0 +1,347 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Device to host telemetry over the binary link protocol compared with one line of text per value. A device runs
+ * a bank of proportional loops and streams each sample's errors and control signals; the host decodes them and
+ * sends gain changes back as settings frames, which the device applies between samples.
+ *
+ * On a host the device runs in a thread at the other end of a pseudo terminal (or a socket pair if no terminal
+ * can be opened). Both protocols are timed end to end, and the host checks every binary value against the error
+ * it expects and the gains it has sent. As an Arduino sketch it is the device side, talking over Serial.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/link and src/pid sources, -I src
+ * and -pthread.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <link/frameWriter.h>
+#include <link/frameReceiver.h>
+#include <pid/proportionalBank.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <link/hostLink.h>
+#include <ingest/monotonicClock.h>
+#include <thread>
+#endif
+
+using ControlAlgorithms::Link::FRAME_SETTINGS;
+using ControlAlgorithms::Link::FRAME_TELEMETRY;
+using ControlAlgorithms::Link::SETTING_PROPORTIONAL_GAIN;
+using ControlAlgorithms::Link::FrameReceiver;
+using ControlAlgorithms::Link::FrameView;
+using ControlAlgorithms::Link::FrameWriter;
+using ControlAlgorithms::Link::SettingRecord;
+
+const uint16_t LOOPS = 32;
+// Samples batched into one write
+const uint32_t BATCH = 8;
+const size_t TX_SIZE = 4096;
+const size_t RX_SIZE = 2048;
+#if !defined(ARDUINO)
+const uint32_t SAMPLES = 20000;
+// The host changes the gains after this many samples
+const uint32_t GAIN_PERIOD = 2500;
+#endif
+
+// Error of a loop at a sample, known to both sides and never zero so the gain can be recovered
+float errorAt(uint32_t sample, uint32_t loop) {
+  return 1.5f + sinf(0.01f * (float)sample + 0.1f * (float)loop);
+}
+
+// Gain the host sets for a loop at the n-th change
+float gainAt(uint32_t change, uint32_t loop) {
+  return 1.0f + 0.25f * (float)change + 0.01f * (float)loop;
+}
+
+// Device state
+ControlAlgorithms::PID::ProportionalBank<LOOPS> bank;
+float error[LOOPS];
+float delta_t[LOOPS];
+uint8_t device_tx[TX_SIZE];
+FrameReceiver<RX_SIZE> device_rx;
+
+// Apply settings frames the device has received
+void applySettings() {
+  FrameView view;
+  while(device_rx.next(view)) {
+    if(view.getType() != FRAME_SETTINGS) {
+      continue;
+    }
+    for(uint32_t index = 0; index < view.getSettingCount(); ++index) {
+      SettingRecord record;
+      view.getSetting(index, record);
+      if(record.parameter == SETTING_PROPORTIONAL_GAIN && record.loop < LOOPS) {
+        bank.getGainArray()[record.loop] = record.value;
+      }
+    }
+  }
+}
+
+// One sample of every loop, appended to the batch
+void deviceSample(uint32_t sample, FrameWriter &writer) {
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    error[loop] = errorAt(sample, loop);
+    delta_t[loop] = 0.001f;
+  }
+  bank.update(error, delta_t, LOOPS);
+  writer.appendTelemetry(sample, 0, error, bank.getControlArray(), LOOPS);
+}
+
+#if defined(ARDUINO)
+FrameWriter writer(device_tx, TX_SIZE);
+uint32_t sample = 0;
+
+void setup() {
+  Serial.begin(115200);
+  while(!Serial) {}
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    bank.getGainArray()[loop] = 1.0f;
+  }
+}
+
+void loop() {
+  size_t available = (size_t)Serial.available();
+  if(available > 0) {
+    uint8_t *destination = device_rx.writePointer();
+    size_t space = device_rx.writeSpace();
+    device_rx.commit(Serial.readBytes(destination, available < space ? available : space));
+    applySettings();
+  }
+  deviceSample(sample++, writer);
+  if(sample % BATCH == 0) {
+    Serial.write(writer.getBuffer(), writer.size());
+    writer.clear();
+  }
+}
+#else
+using ControlAlgorithms::Ingest::MonotonicClock;
+using ControlAlgorithms::Link::HostLink;
+
+uint8_t host_tx[TX_SIZE];
+FrameReceiver<65536> host_rx;
+char text_rx[65536];
+
+void printLine(const char *line) {
+  puts(line);
+}
+
+// Device side of the binary run
+void binaryDevice(HostLink *link) {
+  FrameWriter writer(device_tx, TX_SIZE);
+  for(uint32_t sample = 0; sample < SAMPLES; ++sample) {
+    size_t received = link->read(device_rx.writePointer(), device_rx.writeSpace(), 0);
+    if(received > 0) {
+      device_rx.commit(received);
+      applySettings();
+    }
+    deviceSample(sample, writer);
+    if((sample + 1) % BATCH == 0 || sample + 1 == SAMPLES) {
+      link->write(writer.getBuffer(), writer.size());
+      writer.clear();
+    }
+  }
+}
+
+// Device side of the text run: one line and one write per value, as with Serial.println
+void textDevice(HostLink *link) {
+  char line[48];
+  for(uint32_t sample = 0; sample < SAMPLES; ++sample) {
+    for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+      error[loop] = errorAt(sample, loop);
+      delta_t[loop] = 0.001f;
+    }
+    bank.update(error, delta_t, LOOPS);
+    for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+      int length = snprintf(line, sizeof(line), "%lu %lu %.6f %.6f\n", (unsigned long)sample, (unsigned long)loop,
+                            error[loop], bank.getControl(loop));
+      link->write(line, (size_t)length);
+    }
+  }
+}
+
+bool openLink(HostLink &host, HostLink &device, const char *&kind) {
+  kind = "pty";
+  if(host.openPty(device)) {
+    return true;
+  }
+  kind = "socketpair";
+  return host.openSocketPair(device);
+}
+
+// Host side of the binary run; returns the number of mismatched values
+uint32_t binaryHost(HostLink &link, uint64_t &bytes) {
+  float gain[LOOPS];
+  float pending[LOOPS];
+  bool has_pending = false;
+  uint32_t changes = 0;
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    gain[loop] = 1.0f;
+  }
+  uint32_t mismatches = 0;
+  uint32_t samples = 0;
+  bytes = 0;
+  while(samples < SAMPLES) {
+    size_t received = link.read(host_rx.writePointer(), host_rx.writeSpace(), 1000);
+    if(received == 0) {
+      break;
+    }
+    host_rx.commit(received);
+    bytes += received;
+    FrameView view;
+    while(host_rx.next(view)) {
+      if(view.getType() != FRAME_TELEMETRY || view.getCount() != LOOPS) {
+        ++mismatches;
+        continue;
+      }
+      // All loops of a frame use either the confirmed gains or, once the device applied them, the pending ones
+      bool current = true;
+      bool next = has_pending;
+      for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+        float value = view.getValue(0, loop);
+        float control = view.getValue(1, loop);
+        mismatches += value == errorAt(view.getTimestamp(), loop) ? 0 : 1;
+        current = current && control == value * gain[loop];
+        next = next && control == value * pending[loop];
+      }
+      if(next && !current) {
+        for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+          gain[loop] = pending[loop];
+        }
+        has_pending = false;
+      }
+      mismatches += current || next ? 0 : 1;
+      ++samples;
+
+      if(!has_pending && samples % GAIN_PERIOD == 0) {
+        SettingRecord records[LOOPS];
+        ++changes;
+        for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+          pending[loop] = gainAt(changes, loop);
+          records[loop].loop = (uint16_t)loop;
+          records[loop].parameter = SETTING_PROPORTIONAL_GAIN;
+          records[loop].reserved = 0;
+          records[loop].value = pending[loop];
+        }
+        FrameWriter writer(host_tx, TX_SIZE);
+        writer.appendSettings(records, LOOPS);
+        link.write(writer.getBuffer(), writer.size());
+        has_pending = true;
+      }
+    }
+  }
+  char line[128];
+  snprintf(line, sizeof(line), "binary: %lu samples, %lu gain changes sent, %lu lost frames, %lu bytes dropped",
+           (unsigned long)samples, (unsigned long)changes, (unsigned long)host_rx.getLostFrames(),
+           (unsigned long)host_rx.getDroppedBytes());
+  printLine(line);
+  return mismatches + (SAMPLES - samples);
+}
+
+// Host side of the text run; returns the number of values parsed
+uint32_t textHost(HostLink &link, uint64_t &bytes) {
+  uint32_t values = 0;
+  size_t used = 0;
+  bytes = 0;
+  while(values < SAMPLES * LOOPS) {
+    size_t received = link.read(text_rx + used, sizeof(text_rx) - 1 - used, 1000);
+    if(received == 0) {
+      break;
+    }
+    bytes += received;
+    used += received;
+    text_rx[used] = '\0';
+    char *line = text_rx;
+    char *end;
+    while((end = strchr(line, '\n')) != nullptr) {
+      char *cursor;
+      strtoul(line, &cursor, 10);
+      strtoul(cursor, &cursor, 10);
+      strtof(cursor, &cursor);
+      strtof(cursor, &cursor);
+      ++values;
+      line = end + 1;
+    }
+    used = (size_t)(text_rx + used - line);
+    memmove(text_rx, line, used);
+  }
+  return values;
+}
+
+void runAll() {
+  char line[128];
+  const char *kind;
+  HostLink host;
+  HostLink device;
+
+  if(!openLink(host, device, kind)) {
+    printLine("no pseudo terminal or socket pair available");
+    return;
+  }
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    bank.getGainArray()[loop] = 1.0f;
+  }
+  uint64_t text_bytes;
+  uint32_t start = MonotonicClock::nowMicros();
+  std::thread text_device(textDevice, &device);
+  uint32_t values = textHost(host, text_bytes);
+  text_device.join();
+  uint32_t text_time = MonotonicClock::nowMicros() - start;
+  host.close();
+
+  if(!openLink(host, device, kind)) {
+    printLine("could not reopen the link");
+    return;
+  }
+  uint64_t binary_bytes;
+  start = MonotonicClock::nowMicros();
+  std::thread binary_device(binaryDevice, &device);
+  uint32_t mismatches = binaryHost(host, binary_bytes);
+  binary_device.join();
+  uint32_t binary_time = MonotonicClock::nowMicros() - start;
+
+  snprintf(line, sizeof(line), "%lu samples of %u loops over a %s", (unsigned long)SAMPLES, (unsigned)LOOPS, kind);
+  printLine(line);
+  printLine("protocol     bytes/value  ns/value  values/s");
+  double total = (double)SAMPLES * LOOPS;
+  snprintf(line, sizeof(line), "text line    %11.2f %9.1f %9.3g", (double)text_bytes / values,
+           text_time * 1000.0 / values, values / (text_time * 1.0e-6));
+  printLine(line);
+  snprintf(line, sizeof(line), "binary frame %11.2f %9.1f %9.3g", (double)binary_bytes / total,
+           binary_time * 1000.0 / total, total / (binary_time * 1.0e-6));
+  printLine(line);
+  snprintf(line, sizeof(line), "binary mismatches: %lu", (unsigned long)mismatches);
+  printLine(line);
+}
+
+int main() {
+  runAll();
+  return 0;
+}
+#endif
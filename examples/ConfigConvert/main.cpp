@@ -0,0 +1,172 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Converts a text controller configuration to the binary image loaded by Persist::Config. On a host, run it as
+ * "ConfigConvert <input.txt> <output.bin>"; without arguments, and on Arduino, it converts a built in sample and
+ * prints the block summary.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/persist sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <persist/config.h>
+#include <persist/configText.h>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Persist::ConfigBlock;
+using ControlAlgorithms::Persist::ConfigText;
+using ControlAlgorithms::Persist::ConfigView;
+
+const char sample[] =
+  "# gain has_limits min_limit max_limit max_time_step\n"
+  "bank integral\n"
+  "0.5 1 -10 10 0.1\n"
+  "0.8 1 -5 5\n"
+  "1.2\n"
+  "# gain min_time_step max_time_step\n"
+  "bank derivative\n"
+  "0.05 0.0001\n"
+  "0.02\n"
+  "# gain\n"
+  "bank proportional\n"
+  "2.0\n"
+  "1.5\n"
+  "3.0\n";
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+/**
+ * Convert text into a freshly allocated image
+ * @return size_t image size, 0 on an error; the caller frees image
+ */
+size_t convert(const char *text, size_t length, void *&image) {
+  char line[96];
+  uint32_t error_line = 0;
+  image = nullptr;
+  size_t size = ConfigText::convert(text, length, nullptr, 0, error_line);
+  if(size == 0) {
+    snprintf(line, sizeof(line), "syntax error on line %lu", (unsigned long)error_line);
+    printLine(line);
+    return 0;
+  }
+  // The image must be 16 byte aligned; malloc is on the hosts this runs on, and on AVR nothing needs more than 1
+  image = malloc(size);
+  if(image == nullptr || ConfigText::convert(text, length, image, size, error_line) != size) {
+    printLine("conversion failed");
+    free(image);
+    image = nullptr;
+    return 0;
+  }
+  return size;
+}
+
+void summarize(const void *image, size_t size) {
+  ConfigView view;
+  if(!view.open(image, size)) {
+    printLine("image does not validate");
+    return;
+  }
+  static const char *const names[] = {"", "proportional", "integral", "derivative"};
+  char line[96];
+  snprintf(line, sizeof(line), "%lu bytes, %u banks", (unsigned long)size, (unsigned)view.getBlockCount());
+  printLine(line);
+  for(uint16_t index = 0; index < view.getBlockCount(); ++index) {
+    ConfigBlock block = view.getBlock(index);
+    uint16_t kind = block.getKind();
+    snprintf(line, sizeof(line), "  %-12s %lu loops, first gain %.3f", kind < 4 ? names[kind] : "?",
+             (unsigned long)block.getCount(), block.getCount() > 0 ? (double)block.getFloatSection(0)[0] : 0.0);
+    printLine(line);
+  }
+}
+
+void runSample() {
+  void *image = nullptr;
+  size_t size = convert(sample, sizeof(sample) - 1, image);
+  if(size != 0) {
+    summarize(image, size);
+  }
+  free(image);
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+}
+
+void loop() {
+  runSample();
+  delay(5000);
+}
+#else
+int main(int argc, char **argv) {
+  if(argc < 3) {
+    runSample();
+    return 0;
+  }
+
+  FILE *input = fopen(argv[1], "rb");
+  if(input == nullptr) {
+    printLine("cannot open the input");
+    return 1;
+  }
+  fseek(input, 0, SEEK_END);
+  long length = ftell(input);
+  fseek(input, 0, SEEK_SET);
+  char *text = static_cast<char *>(malloc(length > 0 ? (size_t)length : 1));
+  size_t read = text != nullptr ? fread(text, 1, (size_t)length, input) : 0;
+  fclose(input);
+
+  void *image = nullptr;
+  size_t size = convert(text, read, image);
+  free(text);
+  if(size == 0) {
+    return 1;
+  }
+  FILE *output = fopen(argv[2], "wb");
+  bool written = output != nullptr && fwrite(image, 1, size, output) == size;
+  if(output != nullptr) {
+    written = fclose(output) == 0 && written;
+  }
+  if(written) {
+    summarize(image, size);
+  } else {
+    printLine("cannot write the output");
+  }
+  free(image);
+  return written ? 0 : 1;
+}
+#endif
@@ -0,0 +1,179 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Start-up cost of provisioning a bank of integral loops from a binary configuration against the setter path.
+ * The setter path builds an IntegralSettings per loop and stores it with IntegralBank::setSettings; the loader
+ * validates the image and fills the bank settings arrays with one memcpy each. On a host the image is written to
+ * a file and mapped with MappedFile; the load time is split into mapping, validation (including the checksum)
+ * and the copy. On Arduino the image is loaded from memory. Both paths must leave identical settings.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/persist sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <persist/config.h>
+#include <persist/mappedFile.h>
+#include <ingest/monotonicClock.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Ingest::MonotonicClock;
+using ControlAlgorithms::Persist::Config;
+using ControlAlgorithms::Persist::ConfigView;
+using ControlAlgorithms::Persist::ConfigWriter;
+using ControlAlgorithms::Persist::MappedFile;
+
+#if defined(ARDUINO)
+const size_t LOOPS = 32;
+#else
+const size_t LOOPS = 65536;
+const char *const PATH = "/tmp/control_algorithms_config.bin";
+#endif
+const size_t IMAGE_SIZE = sizeof(ControlAlgorithms::Persist::ConfigHeader) +
+                          sizeof(ControlAlgorithms::Persist::ConfigBlockHeader) + 4 * (LOOPS * sizeof(float) + 16) +
+                          LOOPS + 16;
+
+ControlAlgorithms::PID::IntegralBank<LOOPS> setter_bank;
+ControlAlgorithms::PID::IntegralBank<LOOPS> loaded_bank;
+alignas(16) uint8_t image[IMAGE_SIZE];
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+// Settings of one loop, as a configuration source would supply them
+void loopSettings(size_t loop, ControlAlgorithms::PID::IntegralSettings &settings) {
+  settings.setGain(0.1f + 0.001f * (float)(loop % 1000));
+  settings.setHasLimits(loop % 3 != 0);
+  settings.setMinLimit(-10.0f - (float)(loop % 7));
+  settings.setMaxLimit(10.0f + (float)(loop % 5));
+  settings.setMaxTimeStep(0.01f * (float)(1 + loop % 4));
+}
+
+void provisionSetters() {
+  ControlAlgorithms::PID::IntegralSettings settings;
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    loopSettings(loop, settings);
+    setter_bank.setSettings(loop, settings);
+  }
+}
+
+// Validate the image and load it, timing the two steps
+bool provisionImage(const void *data, size_t size, uint32_t &validate_micros, uint32_t &copy_micros) {
+  ConfigView view;
+  uint32_t start = MonotonicClock::nowMicros();
+  bool valid = view.open(data, size) && view.getBlockCount() == 1;
+  validate_micros = MonotonicClock::nowMicros() - start;
+  start = MonotonicClock::nowMicros();
+  bool loaded = valid && Config::load(view.getBlock(0), loaded_bank);
+  copy_micros = MonotonicClock::nowMicros() - start;
+  return loaded;
+}
+
+bool identical() {
+  return memcmp(setter_bank.getGainArray(), loaded_bank.getGainArray(), LOOPS * sizeof(float)) == 0 &&
+         memcmp(setter_bank.getMinLimitArray(), loaded_bank.getMinLimitArray(), LOOPS * sizeof(float)) == 0 &&
+         memcmp(setter_bank.getMaxLimitArray(), loaded_bank.getMaxLimitArray(), LOOPS * sizeof(float)) == 0 &&
+         memcmp(setter_bank.getMaxTimeStepArray(), loaded_bank.getMaxTimeStepArray(), LOOPS * sizeof(float)) == 0 &&
+         memcmp(setter_bank.getHasLimitsArray(), loaded_bank.getHasLimitsArray(), LOOPS) == 0;
+}
+
+void runAll() {
+  char line[128];
+
+  uint32_t start = MonotonicClock::nowMicros();
+  provisionSetters();
+  uint32_t setter_micros = MonotonicClock::nowMicros() - start;
+
+  // Build the image from the provisioned bank, as a configuration tool would
+  ConfigWriter writer;
+  size_t size = 0;
+  if(writer.begin(image, sizeof(image)) && writer.add(setter_bank, LOOPS)) {
+    size = writer.finish();
+  }
+  if(size == 0) {
+    printLine("image does not fit");
+    return;
+  }
+
+  uint32_t map_micros = 0;
+  uint32_t validate_micros = 0;
+  uint32_t copy_micros = 0;
+#if defined(ARDUINO)
+  bool loaded = provisionImage(image, size, validate_micros, copy_micros);
+#else
+  FILE *file = fopen(PATH, "wb");
+  bool written = file != nullptr && fwrite(image, 1, size, file) == size;
+  if(file != nullptr) {
+    written = fclose(file) == 0 && written;
+  }
+  if(!written) {
+    printLine("cannot write the image");
+    return;
+  }
+  start = MonotonicClock::nowMicros();
+  MappedFile mapped;
+  bool mapped_ok = mapped.open(PATH);
+  map_micros = MonotonicClock::nowMicros() - start;
+  bool loaded = mapped_ok && provisionImage(mapped.getData(), mapped.getSize(), validate_micros, copy_micros);
+  mapped.close();
+  remove(PATH);
+#endif
+
+  snprintf(line, sizeof(line), "%lu loops, %lu byte image", (unsigned long)LOOPS, (unsigned long)size);
+  printLine(line);
+  snprintf(line, sizeof(line), "setters   %8lu us", (unsigned long)setter_micros);
+  printLine(line);
+  snprintf(line, sizeof(line), "load      %8lu us (map %lu, validate %lu, copy %lu)",
+           (unsigned long)(map_micros + validate_micros + copy_micros), (unsigned long)map_micros,
+           (unsigned long)validate_micros, (unsigned long)copy_micros);
+  printLine(line);
+  printLine(loaded && identical() ? "loaded settings match the setters" : "loaded settings DIFFER from the setters");
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+}
+
+void loop() {
+  runAll();
+  delay(5000);
+}
+#else
+int main() {
+  runAll();
+  return 0;
+}
+#endif
@@ -0,0 +1,188 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Handle and compaction checks of Bank::ControllerPool. The pool is filled to capacity, a controller in the middle
+ * is destroyed (the last one moves into its place and every other handle must still find its controller), its
+ * slot is reused (the old handle must then resolve to nullptr) and one slot is cycled through a full wrap of its
+ * 16 bit generation, which must never issue the reserved zero. Each controller's gain identifies it.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid sources and -I src.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <bank/controllerPool.h>
+#include <pid/proportional.h>
+#include <stdio.h>
+#include <stdint.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Bank::ControllerPool;
+using ControlAlgorithms::Bank::PoolHandle;
+using ControlAlgorithms::Base::ControlSettings;
+using ControlAlgorithms::PID::Proportional;
+
+const uint16_t CAPACITY = 8;
+const uint16_t MIDDLE = 3;
+
+ControllerPool<Proportional, CAPACITY> pool;
+PoolHandle handles[CAPACITY];
+uint32_t failures;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void check(bool passed, const char *what) {
+  if(!passed) {
+    char line[96];
+    snprintf(line, sizeof(line), "FAILED: %s", what);
+    printLine(line);
+    ++failures;
+  }
+}
+
+float gainOf(const Proportional *controller) {
+  ControlSettings settings;
+  controller->getSettings(settings);
+  return settings.getGain();
+}
+
+// Every handle but the destroyed one finds the controller it was created for
+void checkHandles(uint16_t destroyed) {
+  for(uint16_t i = 0; i < CAPACITY; ++i) {
+    if(i == destroyed) {
+      continue;
+    }
+    const Proportional *controller = pool.get(handles[i]);
+    check(controller != nullptr && gainOf(controller) == (float)(i + 1), "handle finds its controller");
+  }
+}
+
+void fill() {
+  for(uint16_t i = 0; i < CAPACITY; ++i) {
+    handles[i] = pool.create();
+    check(handles[i].isValid(), "create below capacity");
+    ControlSettings settings;
+    settings.setGain((float)(i + 1));
+    pool.get(handles[i])->setSettings(settings);
+  }
+  check(pool.isFull() && pool.size() == CAPACITY, "full at capacity");
+  check(!pool.create().isValid(), "create when full");
+  check(pool.get(PoolHandle()) == nullptr, "default handle");
+  check(pool.get(PoolHandle(CAPACITY, 1)) == nullptr, "slot out of range");
+  checkHandles(CAPACITY);
+}
+
+void destroyMiddle() {
+  // Swap with last: the last controller moves into the hole and the live range stays packed
+  check(pool.destroy(handles[MIDDLE]), "destroy");
+  check(pool.size() == CAPACITY - 1 && !pool.isFull(), "size after destroy");
+  check(pool.get(handles[MIDDLE]) == nullptr && !pool.isAlive(handles[MIDDLE]), "destroyed handle");
+  check(!pool.destroy(handles[MIDDLE]), "destroy twice");
+  check(gainOf(&pool.at(MIDDLE)) == (float)CAPACITY, "last moved into the hole");
+  float sum = 0.0f;
+  for(const Proportional *controller = pool.begin(); controller != pool.end(); ++controller) {
+    sum += gainOf(controller);
+  }
+  check(sum == (float)(CAPACITY * (CAPACITY + 1) / 2 - (MIDDLE + 1)), "live range");
+  checkHandles(MIDDLE);
+}
+
+void reuseSlot() {
+  // The freed slot is handed out again under a new generation, in the default state
+  PoolHandle reused = pool.create();
+  check(reused.getSlot() == handles[MIDDLE].getSlot(), "slot reused");
+  check(reused.getGeneration() != handles[MIDDLE].getGeneration(), "new generation");
+  check(pool.get(handles[MIDDLE]) == nullptr, "stale handle after reuse");
+  check(pool.get(reused) != nullptr && gainOf(pool.get(reused)) == 0.0f, "reused controller reset");
+  checkHandles(MIDDLE);
+  handles[MIDDLE] = reused;
+  ControlSettings settings;
+  settings.setGain((float)(MIDDLE + 1));
+  pool.get(reused)->setSettings(settings);
+}
+
+void wrapGeneration() {
+  // Cycle one slot until its generation wraps; zero is reserved for invalid handles and must be skipped
+  PoolHandle previous = handles[MIDDLE];
+  bool wrapped = false;
+  for(uint32_t cycle = 0; cycle < 0x10000u; ++cycle) {
+    pool.destroy(previous);
+    PoolHandle next = pool.create();
+    if(next.getGeneration() == 0 || next.getSlot() != previous.getSlot() || pool.get(previous) != nullptr ||
+       pool.get(next) == nullptr) {
+      check(false, "generation cycle");
+      return;
+    }
+    wrapped = wrapped || next.getGeneration() < previous.getGeneration();
+    previous = next;
+  }
+  check(wrapped, "generation wrapped");
+  // A full wrap brings the generation back, so a handle kept that long aliases; the 16 bit counter bounds that
+  check(previous.getGeneration() == handles[MIDDLE].getGeneration() + 1, "generation after a full cycle");
+  handles[MIDDLE] = previous;
+  ControlSettings settings;
+  settings.setGain((float)(MIDDLE + 1));
+  pool.get(previous)->setSettings(settings);
+  checkHandles(CAPACITY);
+}
+
+void clearAll() {
+  pool.clear();
+  check(pool.size() == 0 && !pool.isFull(), "size after clear");
+  for(uint16_t i = 0; i < CAPACITY; ++i) {
+    check(pool.get(handles[i]) == nullptr, "handle after clear");
+  }
+}
+
+void runAll() {
+  fill();
+  destroyMiddle();
+  reuseSlot();
+  wrapGeneration();
+  clearAll();
+  printLine(failures == 0 ? "passed" : "FAILED");
+}
+
+#if defined(ARDUINO)
+void setup() {
+  Serial.begin(115200);
+  runAll();
+}
+
+void loop() {
+}
+#else
+int main() {
+  runAll();
+  return failures == 0 ? 0 : 1;
+}
+#endif
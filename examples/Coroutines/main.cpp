@@ -0,0 +1,218 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Cooperative control tasks on C++20 coroutines. A 1 kHz velocity loop, a 100 Hz position loop and a comms task
+ * share one thread through a TaskScheduler; each loop awaits its next period and gets its time step back. On a
+ * host the scheduler runs from a SimulatedClock for one simulated second, then reports the task statistics, the
+ * frame arena use and the cost of a task switch.
+ *
+ * Needs C++20 (e.g. -std=c++20). Builds as an Arduino sketch, or on a host by compiling this file with the
+ * src/pid sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <cooperative/taskScheduler.h>
+#include <cooperative/simulatedClock.h>
+#include <pid/proportional.h>
+#include <pid/integral.h>
+#include <timing/cycleCounter.h>
+#include <stdio.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+#if !defined(CONTROLALGORITHMS_HAS_COROUTINES)
+#error "This example needs C++20 coroutines"
+#endif
+
+using namespace ControlAlgorithms;
+
+typedef Cooperative::TaskScheduler<4> Scheduler;
+Scheduler scheduler;
+
+const uint32_t VELOCITY_PERIOD_US = 1000;
+const uint32_t POSITION_PERIOD_US = 10000;
+const uint32_t COMMS_PERIOD_US = 5000;
+const uint32_t SIMULATED_US = 1000000;
+
+// Simulated plant and the signal between the loops
+float position{0.0};
+float velocity{0.0};
+float velocity_setpoint{0.0};
+const float target_position{1.0};
+uint32_t messages{0};
+
+Cooperative::PeriodicTimer<Scheduler> *velocity_timer{nullptr};
+Cooperative::PeriodicTimer<Scheduler> *position_timer{nullptr};
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+Cooperative::Task velocityLoop() {
+  PID::Proportional control_p;
+  PID::Integral control_i;
+  Base::ControlSettings p_settings;
+  p_settings.setGain(20.0);
+  control_p.setSettings(p_settings);
+  PID::IntegralSettings i_settings;
+  i_settings.setGain(50.0);
+  control_i.setSettings(i_settings);
+
+  Cooperative::PeriodicTimer<Scheduler> timer(scheduler, VELOCITY_PERIOD_US);
+  velocity_timer = &timer;
+  Base::ControlInput input;
+  Base::ControlOutput output;
+  for(;;) {
+    float delta_t = co_await timer;
+    input.setError(velocity_setpoint - velocity);
+    input.setDeltaT(delta_t);
+    control_p.update(input, output);
+    float acceleration = output.getControl();
+    control_i.update(input, output);
+    acceleration += output.getControl();
+
+    // The plant: a mass with friction
+    velocity += (acceleration - 0.5f * velocity) * delta_t;
+    position += velocity * delta_t;
+  }
+}
+
+Cooperative::Task positionLoop() {
+  PID::Proportional control_p;
+  Base::ControlSettings p_settings;
+  p_settings.setGain(2.0);
+  control_p.setSettings(p_settings);
+
+  Cooperative::PeriodicTimer<Scheduler> timer(scheduler, POSITION_PERIOD_US);
+  position_timer = &timer;
+  Base::ControlInput input;
+  Base::ControlOutput output;
+  for(;;) {
+    input.setDeltaT(co_await timer);
+    input.setError(target_position - position);
+    control_p.update(input, output);
+    velocity_setpoint = output.getControl();
+  }
+}
+
+Cooperative::Task comms() {
+  char line[96];
+  for(;;) {
+    co_await scheduler.sleepFor(COMMS_PERIOD_US);
+    // Stand-in for sending telemetry; report every 200 messages
+    if(++messages % 200 == 0) {
+      snprintf(line, sizeof(line), "t=%lu us position %.4f", (unsigned long)scheduler.getNow(), position);
+      printLine(line);
+    }
+    co_await scheduler.yield();
+  }
+}
+
+Cooperative::Task velocity_task;
+Cooperative::Task position_task;
+Cooperative::Task comms_task;
+
+void report(uint32_t switches, uint32_t cycles) {
+  char line[128];
+  const Cooperative::PeriodicTimer<Scheduler> *timers[2] = {velocity_timer, position_timer};
+  const char *names[2] = {"velocity", "position"};
+  for(uint8_t timer = 0; timer < 2; ++timer) {
+    snprintf(line, sizeof(line), "%-8s %6lu runs, %lu missed, max lateness %lu us", names[timer],
+             (unsigned long)timers[timer]->getRuns(), (unsigned long)timers[timer]->getMissedDeadlines(),
+             (unsigned long)timers[timer]->getMaxLatenessMicros());
+    printLine(line);
+  }
+  snprintf(line, sizeof(line), "frames %u/%u of %u bytes, %lu failed", Cooperative::taskFrameArena().getPeak(),
+           Cooperative::taskFrameArena().capacity(), (unsigned)Cooperative::taskFrameArena().getBlockSize(),
+           (unsigned long)Cooperative::taskFrameArena().getFailures());
+  printLine(line);
+  if(switches > 0) {
+    snprintf(line, sizeof(line), "%.1f %s per task switch including the control update",
+             (double)cycles / (double)switches, Timing::CycleCounter::unit());
+    printLine(line);
+  }
+}
+
+bool spawnAll() {
+  velocity_task = velocityLoop();
+  position_task = positionLoop();
+  comms_task = comms();
+  return scheduler.spawn(velocity_task) && scheduler.spawn(position_task) && scheduler.spawn(comms_task);
+}
+
+#if defined(ARDUINO)
+uint32_t switches{0};
+uint32_t cycles{0};
+uint32_t last_report_us{0};
+
+void setup() {
+  Serial.begin(115200);
+  while(!Serial) {}
+  scheduler.start();
+  if(!spawnAll()) {
+    printLine("Could not spawn the tasks; raise CONTROLALGORITHMS_COROUTINE_FRAME_SIZE");
+  }
+  last_report_us = scheduler.getNow();
+}
+
+void loop() {
+  uint32_t start = Timing::CycleCounter::now();
+  uint16_t resumed = scheduler.poll();
+  if(resumed > 0) {
+    cycles += Timing::CycleCounter::now() - start;
+    switches += resumed;
+  }
+  if(scheduler.getNow() - last_report_us >= SIMULATED_US) {
+    last_report_us += SIMULATED_US;
+    report(switches, cycles);
+  }
+}
+#else
+int main() {
+  Cooperative::SimulatedClock clock;
+  scheduler.startAt(clock.now());
+  if(!spawnAll()) {
+    printLine("Could not spawn the tasks; raise CONTROLALGORITHMS_COROUTINE_FRAME_SIZE");
+    return 1;
+  }
+
+  // Jump the clock straight to the next timer, so a simulated second takes microseconds
+  uint32_t switches = 0;
+  uint32_t cycles = 0;
+  while(clock.now() <= SIMULATED_US) {
+    uint32_t start = Timing::CycleCounter::now();
+    switches += scheduler.pollAt(clock.now());
+    cycles += Timing::CycleCounter::now() - start;
+    clock.set(scheduler.getNextWakeMicros());
+  }
+  report(switches, cycles);
+  return 0;
+}
+#endif
@@ -0,0 +1,272 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Randomized differential and property checks of every controller implementation against the stateless
+ * reference (see src/verify/differential.h). Each case draws random settings and a random error and time step
+ * sequence; the hardened cases mix in non-finite errors and out of range time steps. The output conditioner and
+ * its anti-windup feedback, the sliding mode and the bang-bang controllers and the loop metrics run on the same
+ * sequences, and a long run checks the compensated metrics against double sums. Prints the tally and the
+ * first failing check. Snapshot images of the same runs are checked to round trip and damaged copies to be
+ * rejected.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid, src/nonlinear, src/monitor,
+ * src/persist and src/verify sources and -I src. Defining CONTROLALGORITHMS_FUZZ replaces main with a libFuzzer entry point that decodes the settings and
+ * sequence from the fuzzer's bytes, e.g.
+ *     clang++ -fsanitize=fuzzer,address -DCONTROLALGORITHMS_FUZZ -I src main.cpp src/pid/... src/verify/...
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <verify/differential.h>
+#include <verify/randomInput.h>
+#include <verify/snapshotChecks.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Verify::CheckReport;
+using ControlAlgorithms::Verify::Differential;
+using ControlAlgorithms::Verify::RandomInput;
+using ControlAlgorithms::Verify::SnapshotChecks;
+
+#if defined(ARDUINO)
+const uint32_t CASES = 200;
+#else
+const uint32_t CASES = 20000;
+#endif
+const size_t MAX_STEPS = 64;
+#if defined(ARDUINO)
+const uint32_t DRIFT_SAMPLES = 20000;
+#else
+const uint32_t DRIFT_SAMPLES = 1000000;
+#endif
+
+// Implementations share the kernels, so they are expected to agree exactly; the slack allows for FMA contraction
+const uint32_t TOLERANCE_ULP = 2;
+
+float errors[MAX_STEPS];
+float delta_ts[MAX_STEPS];
+float setpoints[MAX_STEPS];
+float feed_forwards[MAX_STEPS];
+
+#if !defined(CONTROLALGORITHMS_FUZZ)
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void printReport(const char *name, const CheckReport &report) {
+  char line[160];
+  snprintf(line, sizeof(line), "%-24s %8lu checks, %6lu failures, max %lu ULP%s%s", name,
+           (unsigned long)report.getChecks(), (unsigned long)report.getFailures(),
+           (unsigned long)report.getMaxUlp(), report.passed() ? "" : ", first: ",
+           report.passed() ? "" : report.getFirstFailure());
+  printLine(line);
+}
+
+// Run every check over random cases; returns true if all passed
+bool runAll(uint32_t seed) {
+  RandomInput random(seed);
+  CheckReport proportional;
+  CheckReport integral;
+  CheckReport derivative;
+  CheckReport weighted;
+  CheckReport integral_hardened;
+  CheckReport derivative_hardened;
+  CheckReport conditioner;
+  CheckReport nonlinear;
+  CheckReport metrics;
+  CheckReport snapshot;
+
+  SnapshotChecks::checkConfigValidation(snapshot);
+  Differential::checkAntiWindup(conditioner);
+  Differential::checkLoopMetricsDrift(seed, DRIFT_SAMPLES, metrics);
+  for(uint32_t test_case = 0; test_case < CASES; ++test_case) {
+    size_t steps = 1 + random.nextBits() % MAX_STEPS;
+    for(size_t step = 0; step < steps; ++step) {
+      errors[step] = random.error();
+      delta_ts[step] = random.deltaT();
+      setpoints[step] = random.error();
+      feed_forwards[step] = random.uniform(-10.0f, 10.0f);
+    }
+    ControlAlgorithms::PID::IntegralSettings i_settings;
+    random.integralSettings(i_settings);
+    ControlAlgorithms::PID::DerivativeSettings d_settings;
+    random.derivativeSettings(d_settings);
+    ControlAlgorithms::PID::OutputConditionerSettings c_settings;
+    random.conditionerSettings(c_settings);
+    ControlAlgorithms::Nonlinear::SlidingModeSettings sm_settings;
+    random.slidingModeSettings(sm_settings);
+    ControlAlgorithms::Nonlinear::BangBangSettings bb_settings;
+    random.bangBangSettings(bb_settings);
+    ControlAlgorithms::Monitor::LoopMetricsSettings lm_settings;
+    random.loopMetricsSettings(lm_settings);
+
+    Differential::checkProportional(random.uniform(-10.0f, 10.0f), errors, steps, TOLERANCE_ULP, proportional);
+    Differential::checkIntegral(i_settings, errors, delta_ts, steps, TOLERANCE_ULP, integral);
+    Differential::checkDerivative(d_settings, errors, delta_ts, steps, TOLERANCE_ULP, derivative);
+    SnapshotChecks::checkValidation(i_settings, errors, delta_ts, steps, snapshot);
+    Differential::checkLoopMetrics(lm_settings, errors, delta_ts, steps, TOLERANCE_ULP, metrics);
+    Differential::checkConditioner(c_settings, i_settings, errors, delta_ts, steps, TOLERANCE_ULP, conditioner);
+    Differential::checkSlidingMode(sm_settings, errors, delta_ts, steps, TOLERANCE_ULP, nonlinear);
+    Differential::checkBangBang(bb_settings, errors, steps, TOLERANCE_ULP, nonlinear);
+
+    // The errors serve as measurements for the 2-DOF controllers
+    ControlAlgorithms::PID::WeightedProportionalSettings wp_settings;
+    wp_settings.setGain(random.uniform(-10.0f, 10.0f));
+    wp_settings.setSetpointWeight(random.uniform(0.0f, 1.0f));
+    ControlAlgorithms::PID::WeightedDerivativeSettings wd_settings;
+    random.derivativeSettings(wd_settings);
+    wd_settings.setSetpointWeight(random.uniform(0.0f, 1.0f));
+    Differential::checkWeighted(wp_settings, wd_settings, setpoints, errors, feed_forwards, delta_ts, steps,
+                                TOLERANCE_ULP, weighted);
+
+    // Invalid samples for the hardened paths
+    for(size_t step = 0; step < steps; ++step) {
+      switch(random.nextBits() % 8) {
+        case 0:
+          errors[step] = random.nonFinite();
+          break;
+        case 1:
+          delta_ts[step] = (random.nextBits() & 1) ? -delta_ts[step] : random.nonFinite();
+          break;
+        case 2:
+          delta_ts[step] = 2.0f;
+          break;
+        default:
+          break;
+      }
+    }
+    Differential::checkIntegralHardened(i_settings, errors, delta_ts, steps, TOLERANCE_ULP, integral_hardened);
+    Differential::checkDerivativeHardened(d_settings, errors, delta_ts, steps, TOLERANCE_ULP, derivative_hardened);
+    Differential::checkConditioner(c_settings, i_settings, errors, delta_ts, steps, TOLERANCE_ULP, conditioner);
+    Differential::checkSlidingMode(sm_settings, errors, delta_ts, steps, TOLERANCE_ULP, nonlinear);
+    Differential::checkBangBang(bb_settings, errors, steps, TOLERANCE_ULP, nonlinear);
+    // A zero minimum time step is allowed and must not turn a rejected sample into 0/0
+    d_settings.setMinTimeStep(0.0f);
+    Differential::checkDerivativeHardened(d_settings, errors, delta_ts, steps, TOLERANCE_ULP, derivative_hardened);
+  }
+
+  printReport("proportional", proportional);
+  printReport("integral", integral);
+  printReport("derivative", derivative);
+  printReport("weighted", weighted);
+  printReport("integral hardened", integral_hardened);
+  printReport("derivative hardened", derivative_hardened);
+  printReport("conditioner", conditioner);
+  printReport("nonlinear", nonlinear);
+  printReport("loop metrics", metrics);
+  printReport("snapshot", snapshot);
+  return proportional.passed() && integral.passed() && derivative.passed() && weighted.passed() &&
+         integral_hardened.passed() && derivative_hardened.passed() && conditioner.passed() && nonlinear.passed() &&
+         metrics.passed() && snapshot.passed();
+}
+
+#if defined(ARDUINO)
+void setup() {
+  Serial.begin(115200);
+}
+
+void loop() {
+  runAll((uint32_t)micros());
+  delay(5000);
+}
+#else
+int main(int argc, char **argv) {
+  uint32_t seed = argc > 1 ? (uint32_t)strtoul(argv[1], nullptr, 0) : 1;
+  return runAll(seed) ? 0 : 1;
+}
+#endif
+
+#else
+
+// Next float from the fuzzer's bytes, zero once they run out
+float takeFloat(const uint8_t *&data, size_t &size) {
+  float value = 0.0f;
+  if(size >= sizeof(value)) {
+    memcpy(&value, data, sizeof(value));
+    data += sizeof(value);
+    size -= sizeof(value);
+  }
+  return value;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  float gain = takeFloat(data, size);
+  float limit_a = takeFloat(data, size);
+  float limit_b = takeFloat(data, size);
+  float max_time_step = takeFloat(data, size);
+  if(!isfinite(limit_a) || !isfinite(limit_b)) {
+    return 0;
+  }
+
+  ControlAlgorithms::PID::IntegralSettings i_settings;
+  i_settings.setGain(gain);
+  i_settings.setHasLimits(true);
+  i_settings.setMinLimit(limit_a < limit_b ? limit_a : limit_b);
+  i_settings.setMaxLimit(limit_a < limit_b ? limit_b : limit_a);
+  i_settings.setMaxTimeStep(max_time_step);
+  ControlAlgorithms::PID::DerivativeSettings d_settings;
+  d_settings.setGain(gain);
+  d_settings.setMaxTimeStep(max_time_step);
+
+  size_t steps = 0;
+  while(size >= 2 * sizeof(float) && steps < MAX_STEPS) {
+    errors[steps] = takeFloat(data, size);
+    delta_ts[steps] = takeFloat(data, size);
+    ++steps;
+  }
+
+  CheckReport report;
+  Differential::checkProportional(gain, errors, steps, TOLERANCE_ULP, report);
+  Differential::checkIntegral(i_settings, errors, delta_ts, steps, TOLERANCE_ULP, report);
+  Differential::checkDerivative(d_settings, errors, delta_ts, steps, TOLERANCE_ULP, report);
+  ControlAlgorithms::PID::WeightedProportionalSettings wp_settings;
+  wp_settings.setGain(gain);
+  wp_settings.setSetpointWeight(0.5f);
+  ControlAlgorithms::PID::WeightedDerivativeSettings wd_settings;
+  wd_settings.setGain(gain);
+  for(size_t step = 0; step < steps; ++step) {
+    setpoints[step] = limit_a;
+    feed_forwards[step] = limit_b;
+  }
+  Differential::checkWeighted(wp_settings, wd_settings, setpoints, errors, feed_forwards, delta_ts, steps, TOLERANCE_ULP,
+                              report);
+  Differential::checkIntegralHardened(i_settings, errors, delta_ts, steps, TOLERANCE_ULP, report);
+  Differential::checkDerivativeHardened(d_settings, errors, delta_ts, steps, TOLERANCE_ULP, report);
+  if(!report.passed()) {
+    fprintf(stderr, "%s failed at step %lu\n", report.getFirstFailure(), (unsigned long)report.getFirstFailureStep());
+    abort();
+  }
+  return 0;
+}
+
+#endif
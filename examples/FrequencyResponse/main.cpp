@@ -0,0 +1,149 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Stability margins of a PID controller from its settings. A Bode table of the open loop around the nominal
+ * plant is printed, then the gain and phase margins over the corners of the plant range used by
+ * examples/MonteCarlo, each found on a dense logarithmic frequency grid up to the Nyquist frequency, with the time
+ * every margin check took.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/analysis sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <analysis/frequencyResponse.h>
+#include <ingest/monotonicClock.h>
+#include <stdio.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Analysis::FrequencyResponse;
+using ControlAlgorithms::Analysis::PlantModel;
+using ControlAlgorithms::Analysis::StabilityMargins;
+using ControlAlgorithms::Ingest::MonotonicClock;
+
+#if defined(ARDUINO)
+const uint32_t FREQUENCIES = 256;
+#else
+const uint32_t FREQUENCIES = 10000;
+#endif
+const uint32_t BODE_ROWS = 12;
+const float DELTA_T = 0.01f;
+const float NYQUIST = 3.14159265f / DELTA_T;
+
+// Plant corners: gain, time constant, dead time in samples
+struct Corner {
+  float gain;
+  float time_constant;
+  uint32_t dead_time;
+};
+const Corner CORNERS[] = {
+  {2.5f, 1.25f, 30},
+  {1.0f, 2.0f, 0},
+  {4.0f, 2.0f, 0},
+  {1.0f, 0.5f, 60},
+  {4.0f, 2.0f, 60},
+  {4.0f, 0.5f, 60},
+};
+const size_t CORNER_COUNT = sizeof(CORNERS) / sizeof(CORNERS[0]);
+
+float frequency[FREQUENCIES];
+float real[FREQUENCIES];
+float imag[FREQUENCIES];
+float magnitude_db[FREQUENCIES];
+float phase[FREQUENCIES];
+
+ControlAlgorithms::Base::ControlSettings p_settings;
+ControlAlgorithms::PID::IntegralSettings i_settings;
+ControlAlgorithms::PID::DerivativeSettings d_settings;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void setupAnalysis() {
+  // The PI controller of examples/MonteCarlo
+  p_settings.setGain(0.8f);
+  i_settings.setGain(0.8f);
+  d_settings.setGain(0.0f);
+  FrequencyResponse::logSpace(0.001f, NYQUIST, frequency, FREQUENCIES);
+}
+
+void runAll() {
+  char line[128];
+
+  // The phase is unwrapped along the dense grid, so it is taken from there and only every few rows are printed
+  PlantModel plant;
+  PlantModel::firstOrder(CORNERS[0].gain, CORNERS[0].time_constant, CORNERS[0].dead_time, DELTA_T, plant);
+  FrequencyResponse::openLoop(p_settings, i_settings, d_settings, plant, DELTA_T, frequency, real, imag, FREQUENCIES);
+  FrequencyResponse::bode(real, imag, magnitude_db, phase, FREQUENCIES);
+  printLine("nominal plant open loop");
+  printLine("   rad/s   mag dB    phase");
+  for(uint32_t row = 0; row < BODE_ROWS; ++row) {
+    uint32_t index = row * (FREQUENCIES - 1) / (BODE_ROWS - 1);
+    snprintf(line, sizeof(line), "%8.3f %8.2f %8.1f", frequency[index], magnitude_db[index], phase[index]);
+    printLine(line);
+  }
+
+  snprintf(line, sizeof(line), "margins on %lu frequencies", (unsigned long)FREQUENCIES);
+  printLine(line);
+  printLine(" gain   tau dead    GM dB  at rad/s   PM deg  at rad/s  time us");
+  for(size_t corner = 0; corner < CORNER_COUNT; ++corner) {
+    PlantModel::firstOrder(CORNERS[corner].gain, CORNERS[corner].time_constant, CORNERS[corner].dead_time, DELTA_T,
+                           plant);
+    StabilityMargins margins;
+    uint32_t start = MonotonicClock::nowMicros();
+    FrequencyResponse::margins(p_settings, i_settings, d_settings, plant, DELTA_T, frequency, FREQUENCIES, margins);
+    uint32_t elapsed = MonotonicClock::nowMicros() - start;
+    snprintf(line, sizeof(line), "%5.2f %5.2f %4lu %8.2f %9.3f %8.2f %9.3f %8lu", CORNERS[corner].gain,
+             CORNERS[corner].time_constant, (unsigned long)CORNERS[corner].dead_time, margins.getGainMarginDb(),
+             margins.getPhaseCrossover(), margins.getPhaseMargin(), margins.getGainCrossover(), (unsigned long)elapsed);
+    printLine(line);
+  }
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+  setupAnalysis();
+}
+
+void loop() {
+  runAll();
+  delay(5000);
+}
+#else
+int main() {
+  setupAnalysis();
+  runAll();
+  return 0;
+}
+#endif
@@ -0,0 +1,241 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Dispatch cost of a mixed fleet of proportional, integral, derivative and bang-bang loops. The per loop path keeps
+ * the loops interleaved, each with a kind tag, and switches on the tag to call the stateful controller of that
+ * kind. Bank::HeterogeneousBank keeps each kind in its own bank, type sorted, and updates every bank once per
+ * sample. The median cost per loop update of each is reported, and the control signals of both are checked to be
+ * identical. The samples of both paths, including the permutation into type sorted order, are prepared before
+ * timing, so only the dispatch is timed.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid and src/nonlinear sources and
+ * -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <bank/heterogeneousBank.h>
+#include <nonlinear/bangBang.h>
+#include <nonlinear/bangBangBank.h>
+#include <pid/proportional.h>
+#include <pid/proportionalBank.h>
+#include <pid/integral.h>
+#include <pid/integralBank.h>
+#include <pid/derivative.h>
+#include <pid/derivativeBank.h>
+#include <timing/wcetHarness.h>
+#include <stdio.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Timing::TimingStats;
+using ControlAlgorithms::Timing::WcetHarness;
+
+#if defined(ARDUINO)
+const size_t PER_KIND = 8;
+const uint32_t SAMPLES = 200;
+// Distinct sample rows, cycled through by the timed iterations
+const uint32_t ROWS = 4;
+#else
+const size_t PER_KIND = 1024;
+const uint32_t SAMPLES = 2000;
+// errorAt repeats every 41 iterations
+const uint32_t ROWS = 41;
+#endif
+const size_t KINDS = 4;
+const size_t LOOPS = KINDS * PER_KIND;
+const float DELTA_T = 0.001f;
+
+const uint8_t KIND_PROPORTIONAL = 0;
+const uint8_t KIND_INTEGRAL = 1;
+const uint8_t KIND_DERIVATIVE = 2;
+const uint8_t KIND_BANG_BANG = 3;
+
+// Per loop path: interleaved loops, each with its kind and its index among the controllers of that kind
+uint8_t loop_kind[LOOPS];
+uint16_t loop_index[LOOPS];
+ControlAlgorithms::PID::Proportional proportionals[PER_KIND];
+ControlAlgorithms::PID::Integral integrals[PER_KIND];
+ControlAlgorithms::PID::Derivative derivatives[PER_KIND];
+ControlAlgorithms::Nonlinear::BangBang bang_bangs[PER_KIND];
+float interleaved_error[ROWS][LOOPS];
+float interleaved_control[LOOPS];
+
+// Type sorted path; the kinds are in the order of the KIND_ constants
+typedef ControlAlgorithms::Bank::HeterogeneousBank<ControlAlgorithms::PID::ProportionalBank<PER_KIND>,
+                                                   ControlAlgorithms::PID::IntegralBank<PER_KIND>,
+                                                   ControlAlgorithms::PID::DerivativeBank<PER_KIND>,
+                                                   ControlAlgorithms::Nonlinear::BangBangBank<PER_KIND>> Fleet;
+Fleet fleet;
+float sorted_error[ROWS][LOOPS];
+float sorted_delta_t[LOOPS];
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+// Error of a loop at a sample, the same for both paths
+float errorAt(size_t loop, uint32_t iteration) {
+  return (float)((int)((loop * 7 + iteration * 3) % 41) - 20) * 0.05f;
+}
+
+void setupFleet() {
+  ControlAlgorithms::Base::ControlSettings p_settings;
+  ControlAlgorithms::PID::IntegralSettings i_settings;
+  ControlAlgorithms::PID::DerivativeSettings d_settings;
+  ControlAlgorithms::Nonlinear::BangBangSettings b_settings;
+  p_settings.setGain(0.8f);
+  i_settings.setGain(0.2f);
+  i_settings.setHasLimits(true);
+  i_settings.setMinLimit(-50.0f);
+  i_settings.setMaxLimit(50.0f);
+  d_settings.setGain(0.01f);
+  b_settings.setGain(1.0f);
+  b_settings.setOffOutput(0.0f);
+  b_settings.setHysteresis(0.25f);
+
+  for(size_t index = 0; index < PER_KIND; ++index) {
+    proportionals[index].setSettings(p_settings);
+    integrals[index].setSettings(i_settings);
+    derivatives[index].setSettings(d_settings);
+    bang_bangs[index].setSettings(b_settings);
+    fleet.getBank<KIND_PROPORTIONAL>().setSettings(index, p_settings);
+    fleet.getBank<KIND_INTEGRAL>().setSettings(index, i_settings);
+    fleet.getBank<KIND_DERIVATIVE>().setSettings(index, d_settings);
+    fleet.getBank<KIND_BANG_BANG>().setSettings(index, b_settings);
+  }
+  for(size_t kind = 0; kind < KINDS; ++kind) {
+    fleet.setSize(kind, PER_KIND);
+  }
+
+  // Interleave the kinds, as a fleet configured loop by loop would be
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    loop_kind[loop] = (uint8_t)(loop % KINDS);
+    loop_index[loop] = (uint16_t)(loop / KINDS);
+  }
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    sorted_delta_t[loop] = DELTA_T;
+  }
+
+  // The same samples in both orders; type sorted slot kind * PER_KIND + index holds interleaved loop index * KINDS + kind
+  for(uint32_t row = 0; row < ROWS; ++row) {
+    for(size_t loop = 0; loop < LOOPS; ++loop) {
+      interleaved_error[row][loop] = errorAt(loop, row);
+      sorted_error[row][fleet.offset(loop_kind[loop]) + loop_index[loop]] = interleaved_error[row][loop];
+    }
+  }
+}
+
+void perLoop(uint32_t iteration) {
+  ControlAlgorithms::Base::ControlInput input;
+  ControlAlgorithms::Base::ControlOutput output;
+  input.setDeltaT(DELTA_T);
+  const float *error = interleaved_error[iteration % ROWS];
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    input.setError(error[loop]);
+    switch(loop_kind[loop]) {
+      case KIND_PROPORTIONAL:
+        proportionals[loop_index[loop]].update(input, output);
+        break;
+      case KIND_INTEGRAL:
+        integrals[loop_index[loop]].update(input, output);
+        break;
+      case KIND_DERIVATIVE:
+        derivatives[loop_index[loop]].update(input, output);
+        break;
+      default:
+        bang_bangs[loop_index[loop]].update(input, output);
+        break;
+    }
+    interleaved_control[loop] = output.getControl();
+  }
+}
+
+void typeSorted(uint32_t iteration) {
+  // Samples arrive in the fleet's type sorted order
+  fleet.update(sorted_error[iteration % ROWS], sorted_delta_t);
+}
+
+void report(const char *name, const TimingStats &stats) {
+  char line[128];
+  snprintf(line, sizeof(line), "%-12s %8.2f %s per loop update (median of %lu loops)", name,
+           (double)stats.percentile(0.5f) / (double)LOOPS, ControlAlgorithms::Timing::CycleCounter::unit(),
+           (unsigned long)LOOPS);
+  printLine(line);
+}
+
+void runAll() {
+  for(size_t index = 0; index < PER_KIND; ++index) {
+    integrals[index].reset();
+    derivatives[index].reset();
+    bang_bangs[index].reset();
+  }
+  fleet.resetAll();
+
+  static TimingStats per_loop;
+  static TimingStats type_sorted;
+  per_loop.reset();
+  type_sorted.reset();
+  void (*per_loop_function)(uint32_t) = perLoop;
+  void (*type_sorted_function)(uint32_t) = typeSorted;
+  WcetHarness::measure(per_loop_function, SAMPLES, per_loop);
+  WcetHarness::measure(type_sorted_function, SAMPLES, type_sorted);
+  report("per loop", per_loop);
+  report("type sorted", type_sorted);
+
+  // Both saw the same samples, so every loop must have the same control signal
+  size_t mismatches = 0;
+  for(size_t loop = 0; loop < LOOPS; ++loop) {
+    size_t sorted = fleet.offset(loop_kind[loop]) + loop_index[loop];
+    mismatches += fleet.getControl(sorted) != interleaved_control[loop] ? 1 : 0;
+  }
+  char line[96];
+  snprintf(line, sizeof(line), "%lu of %lu control signals differ", (unsigned long)mismatches, (unsigned long)LOOPS);
+  printLine(line);
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+  setupFleet();
+}
+
+void loop() {
+  runAll();
+  delay(5000);
+}
+#else
+int main() {
+  setupFleet();
+  runAll();
+  return 0;
+}
+#endif
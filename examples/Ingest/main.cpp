@@ -0,0 +1,199 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Enqueue to dispatch latency of Ingest::SampleIngestor. Producer threads each own a set of loops and submit one
+ * timestamped sample per loop every period; the control thread dispatches into an integral bank as fast as it
+ * can. The latency of every sample, from its timestamp to the dispatch that drained it, goes into a TimingStats
+ * histogram, and p50/p99/p99.9/max are reported for a growing number of producers. The sample accounting is
+ * checked too: every submitted sample is dispatched, counted as a loop's first sample (which only starts its
+ * clock), stale, or dropped.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid sources, -I src and -pthread.
+ * On Arduino a single producer runs in loop() between dispatches.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <ingest/sampleIngestor.h>
+#include <pid/integralBank.h>
+#include <timing/timingStats.h>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <atomic>
+#include <chrono>
+#include <thread>
+#endif
+
+using ControlAlgorithms::Ingest::MonotonicClock;
+using ControlAlgorithms::Timing::TimingStats;
+
+#if defined(ARDUINO)
+const uint32_t LOOPS = 16;
+const uint32_t QUEUE_CAPACITY = 64;
+#else
+const uint32_t LOOPS = 256;
+const uint32_t QUEUE_CAPACITY = 4096;
+const uint32_t PRODUCER_COUNTS[] = {1, 2, 4, 8};
+const size_t PRODUCER_COUNT_COUNT = sizeof(PRODUCER_COUNTS) / sizeof(PRODUCER_COUNTS[0]);
+// Each producer submits a sample for each of its loops every period, this many times
+const uint32_t ROUNDS = 2000;
+const uint32_t PERIOD_US = 100;
+#endif
+const uint32_t MAX_BATCH = 64;
+
+typedef ControlAlgorithms::Ingest::SampleIngestor<LOOPS, QUEUE_CAPACITY, MAX_BATCH> Ingestor;
+Ingestor *ingestor;
+ControlAlgorithms::PID::IntegralBank<LOOPS> bank;
+TimingStats latency;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+// Error of a loop, the value does not matter for the latency
+float errorOf(uint32_t loop) {
+  return 0.001f * (float)loop;
+}
+
+void printResult(uint32_t producers, uint64_t submitted, uint64_t dispatched) {
+  char line[160];
+  uint64_t accounted = dispatched + ingestor->getStartCount() + ingestor->getStaleCount() + ingestor->getDroppedCount();
+  snprintf(line, sizeof(line), "%9lu %8lu %8lu %8lu %8lu %10lu %6lu %6lu %6lu %s", (unsigned long)producers,
+           (unsigned long)latency.percentile(0.5f), (unsigned long)latency.percentile(0.99f),
+           (unsigned long)latency.percentile(0.999f), (unsigned long)latency.getMax(), (unsigned long)dispatched,
+           (unsigned long)ingestor->getStartCount(), (unsigned long)ingestor->getStaleCount(),
+           (unsigned long)ingestor->getDroppedCount(), accounted == submitted ? "yes" : "NO");
+  printLine(line);
+}
+
+void printHeader() {
+  printLine("producers  p50 us   p99 us p99.9 us   max us dispatched starts  stale  drops  balanced");
+}
+
+#if defined(ARDUINO)
+uint32_t rounds = 0;
+uint64_t submitted = 0;
+uint64_t dispatched = 0;
+
+void setup() {
+  Serial.begin(115200);
+  while(!Serial) {}
+  static Ingestor instance;
+  ingestor = &instance;
+  ingestor->setLatencyStats(&latency);
+}
+
+void loop() {
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    ingestor->submit(loop, errorOf(loop));
+    ++submitted;
+  }
+  size_t count;
+  while((count = ingestor->dispatch(bank)) > 0) {
+    dispatched += count;
+  }
+  if(++rounds % 1000 == 0) {
+    printHeader();
+    printResult(1, submitted, dispatched);
+  }
+}
+#else
+void produce(uint32_t producer, uint32_t producers, std::atomic<uint64_t> *submitted) {
+  uint64_t count = 0;
+  std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+  for(uint32_t round = 0; round < ROUNDS; ++round) {
+    for(uint32_t loop = producer; loop < LOOPS; loop += producers) {
+      ingestor->submit(loop, errorOf(loop));
+      ++count;
+    }
+    next += std::chrono::microseconds(PERIOD_US);
+    std::this_thread::sleep_until(next);
+  }
+  submitted->fetch_add(count);
+}
+
+void run(uint32_t producers) {
+  static Ingestor instance;
+  ingestor = &instance;
+  // Each run starts every loop's clock again
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    ingestor->resetLoop(loop);
+  }
+  ingestor->resetStatistics();
+  latency.reset();
+  ingestor->setLatencyStats(&latency);
+
+  std::atomic<uint64_t> submitted(0);
+  std::atomic<uint32_t> running(producers);
+  std::thread threads[8];
+  for(uint32_t producer = 0; producer < producers; ++producer) {
+    threads[producer] = std::thread([producer, producers, &submitted, &running]() {
+      produce(producer, producers, &submitted);
+      running.fetch_sub(1);
+    });
+  }
+
+  uint64_t dispatched = 0;
+  for(;;) {
+    // Read before draining, so a queue found empty after the producers finished is really empty
+    bool finished = running.load() == 0;
+    size_t count = ingestor->dispatch(bank);
+    dispatched += count;
+    if(count == 0) {
+      if(finished) {
+        break;
+      }
+      std::this_thread::yield();
+    }
+  }
+  for(uint32_t producer = 0; producer < producers; ++producer) {
+    threads[producer].join();
+  }
+  printResult(producers, submitted.load(), dispatched);
+}
+
+int main(int argc, char **argv) {
+  char line[128];
+  snprintf(line, sizeof(line), "%lu loops, each sampled every %lu us, %lu rounds, dispatch batches of %lu",
+           (unsigned long)LOOPS, (unsigned long)PERIOD_US, (unsigned long)ROUNDS, (unsigned long)MAX_BATCH);
+  printLine(line);
+  printHeader();
+  if(argc > 1) {
+    uint32_t producers = (uint32_t)strtoul(argv[1], nullptr, 0);
+    run(producers < 1 ? 1 : (producers > 8 ? 8 : producers));
+    return 0;
+  }
+  for(size_t index = 0; index < PRODUCER_COUNT_COUNT; ++index) {
+    run(PRODUCER_COUNTS[index]);
+  }
+  return 0;
+}
+#endif
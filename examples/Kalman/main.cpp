@@ -0,0 +1,152 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Position control of a simulated mass from a noisy position sensor. A Kalman filter estimates position and
+ * velocity; its output is passed straight to the proportional controller as the input, and the velocity
+ * estimate adds damping. Prints the true and filtered position and the raw and filtered sensor error.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <estimate/kalman.h>
+#include <pid/proportionalStateless.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Base::ControlOutput;
+using ControlAlgorithms::Base::ControlSettings;
+using ControlAlgorithms::Estimate::Kalman;
+using ControlAlgorithms::Estimate::KalmanSettings;
+using ControlAlgorithms::PID::ProportionalStateless;
+
+const float DELTA_T = 0.001;
+const float SENSOR_NOISE = 0.05;
+const float DAMPING = 8.0;
+const uint32_t STEPS = 5000;
+const uint32_t REPORT_STEPS = 500;
+
+// Position and velocity, one position measurement, acceleration as the control input
+Kalman<2, 1, 1> filter;
+ControlSettings position_settings;
+ControlOutput position_output;
+
+float position;
+float velocity;
+float acceleration;
+uint32_t step;
+uint32_t noise_state = 2463534242u;
+float raw_error_sum;
+float filtered_error_sum;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+// Roughly normal noise from a sum of uniforms, repeatable on every target
+float noise() {
+  float sum = 0.0f;
+  for(int i = 0; i < 4; ++i) {
+    noise_state ^= noise_state << 13;
+    noise_state ^= noise_state >> 17;
+    noise_state ^= noise_state << 5;
+    sum += (float)(noise_state >> 8) * (1.0f / 16777216.0f);
+  }
+  return (sum - 2.0f) * 1.7320508f;
+}
+
+void configure() {
+  KalmanSettings<2, 1, 1> settings;
+  settings.getTransition()[0][0] = 1.0f;
+  settings.getTransition()[0][1] = DELTA_T;
+  settings.getTransition()[1][1] = 1.0f;
+  settings.getControl()[0][0] = 0.5f * DELTA_T * DELTA_T;
+  settings.getControl()[1][0] = DELTA_T;
+  settings.getMeasurement()[0][0] = 1.0f;
+  settings.getProcessNoise()[0][0] = 1.0e-8f;
+  settings.getProcessNoise()[1][1] = 1.0e-5f;
+  settings.getMeasurementNoise()[0][0] = SENSOR_NOISE * SENSOR_NOISE;
+  settings.setOutputState(0);
+  filter.setSettings(settings);
+  filter.setSetpoint(1.0f);
+
+  position_settings.setGain(16.0f);
+}
+
+// One control period: measure, filter, control, then advance the plant
+void tick() {
+  float measurement = position + SENSOR_NOISE * noise();
+  filter.update(&measurement, &acceleration, DELTA_T);
+
+  ProportionalStateless::update(filter.getOutput(), position_settings, position_output);
+  acceleration = position_output.getControl() - DAMPING * filter.getEstimate()[1];
+
+  position += velocity * DELTA_T + 0.5f * acceleration * DELTA_T * DELTA_T;
+  velocity += acceleration * DELTA_T;
+
+  float raw_error = measurement - position;
+  float filtered_error = filter.getEstimate()[0] - position;
+  raw_error_sum += raw_error * raw_error;
+  filtered_error_sum += filtered_error * filtered_error;
+
+  if(++step % REPORT_STEPS == 0) {
+    char line[128];
+    snprintf(line, sizeof(line), "t %.2f s: position %.4f, filtered %.4f, sensor rms %.4f, filtered rms %.4f",
+             step * DELTA_T, position, filter.getEstimate()[0], sqrtf(raw_error_sum / REPORT_STEPS),
+             sqrtf(filtered_error_sum / REPORT_STEPS));
+    printLine(line);
+    raw_error_sum = 0.0f;
+    filtered_error_sum = 0.0f;
+  }
+}
+
+#if defined(ARDUINO)
+void setup() {
+  Serial.begin(115200);
+  configure();
+}
+
+void loop() {
+  if(step < STEPS) {
+    tick();
+  }
+}
+#else
+int main() {
+  configure();
+  while(step < STEPS) {
+    tick();
+  }
+  return 0;
+}
+#endif
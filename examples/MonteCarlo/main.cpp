@@ -0,0 +1,168 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Monte Carlo robustness of a PI controller on a first order plus dead time plant whose gain, time constant and
+ * dead time are only known to within a range, with sensor noise. The same trials are run with a growing number of
+ * threads; the time of each run is reported along with whether its results match the single threaded run bit for
+ * bit. The overshoot, settling time and IAE distributions are printed at the end.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/analysis sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <analysis/monteCarlo.h>
+#include <ingest/monotonicClock.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Analysis::Distribution;
+using ControlAlgorithms::Analysis::MonteCarlo;
+using ControlAlgorithms::Analysis::MonteCarloSettings;
+using ControlAlgorithms::Analysis::MonteCarloSummary;
+using ControlAlgorithms::Analysis::MonteCarloTrial;
+using ControlAlgorithms::Ingest::MonotonicClock;
+
+#if defined(ARDUINO)
+const uint32_t TRIALS = 32;
+const uint32_t STEPS = 500;
+const uint32_t THREAD_COUNTS[] = {1};
+#else
+const uint32_t TRIALS = 10000;
+const uint32_t STEPS = 2000;
+const uint32_t THREAD_COUNTS[] = {1, 2, 4, 8, 0};
+#endif
+const size_t THREAD_COUNT_COUNT = sizeof(THREAD_COUNTS) / sizeof(THREAD_COUNTS[0]);
+
+MonteCarloTrial reference[TRIALS];
+MonteCarloTrial results[TRIALS];
+float scratch[TRIALS];
+
+ControlAlgorithms::Base::ControlSettings p_settings;
+ControlAlgorithms::PID::IntegralSettings i_settings;
+ControlAlgorithms::PID::DerivativeSettings d_settings;
+MonteCarloSettings settings;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void printDistribution(const char *name, const Distribution &distribution) {
+  char line[128];
+  snprintf(line, sizeof(line), "%-14s %6lu %9.4f %9.4f %9.4f %9.4f %9.4f %9.4f", name,
+           (unsigned long)distribution.getCount(), distribution.getMean(), distribution.getMin(),
+           distribution.getMedian(), distribution.getP90(), distribution.getP99(), distribution.getMax());
+  printLine(line);
+}
+
+void setupRun() {
+  // PI tuned for the middle of the plant range; the high gain, long dead time
+  // corner of the range is unstable
+  p_settings.setGain(0.8f);
+  i_settings.setGain(0.8f);
+  i_settings.setHasLimits(true);
+  i_settings.setMinLimit(-10.0f);
+  i_settings.setMaxLimit(10.0f);
+  d_settings.setGain(0.0f);
+
+  settings.setSeed(2026);
+  settings.setSteps(STEPS);
+  settings.setDeltaT(0.01f);
+  settings.setSetpoint(1.0f);
+  settings.setMinPlantGain(1.0f);
+  settings.setMaxPlantGain(4.0f);
+  settings.setMinTimeConstant(0.5f);
+  settings.setMaxTimeConstant(2.0f);
+  settings.setMinDeadTime(0);
+  settings.setMaxDeadTime(60);
+  settings.setMaxNoise(0.01f);
+}
+
+void runAll() {
+  char line[128];
+  snprintf(line, sizeof(line), "%lu trials of %lu steps", (unsigned long)TRIALS, (unsigned long)STEPS);
+  printLine(line);
+  printLine("threads   time ms  identical");
+  for(size_t run = 0; run < THREAD_COUNT_COUNT; ++run) {
+    uint32_t start = MonotonicClock::nowMicros();
+    uint32_t threads = MonteCarlo::run(settings, p_settings, i_settings, d_settings, results, TRIALS,
+                                       THREAD_COUNTS[run]);
+    uint32_t elapsed = MonotonicClock::nowMicros() - start;
+    if(run == 0) {
+      for(uint32_t trial = 0; trial < TRIALS; ++trial) {
+        reference[trial].copy(results[trial]);
+      }
+    }
+    // Compare the bits of every outcome
+    bool identical = true;
+    for(uint32_t trial = 0; trial < TRIALS; ++trial) {
+      const MonteCarloTrial &a = reference[trial];
+      const MonteCarloTrial &b = results[trial];
+      float left[] = {a.getPlantGain(), a.getTimeConstant(), a.getNoise(), a.getOvershoot(), a.getSettlingTime(), a.getIae()};
+      float right[] = {b.getPlantGain(), b.getTimeConstant(), b.getNoise(), b.getOvershoot(), b.getSettlingTime(), b.getIae()};
+      identical = identical && memcmp(left, right, sizeof(left)) == 0 && a.getDeadTime() == b.getDeadTime() &&
+                  a.getStable() == b.getStable() && a.getSettled() == b.getSettled() &&
+                  a.getDiverged() == b.getDiverged();
+    }
+    snprintf(line, sizeof(line), "%7lu %9.1f  %s", (unsigned long)threads, elapsed / 1000.0, identical ? "yes" : "NO");
+    printLine(line);
+  }
+
+  MonteCarloSummary summary;
+  MonteCarlo::summarize(results, TRIALS, scratch, summary);
+  snprintf(line, sizeof(line), "stable %lu, settled %lu, diverged %lu of %lu", (unsigned long)summary.getStable(),
+           (unsigned long)summary.getSettled(), (unsigned long)summary.getDiverged(), (unsigned long)summary.getTrials());
+  printLine(line);
+  printLine("               count      mean       min    median       p90       p99       max");
+  printDistribution("overshoot", summary.overshoot());
+  printDistribution("settling s", summary.settlingTime());
+  printDistribution("iae", summary.iae());
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+  setupRun();
+}
+
+void loop() {
+  runAll();
+  delay(5000);
+}
+#else
+int main() {
+  setupRun();
+  runAll();
+  return 0;
+}
+#endif
@@ -0,0 +1,183 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Cascaded position control of four axes with a multi-rate scheduler. The outer position loops run at 100 Hz
+ * and publish velocity setpoints through a hold buffer; the inner velocity loops and a simulated plant run at
+ * 10 kHz. Each group is updated as one bank batch, and the scheduler reports missed deadlines once a second.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <pid/proportionalBank.h>
+#include <schedule/bankTask.h>
+#include <schedule/holdBuffer.h>
+#include <schedule/multiRateScheduler.h>
+#include <stdio.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Ingest::MonotonicClock;
+using ControlAlgorithms::PID::ProportionalBank;
+using ControlAlgorithms::Schedule::BankTask;
+using ControlAlgorithms::Schedule::HoldBuffer;
+using ControlAlgorithms::Schedule::MultiRateScheduler;
+
+const size_t AXES = 4;
+const uint8_t INNER = 0;
+const uint8_t OUTER = 1;
+const uint32_t INNER_PERIOD_US = 100;
+const uint32_t OUTER_PERIOD_US = 10000;
+const uint32_t REPORT_PERIOD_US = 1000000;
+
+struct Setpoints {
+  float velocity[AXES];
+};
+
+MultiRateScheduler<2, 3> scheduler;
+HoldBuffer<Setpoints> velocity_setpoints;
+
+// Outer position loops
+const float target_position[AXES] = {1.0, -2.0, 0.5, 3.0};
+float position_error[AXES];
+ProportionalBank<AXES> position_bank;
+BankTask<ProportionalBank<AXES>, AXES> position_task(position_bank, position_error);
+
+// Inner velocity loops
+float velocity_error[AXES];
+ProportionalBank<AXES> velocity_bank;
+BankTask<ProportionalBank<AXES>, AXES> velocity_task(velocity_bank, velocity_error);
+
+// Simulated plant: the inner loop's output is an acceleration
+float position[AXES];
+float velocity[AXES];
+
+uint32_t last_report_us;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void computePositionError(void *, float) {
+  for(size_t axis = 0; axis < AXES; ++axis) {
+    position_error[axis] = target_position[axis] - position[axis];
+  }
+}
+
+void publishVelocitySetpoints(void *, float) {
+  Setpoints &setpoints = velocity_setpoints.write();
+  for(size_t axis = 0; axis < AXES; ++axis) {
+    setpoints.velocity[axis] = position_bank.getControl(axis);
+  }
+  velocity_setpoints.publish();
+}
+
+void computeVelocityError(void *, float) {
+  const Setpoints &setpoints = velocity_setpoints.read();
+  for(size_t axis = 0; axis < AXES; ++axis) {
+    velocity_error[axis] = setpoints.velocity[axis] - velocity[axis];
+  }
+}
+
+void stepPlant(void *, float delta_t) {
+  for(size_t axis = 0; axis < AXES; ++axis) {
+    velocity[axis] += velocity_bank.getControl(axis) * delta_t;
+    position[axis] += velocity[axis] * delta_t;
+  }
+}
+
+void report() {
+  char line[128];
+  for(uint8_t group = 0; group < scheduler.getGroupCount(); ++group) {
+    snprintf(line, sizeof(line), "%s: %lu runs, %lu missed, max lateness %lu us",
+             group == INNER ? "inner" : "outer",
+             (unsigned long)scheduler.getGroup(group).getRuns(),
+             (unsigned long)scheduler.getGroup(group).getMissedDeadlines(),
+             (unsigned long)scheduler.getGroup(group).getMaxLatenessMicros());
+    printLine(line);
+  }
+  snprintf(line, sizeof(line), "position: %.3f %.3f %.3f %.3f",
+           position[0], position[1], position[2], position[3]);
+  printLine(line);
+  scheduler.resetStatistics();
+}
+
+void configure() {
+  ControlAlgorithms::Base::ControlSettings settings;
+  for(size_t axis = 0; axis < AXES; ++axis) {
+    settings.setGain(2.0);
+    position_bank.setSettings(axis, settings);
+    settings.setGain(50.0);
+    velocity_bank.setSettings(axis, settings);
+  }
+
+  scheduler.setPeriodMicros(INNER, INNER_PERIOD_US);
+  scheduler.addTask(INNER, computeVelocityError, nullptr);
+  scheduler.addTask(INNER, &BankTask<ProportionalBank<AXES>, AXES>::run, &velocity_task);
+  scheduler.addTask(INNER, stepPlant, nullptr);
+
+  scheduler.setPeriodMicros(OUTER, OUTER_PERIOD_US);
+  scheduler.addTask(OUTER, computePositionError, nullptr);
+  scheduler.addTask(OUTER, &BankTask<ProportionalBank<AXES>, AXES>::run, &position_task);
+  scheduler.addTask(OUTER, publishVelocitySetpoints, nullptr);
+
+  scheduler.start();
+  last_report_us = MonotonicClock::nowMicros();
+}
+
+// Poll the scheduler and report once a second
+void tick() {
+  scheduler.poll();
+  uint32_t now = MonotonicClock::nowMicros();
+  if(now - last_report_us >= REPORT_PERIOD_US) {
+    last_report_us += REPORT_PERIOD_US;
+    report();
+  }
+}
+
+#if defined(ARDUINO)
+void setup() {
+  Serial.begin(115200);
+  configure();
+}
+
+void loop() {
+  tick();
+}
+#else
+int main() {
+  configure();
+  uint32_t start = MonotonicClock::nowMicros();
+  while(MonotonicClock::nowMicros() - start < 3 * REPORT_PERIOD_US + REPORT_PERIOD_US / 2) {
+    tick();
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,232 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Hardware counters for the src/pid kernels. Each kernel runs over a range of batch sizes and the counts are
+ * reported per controller update: cycles, instructions per cycle, L1D and LLC read misses, branch misses and, on
+ * Intel, vector instructions. The batch kernels work on structure of arrays; the stateless kernels update arrays
+ * of IntegralOutput/DerivativeOutput objects, so their rows move with the layout of those classes. Where the
+ * counters cannot be opened (not Linux, no PMU, perf_event_paranoid) only the cycle counter column is filled.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid and src/timing sources and
+ * -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <pid/proportionalBatch.h>
+#include <pid/integralBatch.h>
+#include <pid/derivativeBatch.h>
+#include <pid/integralStateless.h>
+#include <pid/derivativeStateless.h>
+#include <timing/wcetHarness.h>
+#include <stdio.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Timing::CycleCounter;
+using ControlAlgorithms::Timing::PerfCounters;
+using ControlAlgorithms::Timing::PerfSample;
+using ControlAlgorithms::Timing::WcetHarness;
+
+#if defined(ARDUINO)
+const size_t MAX_BATCH = 64;
+const size_t BATCH_SIZES[] = {1, 16, 64};
+const uint32_t UPDATES = 8192;
+#else
+const size_t MAX_BATCH = 65536;
+const size_t BATCH_SIZES[] = {1, 16, 256, 4096, 65536};
+const uint32_t UPDATES = 1 << 22;
+#endif
+const size_t BATCH_SIZE_COUNT = sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0]);
+const float DELTA_T = 0.001f;
+
+// Structure of arrays
+float error[MAX_BATCH];
+float delta_t[MAX_BATCH];
+float gain[MAX_BATCH];
+uint8_t has_limits[MAX_BATCH];
+float min_limit[MAX_BATCH];
+float max_limit[MAX_BATCH];
+float min_time_step[MAX_BATCH];
+float integrated_error[MAX_BATCH];
+float previous_error[MAX_BATCH];
+float control[MAX_BATCH];
+
+// Arrays of objects for the stateless kernels
+ControlAlgorithms::PID::IntegralSettings i_settings;
+ControlAlgorithms::PID::DerivativeSettings d_settings;
+ControlAlgorithms::PID::IntegralInput input_i;
+ControlAlgorithms::PID::DerivativeInput input_d;
+ControlAlgorithms::PID::IntegralOutput outputs_i[MAX_BATCH];
+ControlAlgorithms::PID::DerivativeOutput outputs_d[MAX_BATCH];
+
+// Loops updated per call
+size_t batch = 1;
+
+void proportionalBatch(uint32_t) {
+  ControlAlgorithms::PID::ProportionalBatch::update(error, gain, control, batch);
+}
+
+void integralBatch(uint32_t) {
+  ControlAlgorithms::PID::IntegralBatch::update(error, delta_t, gain, has_limits, min_limit, max_limit,
+                                                integrated_error, control, batch);
+}
+
+void derivativeBatch(uint32_t) {
+  ControlAlgorithms::PID::DerivativeBatch::update(error, delta_t, gain, min_time_step, previous_error, control, batch);
+}
+
+void integralStateless(uint32_t) {
+  for(size_t loop = 0; loop < batch; ++loop) {
+    input_i.setError(error[loop]);
+    input_i.setDeltaT(delta_t[loop]);
+    input_i.setAccumulator(outputs_i[loop].getAccumulator());
+    ControlAlgorithms::PID::IntegralStateless::update(input_i, i_settings, outputs_i[loop]);
+  }
+}
+
+void derivativeStateless(uint32_t) {
+  for(size_t loop = 0; loop < batch; ++loop) {
+    input_d.setError(error[loop]);
+    input_d.setDeltaT(delta_t[loop]);
+    input_d.setPreviousError(outputs_d[loop].getPreviousError());
+    ControlAlgorithms::PID::DerivativeStateless::update(input_d, d_settings, outputs_d[loop]);
+  }
+}
+
+struct Kernel {
+  const char *name;
+  void (*function)(uint32_t);
+};
+
+const Kernel kernels[] = {
+  {"proportional batch", proportionalBatch},
+  {"integral batch", integralBatch},
+  {"derivative batch", derivativeBatch},
+  {"integral stateless", integralStateless},
+  {"derivative stateless", derivativeStateless},
+};
+
+PerfCounters counters;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+// Append one column, or a dash when the counter is unavailable
+size_t column(char *line, size_t used, size_t size, const PerfSample &sample, uint8_t counter, double value) {
+  int written = sample.isValid(counter) ? snprintf(line + used, size - used, " %9.3f", value)
+                                        : snprintf(line + used, size - used, " %9s", "-");
+  return written > 0 && used + (size_t)written < size ? used + (size_t)written : size - 1;
+}
+
+void setupData() {
+  for(size_t loop = 0; loop < MAX_BATCH; ++loop) {
+    error[loop] = (float)((int)(loop % 31) - 15) * 0.1f;
+    delta_t[loop] = DELTA_T;
+    gain[loop] = 0.5f;
+    has_limits[loop] = (uint8_t)(loop % 2);
+    min_limit[loop] = -10.0f;
+    max_limit[loop] = 10.0f;
+    min_time_step[loop] = 0.0000001f;
+    integrated_error[loop] = 0.0f;
+    previous_error[loop] = 0.0f;
+  }
+  i_settings.setGain(0.5f);
+  i_settings.setHasLimits(true);
+  i_settings.setMinLimit(-10.0f);
+  i_settings.setMaxLimit(10.0f);
+  d_settings.setGain(0.5f);
+  d_settings.setMinTimeStep(0.0000001f);
+}
+
+void runAll() {
+  char line[160];
+  uint64_t vector_event = 0;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(ARDUINO)
+  if(__builtin_cpu_is("intel")) {
+    vector_event = ControlAlgorithms::Timing::PERF_VECTOR_EVENT_INTEL;
+  }
+#endif
+  if(!counters.isOpen() && !counters.open(vector_event)) {
+    printLine("performance counters unavailable, reporting the cycle counter only");
+  }
+  // The first column is the CycleCounter, the others the performance counters; all but IPC are per update
+  snprintf(line, sizeof(line), "%-20s %6s %9s %9s %9s %9s %9s %9s %9s", "kernel", "batch", CycleCounter::unit(),
+           "PMU cyc", "IPC", "L1D miss", "LLC miss", "br miss", "vector");
+  printLine(line);
+
+  for(const Kernel &kernel : kernels) {
+    for(size_t size = 0; size < BATCH_SIZE_COUNT; ++size) {
+      batch = BATCH_SIZES[size];
+      uint32_t iterations = UPDATES / (uint32_t)batch;
+      void (*function)(uint32_t) = kernel.function;
+      PerfSample sample;
+      uint32_t start = CycleCounter::now();
+      WcetHarness::count(function, iterations, counters, sample);
+      uint32_t elapsed = CycleCounter::now() - start;
+      // count makes one warm-up call before the counted ones
+      elapsed -= elapsed / (iterations + 1);
+      uint64_t updates = (uint64_t)iterations * batch;
+
+      size_t used = (size_t)snprintf(line, sizeof(line), "%-20s %6lu %9.3f", kernel.name, (unsigned long)batch,
+                                     (double)elapsed / (double)updates);
+      using namespace ControlAlgorithms::Timing;
+      used = column(line, used, sizeof(line), sample, PERF_CYCLES, sample.per(PERF_CYCLES, updates));
+      double ipc = sample.isValid(PERF_INSTRUCTIONS) ? sample.per(PERF_INSTRUCTIONS, sample.get(PERF_CYCLES)) : 0.0;
+      used = column(line, used, sizeof(line), sample, PERF_INSTRUCTIONS, ipc);
+      used = column(line, used, sizeof(line), sample, PERF_L1D_MISSES, sample.per(PERF_L1D_MISSES, updates));
+      used = column(line, used, sizeof(line), sample, PERF_LLC_MISSES, sample.per(PERF_LLC_MISSES, updates));
+      used = column(line, used, sizeof(line), sample, PERF_BRANCH_MISSES, sample.per(PERF_BRANCH_MISSES, updates));
+      column(line, used, sizeof(line), sample, PERF_VECTOR_INSTRUCTIONS,
+             sample.per(PERF_VECTOR_INSTRUCTIONS, updates));
+      printLine(line);
+    }
+  }
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+  setupData();
+}
+
+void loop() {
+  runAll();
+  delay(5000);
+}
+#else
+int main() {
+  setupData();
+  runAll();
+  return 0;
+}
+#endif
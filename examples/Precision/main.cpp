@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Throughput and accuracy of the integral numeric policies. Each policy integrates a small constant error onto a
+ * large integrated error, which is where a float sum stops moving, and reports the time per update and the
+ * drift from the exact result.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <pid/integralStateless.h>
+#include <Arduino.h>
+
+const uint32_t UPDATES = 100000;
+const float START = 1000.0f;
+const float ERROR_VALUE = 0.01f;
+const float DELTA_T = 0.001f;
+
+template<typename Policy>
+void runPolicy(const char *name) {
+  ControlAlgorithms::PID::IntegralInputT<Policy> input;
+  ControlAlgorithms::PID::IntegralOutputT<Policy> output;
+  ControlAlgorithms::PID::IntegralSettings settings;
+  settings.setGain(1.0);
+  output.setIntegratedError(START);
+  input.setError(ERROR_VALUE);
+  input.setDeltaT(DELTA_T);
+
+  uint32_t usStart = micros();
+  for(uint32_t i = 0; i < UPDATES; ++i) {
+    input.setAccumulator(output.getAccumulator());
+    ControlAlgorithms::PID::IntegralStatelessT<Policy>::update(input, settings, output);
+  }
+  uint32_t usElapsed = micros() - usStart;
+
+  double expected = (double)START + (double)UPDATES * (double)ERROR_VALUE * (double)DELTA_T;
+  Serial.print(name);
+  Serial.print(": ns/update ");
+  Serial.print((float)usElapsed * 1000.0f / (float)UPDATES);
+  Serial.print(", drift ");
+  Serial.println((float)((double)output.getIntegratedError() - expected), 6);
+}
+
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+}
+
+void loop() {
+  runPolicy<ControlAlgorithms::Base::FloatPolicy>("Float");
+  runPolicy<ControlAlgorithms::Base::DoublePolicy>("Double");
+  runPolicy<ControlAlgorithms::Base::KahanPolicy>("Kahan");
+
+  delay(5000);
+}
@@ -0,0 +1,243 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Relay feedback autotuning of a simulated first order plus dead time plant. The relay runs, stateless and
+ * stateful side by side, until isComplete(); the ultimate gain and period are then compared with the exact values
+ * of the plant, within the bias expected of the describing function (see PID::RelayAutotune). Both tuning rules
+ * are applied and each tuned PID loop must settle a setpoint step.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid sources and -I src.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <pid/relayAutotune.h>
+#include <pid/proportionalStateless.h>
+#include <pid/integral.h>
+#include <pid/derivative.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Base::ControlInput;
+using ControlAlgorithms::Base::ControlOutput;
+using ControlAlgorithms::Base::ControlSettings;
+using ControlAlgorithms::PID::Derivative;
+using ControlAlgorithms::PID::DerivativeSettings;
+using ControlAlgorithms::PID::Integral;
+using ControlAlgorithms::PID::IntegralSettings;
+using ControlAlgorithms::PID::ProportionalStateless;
+using ControlAlgorithms::PID::RelayAutotune;
+using ControlAlgorithms::PID::RelayAutotuneInput;
+using ControlAlgorithms::PID::RelayAutotuneOutput;
+using ControlAlgorithms::PID::RelayAutotuneSettings;
+using ControlAlgorithms::PID::RelayAutotuneStateless;
+
+// Plant: gain, time constant and dead time
+const float PLANT_GAIN = 1.0f;
+const float TIME_CONSTANT = 1.0f;
+const float DELTA_T = 0.001f;
+const uint32_t DEAD_TIME_STEPS = 200;
+const uint32_t MAX_TUNING_STEPS = 30000;
+const uint32_t STEP_RESPONSE_STEPS = 20000;
+
+// The describing function reads the ultimate gain low on this plant, about 0.8 of the exact value, and the
+// period within a few percent (see PID::RelayAutotune::getUltimateGain)
+const float MIN_GAIN_RATIO = 0.7f;
+const float MAX_GAIN_RATIO = 1.0f;
+const float PERIOD_TOLERANCE = 0.05f;
+// Setpoint error allowed at the end of the step response
+const float SETTLED_ERROR = 0.01f;
+
+// Plant state and the dead time line
+float output;
+float delayed[DEAD_TIME_STEPS];
+uint32_t delay_index;
+uint32_t failures;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void check(bool passed, const char *what) {
+  if(!passed) {
+    char line[96];
+    snprintf(line, sizeof(line), "FAILED: %s", what);
+    printLine(line);
+    ++failures;
+  }
+}
+
+void resetPlant() {
+  output = 0.0f;
+  for(uint32_t i = 0; i < DEAD_TIME_STEPS; ++i) {
+    delayed[i] = 0.0f;
+  }
+  delay_index = 0;
+}
+
+// Advance the plant by one step with the exact discretization of the lag
+float stepPlant(float control) {
+  float applied = delayed[delay_index];
+  delayed[delay_index] = control;
+  delay_index = (delay_index + 1) % DEAD_TIME_STEPS;
+  float decay = expf(-DELTA_T / TIME_CONSTANT);
+  output = decay * output + (1.0f - decay) * PLANT_GAIN * applied;
+  return output;
+}
+
+// Exact ultimate point: the frequency where the lag and dead time reach -180 degrees, found by bisection
+void ultimatePoint(double &ultimate_gain, double &ultimate_period) {
+  double dead_time = DEAD_TIME_STEPS * (double)DELTA_T;
+  double low = 0.0;
+  double high = 3.14159265358979 / dead_time;
+  for(int i = 0; i < 60; ++i) {
+    double middle = 0.5 * (low + high);
+    if(atan(middle * TIME_CONSTANT) + middle * dead_time < 3.14159265358979) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  double frequency = 0.5 * (low + high);
+  ultimate_gain = sqrt(1.0 + frequency * TIME_CONSTANT * frequency * TIME_CONSTANT) / PLANT_GAIN;
+  ultimate_period = 2.0 * 3.14159265358979 / frequency;
+}
+
+// Step response of the tuned PID loop; returns the setpoint error at the end
+float stepResponse(const ControlSettings &p_settings, const IntegralSettings &i_settings,
+                   const DerivativeSettings &d_settings) {
+  resetPlant();
+  Integral integral;
+  integral.setSettings(i_settings);
+  Derivative derivative;
+  derivative.setSettings(d_settings);
+  ControlInput input;
+  input.setDeltaT(DELTA_T);
+  ControlOutput p_output;
+  ControlOutput i_output;
+  ControlOutput d_output;
+  float error = 1.0f;
+  for(uint32_t step = 0; step < STEP_RESPONSE_STEPS; ++step) {
+    input.setError(error);
+    ProportionalStateless::update(input, p_settings, p_output);
+    integral.update(input, i_output);
+    derivative.update(input, d_output);
+    error = 1.0f - stepPlant(p_output.getControl() + i_output.getControl() + d_output.getControl());
+  }
+  return error;
+}
+
+void runAll() {
+  char line[128];
+  RelayAutotuneSettings settings;
+  settings.setAmplitude(1.0f);
+  RelayAutotune relay;
+  relay.setSettings(settings);
+  RelayAutotuneOutput reference;
+  resetPlant();
+
+  ControlSettings p_settings;
+  IntegralSettings i_settings;
+  DerivativeSettings d_settings;
+  check(!relay.getTunedSettings(ControlAlgorithms::PID::TUNING_ZIEGLER_NICHOLS, p_settings, i_settings, d_settings),
+        "no settings before complete");
+
+  // The setpoint is zero, so the error is minus the output
+  uint32_t step = 0;
+  ControlInput input;
+  input.setDeltaT(DELTA_T);
+  ControlOutput relay_output;
+  input.setError(0.0f);
+  while(!relay.isComplete() && step < MAX_TUNING_STEPS) {
+    RelayAutotuneInput stateless_input;
+    stateless_input.setError(input.getError());
+    stateless_input.setDeltaT(DELTA_T);
+    stateless_input.setState(reference.getState());
+    RelayAutotuneStateless::update(stateless_input, settings, reference);
+    relay.update(input, relay_output);
+    check(relay_output.getControl() == reference.getControl() && relay.isComplete() == reference.getComplete(),
+          "stateful matches stateless");
+    input.setError(-stepPlant(relay_output.getControl()));
+    ++step;
+  }
+  check(relay.isComplete(), "complete");
+
+  double ultimate_gain;
+  double ultimate_period;
+  ultimatePoint(ultimate_gain, ultimate_period);
+  double gain_ratio = relay.getUltimateGain() / ultimate_gain;
+  snprintf(line, sizeof(line), "complete after %.2f s: Ku %.3f (exact %.3f, ratio %.3f), Pu %.4f s (exact %.4f s)",
+           step * DELTA_T, relay.getUltimateGain(), ultimate_gain, gain_ratio, relay.getUltimatePeriod(),
+           ultimate_period);
+  printLine(line);
+  check(gain_ratio >= MIN_GAIN_RATIO && gain_ratio <= MAX_GAIN_RATIO, "ultimate gain within the expected bias");
+  check(fabs(relay.getUltimatePeriod() - ultimate_period) <= PERIOD_TOLERANCE * ultimate_period, "ultimate period");
+
+  // Each rule's gains follow from Ku and Pu, and must settle the loop
+  const uint8_t rules[2] = {ControlAlgorithms::PID::TUNING_ZIEGLER_NICHOLS,
+                            ControlAlgorithms::PID::TUNING_TYREUS_LUYBEN};
+  const char *names[2] = {"Ziegler-Nichols", "Tyreus-Luyben"};
+  const float gain_factors[2] = {0.6f, 1.0f / 2.2f};
+  const float integral_times[2] = {0.5f, 2.2f};
+  const float derivative_times[2] = {0.125f, 1.0f / 6.3f};
+  for(size_t rule = 0; rule < 2; ++rule) {
+    check(relay.getTunedSettings(rules[rule], p_settings, i_settings, d_settings), "tuned settings");
+    float gain = gain_factors[rule] * relay.getUltimateGain();
+    float period = relay.getUltimatePeriod();
+    check(fabsf(p_settings.getGain() - gain) <= 1.0e-5f * gain, "proportional gain");
+    check(fabsf(i_settings.getGain() - gain / (integral_times[rule] * period)) <= 1.0e-5f * i_settings.getGain(),
+          "integral gain");
+    check(fabsf(d_settings.getGain() - gain * derivative_times[rule] * period) <= 1.0e-5f * d_settings.getGain(),
+          "derivative gain");
+    float error = stepResponse(p_settings, i_settings, d_settings);
+    snprintf(line, sizeof(line), "%-16s Kp %.3f, Ki %.3f, Kd %.4f, error after %.0f s: %.5f", names[rule],
+             p_settings.getGain(), i_settings.getGain(), d_settings.getGain(), STEP_RESPONSE_STEPS * DELTA_T, error);
+    printLine(line);
+    check(fabsf(error) <= SETTLED_ERROR, "tuned loop settles");
+  }
+  printLine(failures == 0 ? "passed" : "FAILED");
+}
+
+#if defined(ARDUINO)
+void setup() {
+  Serial.begin(115200);
+  runAll();
+}
+
+void loop() {
+}
+#else
+int main() {
+  runAll();
+  return failures == 0 ? 0 : 1;
+}
+#endif
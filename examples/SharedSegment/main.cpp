@@ -0,0 +1,252 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Sequence lock checks of Monitor::BankSegment. A writer thread updates proportional, integral and derivative
+ * banks with the same error in every loop and publishes them into a POSIX shared memory segment; reader threads
+ * map the segment again, read only, as a monitoring process would, and read it in place. Every read that
+ * validateRead accepts must be a single publish: each section holds one value across all loops, and the
+ * proportional control and previous error equal the publish count seen by beginRead. Reads rejected because a
+ * publish overlapped them are counted and retried. A copy of the header with another version, byte order or size
+ * must be refused by attach.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/monitor and src/pid sources,
+ * -I src and -pthread. On Arduino, where there is no shared memory and no second thread, the segment is a static
+ * buffer and each publish is read back in loop().
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <monitor/bankSegment.h>
+#include <monitor/sharedSegment.h>
+#include <pid/proportionalBank.h>
+#include <pid/integralBank.h>
+#include <pid/derivativeBank.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <atomic>
+#include <thread>
+#endif
+
+using ControlAlgorithms::Monitor::BankSegment;
+using ControlAlgorithms::Monitor::BankSegmentHeader;
+using ControlAlgorithms::Monitor::SharedSegment;
+
+// Segment sizes are a header plus one 64 byte aligned section per field; the buffers allow for more
+#if defined(ARDUINO)
+const uint32_t LOOPS = 16;
+const size_t BUFFER_SIZE = 1024;
+#else
+const uint32_t LOOPS = 256;
+const size_t BUFFER_SIZE = 8192;
+const uint32_t PUBLISHES = 200000;
+const uint32_t READERS = 2;
+const char *SEGMENT_NAME = "/controlalgorithms_example_segment";
+#endif
+
+ControlAlgorithms::PID::ProportionalBank<LOOPS> proportional;
+ControlAlgorithms::PID::IntegralBank<LOOPS> integral;
+ControlAlgorithms::PID::DerivativeBank<LOOPS> derivative;
+alignas(64) uint8_t copy[BUFFER_SIZE];
+float errors[LOOPS];
+float delta_ts[LOOPS];
+uint32_t failures;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void check(bool passed, const char *what) {
+  if(!passed) {
+    char line[96];
+    snprintf(line, sizeof(line), "FAILED: %s", what);
+    printLine(line);
+    ++failures;
+  }
+}
+
+// Unit proportional gain, so the control equals the error
+void configure() {
+  ControlAlgorithms::Base::ControlSettings settings;
+  settings.setGain(1.0f);
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    proportional.setSettings(loop, settings);
+  }
+}
+
+// Publish n carries error n in every loop, so its proportional control and previous error are both n
+void publishNext(BankSegment &writer, uint32_t publish) {
+  for(uint32_t loop = 0; loop < LOOPS; ++loop) {
+    errors[loop] = (float)publish;
+    delta_ts[loop] = 1.0f;
+  }
+  proportional.update(errors, delta_ts, LOOPS);
+  integral.update(errors, delta_ts, LOOPS);
+  derivative.update(errors, delta_ts, LOOPS);
+  writer.publish(proportional, integral, derivative);
+}
+
+// One read in place; returns false if a publish overlapped it and it must be retried. A consistent read that
+// does not match a single publish counts as torn.
+bool readOnce(const BankSegment &reader, uint32_t &torn) {
+  uint32_t sequence = reader.beginRead();
+  float expected = (float)(sequence >> 1);
+  const float *control = reader.getFloatSection(ControlAlgorithms::Monitor::SEGMENT_PROPORTIONAL_CONTROL);
+  const float *integrated = reader.getFloatSection(ControlAlgorithms::Monitor::SEGMENT_INTEGRATED_ERROR);
+  const float *previous = reader.getFloatSection(ControlAlgorithms::Monitor::SEGMENT_PREVIOUS_ERROR);
+  bool consistent = true;
+  for(uint32_t loop = 0; loop < reader.getLoops(); ++loop) {
+    consistent = consistent && control[loop] == expected && previous[loop] == expected &&
+                 integrated[loop] == integrated[0];
+  }
+  if(!reader.validateRead(sequence)) {
+    return false;
+  }
+  if(!consistent) {
+    ++torn;
+  }
+  return true;
+}
+
+// attach must refuse a segment from another layout version, byte order or larger than the mapping
+void checkAttach(const void *segment, size_t size) {
+  BankSegment reader;
+  check(reader.attach(segment, size), "attach");
+  check(!reader.attach(segment, size - 1), "attach to a short mapping");
+  if(size > BUFFER_SIZE) {
+    check(false, "segment fits the buffer");
+    return;
+  }
+
+  memcpy(copy, segment, size);
+  check(reader.attach(copy, size), "attach to a copy");
+  BankSegmentHeader *header = reinterpret_cast<BankSegmentHeader *>(copy);
+  header->version = BankSegment::BANK_SEGMENT_VERSION + 1;
+  check(!reader.attach(copy, size), "attach to another version");
+  memcpy(copy, segment, size);
+  header->byte_order = 0x04030201;
+  check(!reader.attach(copy, size), "attach to another byte order");
+  memcpy(copy, segment, size);
+  header->magic = 0;
+  check(!reader.attach(copy, size), "attach without the magic");
+}
+
+#if defined(ARDUINO)
+alignas(64) uint8_t buffer[BUFFER_SIZE];
+BankSegment writer;
+BankSegment reader;
+uint32_t publish;
+uint32_t torn;
+
+void setup() {
+  Serial.begin(115200);
+  while(!Serial) {}
+  configure();
+  check(writer.format(buffer, sizeof(buffer), LOOPS), "format");
+  checkAttach(buffer, BankSegment::segmentSize(LOOPS));
+  reader.attach(buffer, BankSegment::segmentSize(LOOPS));
+}
+
+void loop() {
+  publishNext(writer, ++publish);
+  check(readOnce(reader, torn) && torn == 0, "read back");
+  if(publish % 1000 == 0) {
+    char line[96];
+    snprintf(line, sizeof(line), "%lu publishes, %lu failures", (unsigned long)publish, (unsigned long)failures);
+    printLine(line);
+  }
+}
+#else
+int main() {
+  configure();
+  size_t size = BankSegment::segmentSize(LOOPS);
+  SharedSegment shared;
+  if(!shared.create(SEGMENT_NAME, size)) {
+    printLine("FAILED: no POSIX shared memory");
+    return 1;
+  }
+  BankSegment writer;
+  check(writer.format(shared.getData(), shared.getSize(), LOOPS), "format");
+
+  // The readers' own read only mapping, as a second process would have
+  SharedSegment mapping;
+  check(mapping.open(SEGMENT_NAME, false), "open read only");
+  checkAttach(mapping.getData(), mapping.getSize());
+
+  std::atomic<bool> running(true);
+  std::atomic<uint64_t> reads(0);
+  std::atomic<uint64_t> retries(0);
+  std::atomic<uint32_t> torn(0);
+  std::thread readers[READERS];
+  for(uint32_t index = 0; index < READERS; ++index) {
+    readers[index] = std::thread([&mapping, &running, &reads, &retries, &torn]() {
+      BankSegment reader;
+      reader.attach(mapping.getData(), mapping.getSize());
+      uint64_t accepted = 0;
+      uint64_t rejected = 0;
+      uint32_t inconsistent = 0;
+      while(running.load(std::memory_order_relaxed)) {
+        if(readOnce(reader, inconsistent)) {
+          ++accepted;
+        } else {
+          ++rejected;
+        }
+      }
+      reads.fetch_add(accepted);
+      retries.fetch_add(rejected);
+      torn.fetch_add(inconsistent);
+    });
+  }
+
+  for(uint32_t publish = 1; publish <= PUBLISHES; ++publish) {
+    publishNext(writer, publish);
+  }
+  running.store(false);
+  for(uint32_t index = 0; index < READERS; ++index) {
+    readers[index].join();
+  }
+
+  BankSegment reader;
+  reader.attach(mapping.getData(), mapping.getSize());
+  check(reader.getPublishCount() == PUBLISHES, "publish count");
+  check(torn.load() == 0, "no torn reads accepted");
+  char line[128];
+  snprintf(line, sizeof(line), "%lu publishes of %lu loops, %llu reads accepted, %llu retried, %lu torn",
+           (unsigned long)PUBLISHES, (unsigned long)LOOPS, (unsigned long long)reads.load(),
+           (unsigned long long)retries.load(), (unsigned long)torn.load());
+  printLine(line);
+
+  mapping.close();
+  shared.close();
+  SharedSegment::unlink(SEGMENT_NAME);
+  printLine(failures == 0 ? "passed" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
+#endif
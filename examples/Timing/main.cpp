@@ -0,0 +1,184 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Worst case execution time of Integral::update plus Derivative::update. Each input class runs with warm and
+ * cold caches and reports the maximum, p99.99 and jitter of the combined update in CycleCounter units. Input
+ * classes whose warm timing differs from the nominal class are flagged as data dependent.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <pid/integral.h>
+#include <pid/derivative.h>
+#include <timing/wcetHarness.h>
+#include <stdio.h>
+#include <math.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Timing::TimingStats;
+using ControlAlgorithms::Timing::WcetHarness;
+
+#if defined(ARDUINO)
+const uint32_t ITERATIONS = 20000;
+const uint32_t COLD_ITERATIONS = 2000;
+const size_t EVICTION_SIZE = 64 * 1024;
+#else
+const uint32_t ITERATIONS = 500000;
+const uint32_t COLD_ITERATIONS = 100;
+const size_t EVICTION_SIZE = 8 * 1024 * 1024;
+#endif
+static uint8_t eviction_buffer[EVICTION_SIZE];
+
+ControlAlgorithms::PID::Integral control_i;
+ControlAlgorithms::PID::Derivative control_d;
+ControlAlgorithms::Base::ControlInput input;
+ControlAlgorithms::Base::ControlOutput output;
+
+// Relative and absolute differences tolerated before timing is called data dependent
+const float TOLERANCE = 0.1f;
+const uint32_t SLACK = 8;
+
+// The input classes
+const uint8_t CASE_NOMINAL = 0;
+const uint8_t CASE_CLAMP = 1;
+const uint8_t CASE_MIN_TIME_STEP = 2;
+const uint8_t CASE_SUBNORMAL = 3;
+const uint8_t CASE_NOT_FINITE = 4;
+const uint8_t CASE_HARDENED_FAULT = 5;
+const uint8_t CASES = 6;
+const char *case_names[CASES] = {"nominal", "clamp hit", "min time step", "subnormal error", "non-finite error", "hardened fault"};
+
+// Varied but bounded errors for the nominal class
+const uint8_t ERRORS = 16;
+const float errors[ERRORS] =
+  {0.1, -0.5, 1.0, -1.5, 0.0, 2.5, -10.5, 15.0, 0.2, -0.4, -2.1, -1.1, 0.6, 1.4, 3.8, 5.9};
+
+uint8_t current_case{CASE_NOMINAL};
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void configure(uint8_t test_case) {
+  ControlAlgorithms::PID::IntegralSettings i_settings;
+  i_settings.setGain(-0.2);
+  i_settings.setHasLimits(true);
+  i_settings.setMinLimit(-1.0);
+  i_settings.setMaxLimit(1.0);
+  ControlAlgorithms::PID::DerivativeSettings d_settings;
+  d_settings.setGain(-0.1);
+  d_settings.setMinTimeStep(0.0000001);
+  control_i.setSettings(i_settings);
+  control_d.setSettings(d_settings);
+  control_i.setHardened(test_case == CASE_HARDENED_FAULT);
+  control_d.setHardened(test_case == CASE_HARDENED_FAULT);
+  control_i.reset();
+  control_d.reset();
+  current_case = test_case;
+}
+
+// One timed step: both controllers, as a control loop would run them
+void step(uint32_t iteration) {
+  float error = errors[iteration % ERRORS];
+  float delta_t = 0.001f;
+  switch(current_case) {
+    case CASE_CLAMP:
+      // Large enough to drive the integrator into its limit every call
+      error = 5000.0f;
+      break;
+    case CASE_MIN_TIME_STEP:
+      delta_t = 0.0f;
+      break;
+    case CASE_SUBNORMAL:
+      error = 1.0e-40f * (float)(1 + iteration % ERRORS);
+      break;
+    case CASE_NOT_FINITE:
+    case CASE_HARDENED_FAULT:
+      error = NAN;
+      break;
+    default:
+      break;
+  }
+  input.setError(error);
+  input.setDeltaT(delta_t);
+  control_i.update(input, output);
+  control_d.update(input, output);
+}
+
+void report(const char *name, const char *cache, const TimingStats &stats, bool data_dependent) {
+  char line[160];
+  snprintf(line, sizeof(line), "%-17s %-5s max %8lu  p99.99 %8lu  p50 %6lu  jitter %8lu %s%s",
+           name, cache, (unsigned long)stats.getMax(), (unsigned long)stats.percentile(0.9999f),
+           (unsigned long)stats.percentile(0.5f), (unsigned long)stats.getJitter(),
+           ControlAlgorithms::Timing::CycleCounter::unit(), data_dependent ? "  DATA DEPENDENT" : "");
+  printLine(line);
+}
+
+void runAll() {
+  static TimingStats warm[CASES];
+  static TimingStats cold[CASES];
+  void (*function)(uint32_t) = step;
+  for(uint8_t test_case = 0; test_case < CASES; ++test_case) {
+    warm[test_case].reset();
+    cold[test_case].reset();
+    configure(test_case);
+    WcetHarness::measure(function, ITERATIONS, warm[test_case]);
+    configure(test_case);
+    WcetHarness::measure(function, COLD_ITERATIONS, cold[test_case], eviction_buffer, EVICTION_SIZE);
+  }
+
+  printLine("Integral::update + Derivative::update");
+  for(uint8_t test_case = 0; test_case < CASES; ++test_case) {
+    report(case_names[test_case], "warm", warm[test_case],
+           WcetHarness::isDataDependent(warm[CASE_NOMINAL], warm[test_case], TOLERANCE, SLACK));
+    // Cold runs are dominated by memory latency, so only warm runs are compared
+    report(case_names[test_case], "cold", cold[test_case], false);
+  }
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+}
+
+void loop() {
+  runAll();
+  delay(5000);
+}
+#else
+int main() {
+  runAll();
+  return 0;
+}
+#endif
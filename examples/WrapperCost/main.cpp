@@ -0,0 +1,164 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Cost of the stateful wrappers against the stateless updates they wrap. Each sample times a block of
+ * Integral::update plus Derivative::update calls, then the same updates through IntegralStateless and
+ * DerivativeStateless with caller held state, and reports the median cost per update pair. The wrappers update
+ * their state in place, so the two should be close. The final wrapper state is also checked against the
+ * stateless state.
+ *
+ * Builds as an Arduino sketch, or on a host by compiling this file with the src/pid sources and -I src.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include <pid/integral.h>
+#include <pid/derivative.h>
+#include <timing/wcetHarness.h>
+#include <stdio.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+using ControlAlgorithms::Timing::TimingStats;
+using ControlAlgorithms::Timing::WcetHarness;
+
+#if defined(ARDUINO)
+const uint32_t SAMPLES = 2000;
+#else
+const uint32_t SAMPLES = 20000;
+#endif
+const uint32_t BLOCK = 64;
+
+const uint8_t ERRORS = 16;
+const float errors[ERRORS] =
+  {0.1, -0.5, 1.0, -1.5, 0.0, 2.5, -10.5, 15.0, 0.2, -0.4, -2.1, -1.1, 0.6, 1.4, 3.8, 5.9};
+const float DELTA_T = 0.001f;
+
+ControlAlgorithms::PID::IntegralSettings i_settings;
+ControlAlgorithms::PID::DerivativeSettings d_settings;
+
+// Stateful
+ControlAlgorithms::PID::Integral control_i;
+ControlAlgorithms::PID::Derivative control_d;
+ControlAlgorithms::Base::ControlInput input;
+ControlAlgorithms::Base::ControlOutput output;
+
+// Stateless, with the state held by the caller
+ControlAlgorithms::PID::IntegralInput input_i;
+ControlAlgorithms::PID::IntegralOutput output_i;
+ControlAlgorithms::PID::DerivativeInput input_d;
+ControlAlgorithms::PID::DerivativeOutput output_d;
+
+void printLine(const char *line) {
+#if defined(ARDUINO)
+  Serial.println(line);
+#else
+  puts(line);
+#endif
+}
+
+void statefulBlock(uint32_t iteration) {
+  for(uint32_t update = 0; update < BLOCK; ++update) {
+    input.setError(errors[(iteration + update) % ERRORS]);
+    input.setDeltaT(DELTA_T);
+    control_i.update(input, output);
+    control_d.update(input, output);
+  }
+}
+
+void statelessBlock(uint32_t iteration) {
+  for(uint32_t update = 0; update < BLOCK; ++update) {
+    float error = errors[(iteration + update) % ERRORS];
+    input_i.setError(error);
+    input_i.setDeltaT(DELTA_T);
+    input_i.setAccumulator(output_i.getAccumulator());
+    ControlAlgorithms::PID::IntegralStateless::update(input_i, i_settings, output_i);
+    input_d.setError(error);
+    input_d.setDeltaT(DELTA_T);
+    input_d.setPreviousError(output_d.getPreviousError());
+    ControlAlgorithms::PID::DerivativeStateless::update(input_d, d_settings, output_d);
+  }
+}
+
+void report(const char *name, const TimingStats &stats) {
+  char line[128];
+  snprintf(line, sizeof(line), "%-10s %8.2f %s per update pair (median block of %lu)", name,
+           (double)stats.percentile(0.5f) / (double)BLOCK, ControlAlgorithms::Timing::CycleCounter::unit(),
+           (unsigned long)BLOCK);
+  printLine(line);
+}
+
+void runAll() {
+  i_settings.setGain(-0.2);
+  i_settings.setHasLimits(true);
+  i_settings.setMinLimit(-100.0);
+  i_settings.setMaxLimit(100.0);
+  d_settings.setGain(-0.1);
+  d_settings.setMinTimeStep(0.0000001);
+  control_i.setSettings(i_settings);
+  control_d.setSettings(d_settings);
+  control_i.reset();
+  control_d.reset();
+  output_i.setIntegratedError(0.0);
+  output_d.setPreviousError(0.0);
+
+  static TimingStats stateful;
+  static TimingStats stateless;
+  stateful.reset();
+  stateless.reset();
+  void (*stateful_function)(uint32_t) = statefulBlock;
+  void (*stateless_function)(uint32_t) = statelessBlock;
+  WcetHarness::measure(stateful_function, SAMPLES, stateful);
+  WcetHarness::measure(stateless_function, SAMPLES, stateless);
+  report("stateful", stateful);
+  report("stateless", stateless);
+
+  // Both ran the same sequence, so the state must match exactly
+  ControlAlgorithms::PID::IntegralOutput state_i;
+  ControlAlgorithms::PID::DerivativeOutput state_d;
+  control_i.getState(state_i);
+  control_d.getState(state_d);
+  bool matches = state_i.getIntegratedError() == output_i.getIntegratedError() &&
+                 state_d.getPreviousError() == output_d.getPreviousError();
+  printLine(matches ? "stateful state matches stateless" : "stateful state DIFFERS from stateless");
+}
+
+#if defined(ARDUINO)
+void setup() {
+  // Start serial for debugging
+  Serial.begin(115200);
+  while(!Serial) {}
+}
+
+void loop() {
+  runAll();
+  delay(5000);
+}
+#else
+int main() {
+  runAll();
+  return 0;
+}
+#endif
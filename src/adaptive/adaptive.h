@@ -0,0 +1,139 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Online adaptive gain tuning. Feed it the measurement and the control applied over each time step next to the
+ * controller, and apply the gains whenever they are valid. Memory use is fixed and each update is O(n^2) in the
+ * two model parameters.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_H
+
+#include <adaptive/adaptiveInput.h>
+#include <adaptive/adaptiveSettings.h>
+#include <adaptive/adaptiveOutput.h>
+#include <adaptive/adaptiveStateless.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+class Adaptive {
+    public:
+        Adaptive() {};
+        virtual ~Adaptive() {};
+
+        /**
+         * Set the estimator and tuning settings
+         * @param settings [in]: AdaptiveSettings settings
+         */
+        virtual void setSettings(const AdaptiveSettings &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the estimator and tuning settings
+         * @param settings [out]: AdaptiveSettings settings
+         */
+        virtual void getSettings(AdaptiveSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: AdaptiveOutput the internal state
+         */
+        virtual void getState(AdaptiveOutput &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: AdaptiveOutput the internal state
+         */
+        virtual void setState(const AdaptiveOutput &state) {
+            state_.copy(state);
+        }
+
+        /**
+         * Fold one sample into the model
+         * @param measurement [in]: float the plant output now
+         * @param control [in]: float the control signal applied over the last time step
+         * @param delta_t [in]: float the time step
+         * @return bool true if the gains are valid
+         */
+        virtual bool update(float measurement, float control, float delta_t) {
+            // Fill the input with state in place
+            input_with_state_.setMeasurement(measurement);
+            input_with_state_.setControl(control);
+            input_with_state_.setDeltaT(delta_t);
+            input_with_state_.setState(state_.getState());
+
+            // Run the update
+            AdaptiveStateless::update(input_with_state_, settings_, state_);
+            return state_.getValid();
+        }
+
+        /**
+         * Restart estimation from the initial covariance
+         */
+        virtual void reset() {
+            state_.copy(AdaptiveOutput());
+        }
+
+        virtual bool isStateful() { return true; }
+
+        virtual bool isValid() const { return state_.getValid(); }
+        virtual float getA() const { return state_.getState().getA(); }
+        virtual float getB() const { return state_.getState().getB(); }
+        virtual float getPredictionError() const { return state_.getPredictionError(); }
+
+        /**
+         * Set the controller gains from the current model
+         * @param proportional [in/out]: Base::ControlSettings proportional settings
+         * @param integral [in/out]: PID::IntegralSettings integral settings
+         * @param derivative [in/out]: PID::DerivativeSettings derivative settings
+         * @return bool false, leaving the settings untouched, if the gains are not valid
+         */
+        virtual bool getTunedSettings(Base::ControlSettings &proportional, PID::IntegralSettings &integral,
+                                      PID::DerivativeSettings &derivative) const {
+            return AdaptiveStateless::applyGains(state_, proportional, integral, derivative);
+        }
+
+    private:
+        // The stored settings
+        AdaptiveSettings settings_;
+
+        // Contains all required state info
+        AdaptiveOutput state_;
+
+        // Used for the internal call with state
+        AdaptiveInput input_with_state_;
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_H
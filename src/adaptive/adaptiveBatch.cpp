@@ -0,0 +1,96 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of adaptive gain tuning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "adaptiveBatch.h"
+#include <adaptive/adaptiveKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Adaptive {
+
+// The arrays of one call must not overlap. Each loop gathers its model into locals, so the estimator code is
+// shared with the stateless form.
+void AdaptiveBatch::update(const float *__restrict measurement, const float *__restrict control,
+                           const float *__restrict delta_t, const AdaptiveSettings &settings,
+                           float *__restrict param_a, float *__restrict param_b, float *__restrict covariance_aa,
+                           float *__restrict covariance_ab, float *__restrict covariance_bb,
+                           float *__restrict previous_measurement, uint16_t *__restrict samples,
+                           float *__restrict proportional_gain, float *__restrict integral_gain,
+                           float *__restrict derivative_gain, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = static_cast<uint32_t>(i);
+        updateIndexed(&loop, &measurement[i], &control[i], &delta_t[i], settings, param_a, param_b, covariance_aa,
+                      covariance_ab, covariance_bb, previous_measurement, samples, proportional_gain, integral_gain,
+                      derivative_gain, 1);
+    }
+}
+
+void AdaptiveBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict measurement,
+                                  const float *__restrict control, const float *__restrict delta_t,
+                                  const AdaptiveSettings &settings, float *__restrict param_a,
+                                  float *__restrict param_b, float *__restrict covariance_aa,
+                                  float *__restrict covariance_ab, float *__restrict covariance_bb,
+                                  float *__restrict previous_measurement, uint16_t *__restrict samples,
+                                  float *__restrict proportional_gain, float *__restrict integral_gain,
+                                  float *__restrict derivative_gain, size_t count) {
+    float forgetting = settings.getForgettingFactor();
+    float initial_covariance = settings.getInitialCovariance();
+    float max_covariance = settings.getMaxCovariance();
+    float derivative_fraction = derivative_gain != nullptr ? settings.getDerivativeFraction() : 0.0f;
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        float theta[ADAPTIVE_PARAMETERS] = {param_a[loop], param_b[loop]};
+        float covariance[ADAPTIVE_PARAMETERS][ADAPTIVE_PARAMETERS] = {
+            {covariance_aa[loop], covariance_ab[loop]},
+            {covariance_ab[loop], covariance_bb[loop]}};
+        Kernels::estimate(theta, covariance, previous_measurement[loop], samples[loop], measurement[i], control[i],
+                          forgetting, initial_covariance, max_covariance);
+        param_a[loop] = theta[PARAMETER_A];
+        param_b[loop] = theta[PARAMETER_B];
+        covariance_aa[loop] = covariance[0][0];
+        covariance_ab[loop] = covariance[0][1];
+        covariance_bb[loop] = covariance[1][1];
+
+        float proportional;
+        float integral;
+        float derivative;
+        if(samples[loop] > settings.getMinSamples() &&
+           Kernels::gains(theta[PARAMETER_A], theta[PARAMETER_B], delta_t[i], settings.getClosedLoopTimeConstant(),
+                          derivative_fraction, settings.getMaxGain(), proportional, integral, derivative)) {
+            proportional_gain[loop] = proportional;
+            integral_gain[loop] = integral;
+            if(derivative_gain != nullptr) {
+                derivative_gain[loop] = derivative;
+            }
+        }
+    }
+}
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
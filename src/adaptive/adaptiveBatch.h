@@ -0,0 +1,88 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) version of adaptive gain tuning. The gain arrays can be the gain arrays of the
+ * proportional, integral and derivative banks, so the banks pick up new gains without a copy.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_BATCH_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <adaptive/adaptiveSettings.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+class AdaptiveBatch {
+    public:
+        /**
+         * Fold one sample into the model of many independent loops, sharing one set of settings. Element i of every
+         * array belongs to loop i. The gains of a loop are only written while its model is valid.
+         * @param measurement [in]: float[count] plant outputs now
+         * @param control [in]: float[count] control signals applied over the last time step
+         * @param delta_t [in]: float[count] time steps
+         * @param settings [in]: AdaptiveSettings estimator and tuning settings for all loops
+         * @param param_a [in/out]: float[count] estimated a
+         * @param param_b [in/out]: float[count] estimated b
+         * @param covariance_aa [in/out]: float[count] covariance of a
+         * @param covariance_ab [in/out]: float[count] covariance of a and b
+         * @param covariance_bb [in/out]: float[count] covariance of b
+         * @param previous_measurement [in/out]: float[count] measurements of the last update
+         * @param samples [in/out]: uint16_t[count] updates so far, zero to (re)start a loop
+         * @param proportional_gain [in/out]: float[count] proportional gains
+         * @param integral_gain [in/out]: float[count] integral gains
+         * @param derivative_gain [in/out]: float[count] derivative gains, or nullptr for PI loops
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *measurement, const float *control, const float *delta_t,
+                           const AdaptiveSettings &settings, float *param_a, float *param_b, float *covariance_aa,
+                           float *covariance_ab, float *covariance_bb, float *previous_measurement, uint16_t *samples,
+                           float *proportional_gain, float *integral_gain, float *derivative_gain, size_t count);
+
+        /**
+         * Fold in samples for a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param measurement [in]: float[count] plant output of each sample
+         * @param control [in]: float[count] applied control of each sample
+         * @param delta_t [in]: float[count] time step of each sample
+         * Remaining parameters are indexed by loop, as in update.
+         */
+        static void updateIndexed(const uint32_t *loops, const float *measurement, const float *control,
+                                  const float *delta_t, const AdaptiveSettings &settings, float *param_a,
+                                  float *param_b, float *covariance_aa, float *covariance_ab, float *covariance_bb,
+                                  float *previous_measurement, uint16_t *samples, float *proportional_gain,
+                                  float *integral_gain, float *derivative_gain, size_t count);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        AdaptiveBatch() {};
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_BATCH_H
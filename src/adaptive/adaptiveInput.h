@@ -0,0 +1,79 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Input for adaptive gain tuning: the measured plant output, the control applied since the last sample and the
+ * time step
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_INPUT_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_INPUT_H
+
+#include <base/controlInput.h>
+#include <adaptive/adaptiveState.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+class AdaptiveInput: public Base::ControlInput {
+    public:
+        AdaptiveInput () {};
+        virtual ~AdaptiveInput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: AdaptiveInput input
+         */
+        void copy(const AdaptiveInput &right) {
+            // Super call
+            Base::ControlInput::copy(right);
+
+            setMeasurement(right.getMeasurement());
+            setControl(right.getControl());
+            setState(right.getState());
+        }
+
+        void setMeasurement(float measurement) { measurement_ = measurement; }
+        float getMeasurement() const { return measurement_; }
+        void setControl(float control) { control_ = control; }
+        float getControl() const { return control_; }
+        void setState(const AdaptiveState &state) { state_.copy(state); }
+        const AdaptiveState &getState() const { return state_; }
+
+    private:
+        // The plant output now
+        float measurement_{0.0};
+
+        // The control signal applied over the last time step
+        float control_{0.0};
+
+        // The estimator state from the last update
+        AdaptiveState state_;
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_INPUT_H
@@ -0,0 +1,109 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Per loop steps of adaptive gain tuning, shared by the stateless and batch forms
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_KERNELS_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_KERNELS_H
+
+#include <stdint.h>
+#include <math.h>
+#include <adaptive/adaptiveState.h>
+#include <adaptive/rls.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+namespace Kernels {
+
+/**
+ * Update the model y[k] = a y[k-1] + b u[k-1] with one sample. The first sample only records the measurement.
+ * @param theta [in/out]: float[2] a and b
+ * @param covariance [in/out]: float[2][2] estimate covariance
+ * @param previous_measurement [in/out]: float y[k-1], replaced by measurement
+ * @param samples [in/out]: uint16_t updates so far, saturating
+ * @param measurement [in]: float y[k]
+ * @param control [in]: float u[k-1]
+ * @param forgetting [in]: float forgetting factor
+ * @param initial_covariance [in]: float covariance used when the estimator starts
+ * @param max_covariance [in]: float covariance trace bound
+ * @return float prediction error, zero for the first sample
+ */
+inline float estimate(float theta[ADAPTIVE_PARAMETERS], float covariance[ADAPTIVE_PARAMETERS][ADAPTIVE_PARAMETERS],
+                      float &previous_measurement, uint16_t &samples, float measurement, float control,
+                      float forgetting, float initial_covariance, float max_covariance) {
+    float error = 0.0f;
+    if(samples == 0) {
+        Rls<ADAPTIVE_PARAMETERS>::reset(theta, covariance, initial_covariance);
+    } else {
+        float regressor[ADAPTIVE_PARAMETERS] = {previous_measurement, control};
+        error = Rls<ADAPTIVE_PARAMETERS>::update(theta, covariance, regressor, measurement, forgetting, max_covariance);
+    }
+    previous_measurement = measurement;
+    if(samples < UINT16_MAX) {
+        ++samples;
+    }
+    return error;
+}
+
+/**
+ * Internal model control gains for the first order plant. With time constant tau = -dt / ln(a) and static gain
+ * K = b / (1 - a): Kp = tau / (K lambda), Ki = Kp / tau, Kd = Kp Td with Td = derivative_fraction tau.
+ * @param a [in]: float estimated a
+ * @param b [in]: float estimated b
+ * @param delta_t [in]: float the sample time the model was estimated at
+ * @param closed_loop_time_constant [in]: float lambda
+ * @param derivative_fraction [in]: float Td / tau
+ * @param max_gain [in]: float largest gain magnitude
+ * @param proportional [out]: float Kp
+ * @param integral [out]: float Ki
+ * @param derivative [out]: float Kd
+ * @return bool false, leaving the outputs untouched, if the model is not a stable first order lag
+ */
+inline bool gains(float a, float b, float delta_t, float closed_loop_time_constant, float derivative_fraction,
+                  float max_gain, float &proportional, float &integral, float &derivative) {
+    if(!(a > 0.0f && a < 1.0f) || b == 0.0f || !isfinite(b) || !(delta_t > 0.0f) || !(closed_loop_time_constant > 0.0f)) {
+        return false;
+    }
+    float time_constant = -delta_t / logf(a);
+    float static_gain = b / (1.0f - a);
+    float kp = time_constant / (static_gain * closed_loop_time_constant);
+    float ki = kp / time_constant;
+    float kd = kp * derivative_fraction * time_constant;
+    if(!(fabsf(kp) <= max_gain && fabsf(ki) <= max_gain && fabsf(kd) <= max_gain)) {
+        return false;
+    }
+    proportional = kp;
+    integral = ki;
+    derivative = kd;
+    return true;
+}
+
+}  // namespace Kernels
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_KERNELS_H
@@ -0,0 +1,89 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Output of adaptive gain tuning: the updated estimator state and the gains derived from it
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_OUTPUT_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_OUTPUT_H
+
+#include <adaptive/adaptiveState.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+class AdaptiveOutput {
+    public:
+        AdaptiveOutput () {};
+        virtual ~AdaptiveOutput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: AdaptiveOutput input
+         */
+        void copy(const AdaptiveOutput &right) {
+            setState(right.getState());
+            setPredictionError(right.getPredictionError());
+            setValid(right.getValid());
+            setProportionalGain(right.getProportionalGain());
+            setIntegralGain(right.getIntegralGain());
+            setDerivativeGain(right.getDerivativeGain());
+        }
+
+        void setState(const AdaptiveState &state) { state_.copy(state); }
+        const AdaptiveState &getState() const { return state_; }
+        AdaptiveState &getState() { return state_; }
+        void setPredictionError(float prediction_error) { prediction_error_ = prediction_error; }
+        float getPredictionError() const { return prediction_error_; }
+        void setValid(bool valid) { valid_ = valid; }
+        bool getValid() const { return valid_; }
+        void setProportionalGain(float proportional_gain) { proportional_gain_ = proportional_gain; }
+        float getProportionalGain() const { return proportional_gain_; }
+        void setIntegralGain(float integral_gain) { integral_gain_ = integral_gain; }
+        float getIntegralGain() const { return integral_gain_; }
+        void setDerivativeGain(float derivative_gain) { derivative_gain_ = derivative_gain; }
+        float getDerivativeGain() const { return derivative_gain_; }
+
+    private:
+        // The estimator state for the next update
+        AdaptiveState state_;
+
+        // One step ahead prediction error of the model before this update
+        float prediction_error_{0.0};
+
+        // Whether the model is usable (enough samples, stable, non-zero gain) and the gains were computed
+        bool valid_{false};
+
+        // Gains from the model; only meaningful when valid
+        float proportional_gain_{0.0};
+        float integral_gain_{0.0};
+        float derivative_gain_{0.0};
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_OUTPUT_H
@@ -0,0 +1,99 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for adaptive gain tuning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_SETTINGS_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_SETTINGS_H
+
+#include <stdint.h>
+#include <float.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+class AdaptiveSettings {
+    public:
+        AdaptiveSettings () {};
+        virtual ~AdaptiveSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: AdaptiveSettings input settings
+         */
+        void copy(const AdaptiveSettings &right) {
+            setForgettingFactor(right.getForgettingFactor());
+            setInitialCovariance(right.getInitialCovariance());
+            setMaxCovariance(right.getMaxCovariance());
+            setClosedLoopTimeConstant(right.getClosedLoopTimeConstant());
+            setDerivativeFraction(right.getDerivativeFraction());
+            setMaxGain(right.getMaxGain());
+            setMinSamples(right.getMinSamples());
+        }
+
+        void setForgettingFactor(float forgetting_factor) { forgetting_factor_ = forgetting_factor; }
+        float getForgettingFactor() const { return forgetting_factor_; }
+        void setInitialCovariance(float initial_covariance) { initial_covariance_ = initial_covariance; }
+        float getInitialCovariance() const { return initial_covariance_; }
+        void setMaxCovariance(float max_covariance) { max_covariance_ = max_covariance; }
+        float getMaxCovariance() const { return max_covariance_; }
+        void setClosedLoopTimeConstant(float closed_loop_time_constant) { closed_loop_time_constant_ = closed_loop_time_constant; }
+        float getClosedLoopTimeConstant() const { return closed_loop_time_constant_; }
+        void setDerivativeFraction(float derivative_fraction) { derivative_fraction_ = derivative_fraction; }
+        float getDerivativeFraction() const { return derivative_fraction_; }
+        void setMaxGain(float max_gain) { max_gain_ = max_gain; }
+        float getMaxGain() const { return max_gain_; }
+        void setMinSamples(uint16_t min_samples) { min_samples_ = min_samples; }
+        uint16_t getMinSamples() const { return min_samples_; }
+
+    private:
+        // Weight of the previous estimate per sample; 0.99 remembers roughly the last 100 samples
+        float forgetting_factor_{0.99};
+
+        // Covariance the estimate starts from, large for little prior knowledge
+        float initial_covariance_{1000.0};
+
+        // Bound on the covariance trace, so it cannot wind up while the loop is not excited
+        float max_covariance_{10000.0};
+
+        // Desired closed loop time constant, in the units of the time step; smaller is more aggressive
+        float closed_loop_time_constant_{1.0};
+
+        // Derivative time as a fraction of the plant time constant; zero leaves a PI controller
+        float derivative_fraction_{0.0};
+
+        // Largest gain magnitude written
+        float max_gain_{FLT_MAX};
+
+        // Samples before the estimate is used
+        uint16_t min_samples_{10};
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_SETTINGS_H
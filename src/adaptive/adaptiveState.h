@@ -0,0 +1,90 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Estimator state carried between adaptive updates: the first order plant model y[k] = a y[k-1] + b u[k-1] and
+ * its covariance
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_STATE_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_STATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+// Model parameters, in estimator order
+const size_t ADAPTIVE_PARAMETERS = 2;
+const size_t PARAMETER_A = 0;
+const size_t PARAMETER_B = 1;
+
+class AdaptiveState {
+    public:
+        AdaptiveState () {};
+        virtual ~AdaptiveState() {};
+
+        /**
+         * Copy in
+         * @param right [in]: AdaptiveState input
+         */
+        void copy(const AdaptiveState &right) {
+            memcpy(theta_, right.theta_, sizeof(theta_));
+            memcpy(covariance_, right.covariance_, sizeof(covariance_));
+            setPreviousMeasurement(right.getPreviousMeasurement());
+            setSamples(right.getSamples());
+        }
+
+        float *getTheta() { return theta_; }
+        const float *getTheta() const { return theta_; }
+        float (*getCovariance())[ADAPTIVE_PARAMETERS] { return covariance_; }
+        const float (*getCovariance() const)[ADAPTIVE_PARAMETERS] { return covariance_; }
+        float getA() const { return theta_[PARAMETER_A]; }
+        float getB() const { return theta_[PARAMETER_B]; }
+        void setPreviousMeasurement(float previous_measurement) { previous_measurement_ = previous_measurement; }
+        float getPreviousMeasurement() const { return previous_measurement_; }
+        void setSamples(uint16_t samples) { samples_ = samples; }
+        uint16_t getSamples() const { return samples_; }
+
+    private:
+        // Estimated a and b
+        float theta_[ADAPTIVE_PARAMETERS]{};
+
+        // Estimate covariance; zero until the first update resets it
+        float covariance_[ADAPTIVE_PARAMETERS][ADAPTIVE_PARAMETERS]{};
+
+        // Measurement of the last update
+        float previous_measurement_{0.0};
+
+        // Updates so far, saturating; zero means the estimator has not started
+        uint16_t samples_{0};
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_STATE_H
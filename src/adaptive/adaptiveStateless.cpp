@@ -0,0 +1,75 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of adaptive gain tuning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "adaptiveStateless.h"
+#include <adaptive/adaptiveKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Adaptive {
+
+void AdaptiveStateless::update(const AdaptiveInput &input, const AdaptiveSettings &settings, AdaptiveOutput &out) {
+    AdaptiveState &state = out.getState();
+    state.copy(input.getState());
+
+    float previous_measurement = state.getPreviousMeasurement();
+    uint16_t samples = state.getSamples();
+    out.setPredictionError(Kernels::estimate(state.getTheta(), state.getCovariance(), previous_measurement, samples,
+                                             input.getMeasurement(), input.getControl(),
+                                             settings.getForgettingFactor(), settings.getInitialCovariance(),
+                                             settings.getMaxCovariance()));
+    state.setPreviousMeasurement(previous_measurement);
+    state.setSamples(samples);
+
+    float proportional = 0.0f;
+    float integral = 0.0f;
+    float derivative = 0.0f;
+    bool valid = samples > settings.getMinSamples() &&
+                 Kernels::gains(state.getA(), state.getB(), input.getDeltaT(), settings.getClosedLoopTimeConstant(),
+                                settings.getDerivativeFraction(), settings.getMaxGain(),
+                                proportional, integral, derivative);
+    out.setValid(valid);
+    out.setProportionalGain(proportional);
+    out.setIntegralGain(integral);
+    out.setDerivativeGain(derivative);
+}
+
+bool AdaptiveStateless::applyGains(const AdaptiveOutput &out, Base::ControlSettings &proportional,
+                                   PID::IntegralSettings &integral, PID::DerivativeSettings &derivative) {
+    if(!out.getValid()) {
+        return false;
+    }
+    proportional.setGain(out.getProportionalGain());
+    integral.setGain(out.getIntegralGain());
+    derivative.setGain(out.getDerivativeGain());
+    return true;
+}
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
@@ -0,0 +1,75 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless adaptive gain tuning. The plant is modelled as a first order lag y[k] = a y[k-1] + b u[k-1], which
+ * is estimated online by recursive least squares with a forgetting factor; each update then turns the model into
+ * proportional, integral and derivative gains by internal model control, so the gains follow plant drift.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_STATELESS_H
+#define CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_STATELESS_H
+
+#include <base/controlSettings.h>
+#include <pid/derivativeSettings.h>
+#include <pid/integralSettings.h>
+#include <adaptive/adaptiveInput.h>
+#include <adaptive/adaptiveOutput.h>
+#include <adaptive/adaptiveSettings.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+class AdaptiveStateless {
+    public:
+        /**
+         * Fold one sample into the model and recompute the gains. The output is valid once the minimum number of
+         * samples have been seen and the model is a stable lag with non-zero gain.
+         * @param input [in]: AdaptiveInput measurement, applied control, time step and the state from the last update
+         * @param settings [in]: AdaptiveSettings estimator and tuning settings
+         * @param out [out]: AdaptiveOutput the updated state and gains
+         */
+        static void update(const AdaptiveInput &input, const AdaptiveSettings &settings, AdaptiveOutput &out);
+
+        /**
+         * Write the gains of a valid output into controller settings. Only the gains are written, so limits and
+         * time steps already in the settings are kept.
+         * @param out [in]: AdaptiveOutput output of update
+         * @param proportional [in/out]: Base::ControlSettings proportional settings
+         * @param integral [in/out]: PID::IntegralSettings integral settings
+         * @param derivative [in/out]: PID::DerivativeSettings derivative settings
+         * @return bool false, leaving the settings untouched, if the output is not valid
+         */
+        static bool applyGains(const AdaptiveOutput &out, Base::ControlSettings &proportional,
+                               PID::IntegralSettings &integral, PID::DerivativeSettings &derivative);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        AdaptiveStateless() {};
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_ADAPTIVE_STATELESS_H
@@ -0,0 +1,116 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Recursive least squares with a forgetting factor, for N parameters. Each update is O(N^2) on caller owned
+ * arrays, with no allocation.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ADAPTIVE_RLS_H
+#define CONTROLALGORITHMS_ADAPTIVE_RLS_H
+
+#include <stddef.h>
+
+namespace ControlAlgorithms {
+namespace Adaptive {
+
+template<size_t N>
+class Rls {
+    public:
+        /**
+         * Start an estimate: parameters zero and covariance initial_covariance * I
+         * @param theta [out]: float[N] parameters
+         * @param covariance [out]: float[N][N] covariance
+         * @param initial_covariance [in]: float initial variance, large for little prior knowledge
+         */
+        static void reset(float theta[N], float covariance[N][N], float initial_covariance) {
+            for(size_t row = 0; row < N; ++row) {
+                theta[row] = 0.0f;
+                for(size_t column = 0; column < N; ++column) {
+                    covariance[row][column] = row == column ? initial_covariance : 0.0f;
+                }
+            }
+        }
+
+        /**
+         * Fold in one observation measurement = regressor . theta + noise
+         * @param theta [in/out]: float[N] parameters
+         * @param covariance [in/out]: float[N][N] covariance, kept symmetric
+         * @param regressor [in]: float[N] regressor
+         * @param measurement [in]: float observed value
+         * @param forgetting [in]: float forgetting factor in (0, 1]; smaller tracks drift faster
+         * @param max_trace [in]: float bound on the covariance trace, which stops it winding up without excitation
+         * @return float prediction error before the update
+         */
+        static float update(float theta[N], float covariance[N][N], const float regressor[N], float measurement,
+                            float forgetting, float max_trace) {
+            float gain[N];
+            float prediction = 0.0f;
+            float denominator = forgetting;
+            for(size_t row = 0; row < N; ++row) {
+                float sum = 0.0f;
+                for(size_t column = 0; column < N; ++column) {
+                    sum += covariance[row][column] * regressor[column];
+                }
+                gain[row] = sum;
+                denominator += regressor[row] * sum;
+                prediction += regressor[row] * theta[row];
+            }
+            float error = measurement - prediction;
+
+            float inverse = 1.0f / denominator;
+            float trace = 0.0f;
+            for(size_t row = 0; row < N; ++row) {
+                theta[row] += gain[row] * inverse * error;
+            }
+            // P = (P - P phi phi' P / denominator) / forgetting, computed on the upper triangle and mirrored
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = row; column < N; ++column) {
+                    float value = (covariance[row][column] - gain[row] * gain[column] * inverse) / forgetting;
+                    covariance[row][column] = value;
+                    covariance[column][row] = value;
+                }
+                trace += covariance[row][row];
+            }
+            if(trace > max_trace) {
+                float scale = max_trace / trace;
+                for(size_t row = 0; row < N; ++row) {
+                    for(size_t column = 0; column < N; ++column) {
+                        covariance[row][column] *= scale;
+                    }
+                }
+            }
+            return error;
+        }
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Rls() {};
+};
+
+}  // namespace Adaptive
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ADAPTIVE_RLS_H
@@ -0,0 +1,238 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Discrete time frequency response and stability margins
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "frequencyResponse.h"
+#include <math.h>
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Analysis {
+
+namespace {
+
+const uint32_t BLOCK = FrequencyResponse::BLOCK;
+
+// Controller and plant folded into the constants used per frequency
+struct Loop {
+    float proportional;
+    // Ki * T
+    float integral;
+    // Kd / max(T, min_time_step)
+    float derivative;
+    float delta_t;
+    const PlantModel *plant;
+};
+
+// a = a * w + c, over the lanes of a block
+void hornerStep(float *__restrict a_real, float *__restrict a_imag, const float *__restrict w_real,
+                const float *__restrict w_imag, float c, uint32_t count) {
+    for(uint32_t lane = 0; lane < count; ++lane) {
+        float real = a_real[lane] * w_real[lane] - a_imag[lane] * w_imag[lane] + c;
+        float imag = a_real[lane] * w_imag[lane] + a_imag[lane] * w_real[lane];
+        a_real[lane] = real;
+        a_imag[lane] = imag;
+    }
+}
+
+// Polynomial in w with ascending coefficients, over the lanes of a block
+void polynomial(const float *coefficients, uint32_t coefficient_count, const float *w_real, const float *w_imag,
+                float *value_real, float *value_imag, uint32_t count) {
+    float highest = coefficient_count > 0 ? coefficients[coefficient_count - 1] : 0.0f;
+    for(uint32_t lane = 0; lane < count; ++lane) {
+        value_real[lane] = highest;
+        value_imag[lane] = 0.0f;
+    }
+    for(uint32_t index = coefficient_count; index > 1; --index) {
+        hornerStep(value_real, value_imag, w_real, w_imag, coefficients[index - 2], count);
+    }
+}
+
+// Open loop over one block of at most BLOCK frequencies
+void evaluateBlock(const Loop &loop, const float *frequency, float *__restrict real, float *__restrict imag,
+                   uint32_t count) {
+    // w = z^-1 = exp(-j w T), and the dead time z^-delay. 1 - w is kept separately from half angles: at low
+    // frequencies 1 - cos(w T) cancels to zero in float, and the integral term divides by it.
+    float w_real[BLOCK], w_imag[BLOCK], e_real[BLOCK], delay_real[BLOCK], delay_imag[BLOCK];
+    float delay = (float)loop.plant->getDelay();
+    for(uint32_t lane = 0; lane < count; ++lane) {
+        float half_angle = 0.5f * frequency[lane] * loop.delta_t;
+        float half_sin = sinf(half_angle);
+        float half_cos = cosf(half_angle);
+        e_real[lane] = 2.0f * half_sin * half_sin;
+        w_real[lane] = 1.0f - e_real[lane];
+        w_imag[lane] = -2.0f * half_sin * half_cos;
+        delay_real[lane] = cosf(2.0f * half_angle * delay);
+        delay_imag[lane] = -sinf(2.0f * half_angle * delay);
+    }
+
+    float n_real[BLOCK], n_imag[BLOCK], d_real[BLOCK], d_imag[BLOCK];
+    polynomial(loop.plant->getNumerator(), loop.plant->getNumeratorCount(), w_real, w_imag, n_real, n_imag, count);
+    polynomial(loop.plant->getDenominator(), loop.plant->getDenominatorCount(), w_real, w_imag, d_real, d_imag, count);
+
+    float proportional = loop.proportional;
+    float integral = loop.integral;
+    float derivative = loop.derivative;
+    for(uint32_t lane = 0; lane < count; ++lane) {
+        // G = z^-delay * N / D
+        float scale = 1.0f / (d_real[lane] * d_real[lane] + d_imag[lane] * d_imag[lane]);
+        float q_real = (n_real[lane] * d_real[lane] + n_imag[lane] * d_imag[lane]) * scale;
+        float q_imag = (n_imag[lane] * d_real[lane] - n_real[lane] * d_imag[lane]) * scale;
+        float g_real = q_real * delay_real[lane] - q_imag * delay_imag[lane];
+        float g_imag = q_real * delay_imag[lane] + q_imag * delay_real[lane];
+
+        // C = Kp + Ki T / (1 - w) + Kd (1 - w) / T
+        float e_imag = -w_imag[lane];
+        float e_scale = integral / (e_real[lane] * e_real[lane] + e_imag * e_imag);
+        float c_real = proportional + e_real[lane] * e_scale + derivative * e_real[lane];
+        float c_imag = -e_imag * e_scale + derivative * e_imag;
+
+        real[lane] = c_real * g_real - c_imag * g_imag;
+        imag[lane] = c_real * g_imag + c_imag * g_real;
+    }
+}
+
+void makeLoop(const Base::ControlSettings &p_settings, const PID::IntegralSettings &i_settings,
+              const PID::DerivativeSettings &d_settings, const PlantModel &plant, float delta_t, Loop &loop) {
+    loop.proportional = p_settings.getGain();
+    loop.integral = i_settings.getGain() * delta_t;
+    loop.derivative = d_settings.getGain() / PID::Kernels::lowerBound(delta_t, d_settings.getMinTimeStep());
+    loop.delta_t = delta_t;
+    loop.plant = &plant;
+}
+
+// Phase in degrees, unwrapped to within 180 degrees of the previous one
+float unwrap(float phase, float previous) {
+    return phase + 360.0f * roundf((previous - phase) / 360.0f);
+}
+
+// Phase in degrees wrapped to (-180, 180]
+float wrap(float phase) {
+    return phase - 360.0f * ceilf((phase - 180.0f) / 360.0f);
+}
+
+}  // namespace
+
+void FrequencyResponse::logSpace(float min_frequency, float max_frequency, float *frequency, uint32_t count) {
+    // Fewer than two points have no spacing; a single point is the first frequency
+    if(count < 2) {
+        if(count == 1) {
+            frequency[0] = min_frequency;
+        }
+        return;
+    }
+    float ratio = logf(max_frequency / min_frequency) / (float)(count - 1);
+    for(uint32_t index = 0; index < count; ++index) {
+        frequency[index] = min_frequency * expf(ratio * (float)index);
+    }
+    // Land exactly on the end point, e.g. the Nyquist frequency
+    frequency[count - 1] = max_frequency;
+}
+
+void FrequencyResponse::openLoop(const Base::ControlSettings &p_settings, const PID::IntegralSettings &i_settings,
+                                 const PID::DerivativeSettings &d_settings, const PlantModel &plant, float delta_t,
+                                 const float *frequency, float *real, float *imag, uint32_t count) {
+    Loop loop;
+    makeLoop(p_settings, i_settings, d_settings, plant, delta_t, loop);
+    for(uint32_t begin = 0; begin < count; begin += BLOCK) {
+        uint32_t block = count - begin < BLOCK ? count - begin : BLOCK;
+        evaluateBlock(loop, frequency + begin, real + begin, imag + begin, block);
+    }
+}
+
+void FrequencyResponse::bode(const float *real, const float *imag, float *magnitude_db, float *phase, uint32_t count) {
+    float previous = 0.0f;
+    for(uint32_t index = 0; index < count; ++index) {
+        magnitude_db[index] = 20.0f * log10f(hypotf(real[index], imag[index]));
+        float wrapped = atan2f(imag[index], real[index]) * (180.0f / (float)M_PI);
+        phase[index] = index == 0 ? wrapped : unwrap(wrapped, previous);
+        previous = phase[index];
+    }
+}
+
+void FrequencyResponse::margins(const Base::ControlSettings &p_settings, const PID::IntegralSettings &i_settings,
+                                const PID::DerivativeSettings &d_settings, const PlantModel &plant, float delta_t,
+                                const float *frequency, uint32_t count, StabilityMargins &margins) {
+    margins.copy(StabilityMargins());
+    Loop loop;
+    makeLoop(p_settings, i_settings, d_settings, plant, delta_t, loop);
+
+    float real[BLOCK], imag[BLOCK];
+    // Previous point, in log frequency and log magnitude so crossovers interpolate on the Bode plot
+    float previous_frequency = 0.0f;
+    float previous_magnitude = 0.0f;
+    float previous_phase = 0.0f;
+    for(uint32_t begin = 0; begin < count; begin += BLOCK) {
+        uint32_t block = count - begin < BLOCK ? count - begin : BLOCK;
+        evaluateBlock(loop, frequency + begin, real, imag, block);
+        for(uint32_t lane = 0; lane < block; ++lane) {
+            float log_frequency = logf(frequency[begin + lane]);
+            float magnitude = logf(hypotf(real[lane], imag[lane]));
+            float phase = atan2f(imag[lane], real[lane]) * (180.0f / (float)M_PI);
+            if(begin + lane == 0) {
+                previous_frequency = log_frequency;
+                previous_magnitude = magnitude;
+                previous_phase = phase;
+                continue;
+            }
+            phase = unwrap(phase, previous_phase);
+
+            // Gain crossover: |L| passes one
+            if((previous_magnitude > 0.0f) != (magnitude > 0.0f)) {
+                float t = previous_magnitude / (previous_magnitude - magnitude);
+                float phase_margin = wrap(previous_phase + t * (phase - previous_phase) + 180.0f);
+                if(phase_margin < margins.getPhaseMargin()) {
+                    margins.setPhaseMargin(phase_margin);
+                    margins.setGainCrossover(expf(previous_frequency + t * (log_frequency - previous_frequency)));
+                }
+            }
+
+            // Phase crossover: the phase passes an odd multiple of 180 degrees
+            float previous_band = floorf((previous_phase - 180.0f) / 360.0f);
+            float band = floorf((phase - 180.0f) / 360.0f);
+            if(previous_band != band) {
+                float boundary = 180.0f + 360.0f * (previous_band > band ? previous_band : band);
+                float t = (boundary - previous_phase) / (phase - previous_phase);
+                float gain_margin = expf(-(previous_magnitude + t * (magnitude - previous_magnitude)));
+                if(gain_margin < margins.getGainMargin()) {
+                    margins.setGainMargin(gain_margin);
+                    margins.setPhaseCrossover(expf(previous_frequency + t * (log_frequency - previous_frequency)));
+                }
+            }
+
+            previous_frequency = log_frequency;
+            previous_magnitude = magnitude;
+            previous_phase = phase;
+        }
+    }
+}
+
+}  // namespace Analysis
+
+}  // namespace ControlAlgorithms
@@ -0,0 +1,109 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Discrete time frequency response of a PID controller closed around a plant model. The controller is the one
+ * the kernels in pidKernels.h implement at a fixed time step T:
+ * C(z) = Kp + Ki * T / (1 - z^-1) + Kd * (1 - z^-1) / max(T, min_time_step).
+ * The open loop L = C * G is evaluated on z = exp(j w T) in blocks, with the complex arithmetic laid out as
+ * structure of arrays so it vectorizes across frequencies. Integral limits and the time step limits other than
+ * min_time_step are not part of the linear model.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_FREQUENCY_RESPONSE_H
+#define CONTROLALGORITHMS_ANALYSIS_FREQUENCY_RESPONSE_H
+
+#include <stdint.h>
+#include <base/controlSettings.h>
+#include <pid/integralSettings.h>
+#include <pid/derivativeSettings.h>
+#include <analysis/plantModel.h>
+#include <analysis/stabilityMargins.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class FrequencyResponse {
+    public:
+        // Frequencies evaluated together; bounds the stack used by margins
+        static const uint32_t BLOCK = 32;
+
+        /**
+         * Logarithmically spaced frequencies
+         * @param min_frequency [in]: float first frequency in rad/s, > 0
+         * @param max_frequency [in]: float last frequency in rad/s, at most the Nyquist frequency pi / T
+         * @param frequency [out]: float[count] frequencies in rad/s
+         * @param count [in]: uint32_t number of frequencies; 1 writes min_frequency only and 0 writes nothing
+         */
+        static void logSpace(float min_frequency, float max_frequency, float *frequency, uint32_t count);
+
+        /**
+         * Open loop frequency response L(exp(j w T)) = C * G
+         * @param p_settings [in]: Base::ControlSettings proportional settings
+         * @param i_settings [in]: PID::IntegralSettings integral settings
+         * @param d_settings [in]: PID::DerivativeSettings derivative settings
+         * @param plant [in]: PlantModel plant
+         * @param delta_t [in]: float sample time T
+         * @param frequency [in]: float[count] frequencies in rad/s, in (0, pi / T]
+         * @param real [out]: float[count] real part of L
+         * @param imag [out]: float[count] imaginary part of L
+         * @param count [in]: uint32_t number of frequencies
+         */
+        static void openLoop(const Base::ControlSettings &p_settings, const PID::IntegralSettings &i_settings,
+                             const PID::DerivativeSettings &d_settings, const PlantModel &plant, float delta_t,
+                             const float *frequency, float *real, float *imag, uint32_t count);
+
+        /**
+         * Bode form of a frequency response. The phase is unwrapped along the frequencies, so it keeps falling
+         * through -180 degrees instead of jumping back.
+         * @param real [in]: float[count] real part
+         * @param imag [in]: float[count] imaginary part
+         * @param magnitude_db [out]: float[count] magnitude in dB
+         * @param phase [out]: float[count] phase in degrees
+         * @param count [in]: uint32_t number of frequencies
+         */
+        static void bode(const float *real, const float *imag, float *magnitude_db, float *phase, uint32_t count);
+
+        /**
+         * Gain and phase margins of the open loop, found on the given increasing frequencies with crossovers
+         * interpolated between neighbours. The grid has to be fine enough that the phase moves less than 180
+         * degrees between neighbours. The margins are those of the Bode criterion, so they only tell stability
+         * for open loop stable plants.
+         * Parameters as in openLoop.
+         * @param margins [out]: StabilityMargins margins and crossover frequencies
+         */
+        static void margins(const Base::ControlSettings &p_settings, const PID::IntegralSettings &i_settings,
+                            const PID::DerivativeSettings &d_settings, const PlantModel &plant, float delta_t,
+                            const float *frequency, uint32_t count, StabilityMargins &margins);
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        FrequencyResponse() {};
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_FREQUENCY_RESPONSE_H
@@ -0,0 +1,247 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Monte Carlo robustness analysis
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "monteCarlo.h"
+#include <math.h>
+#include <float.h>
+#include <algorithm>
+#include <pid/pidKernels.h>
+#include <analysis/philox.h>
+
+#if !defined(ARDUINO)
+#define CONTROLALGORITHMS_HAS_THREADS 1
+#include <atomic>
+#include <thread>
+#endif
+
+namespace ControlAlgorithms {
+
+namespace Analysis {
+
+namespace {
+
+// Trials a worker takes at a time; large enough to keep the shared counter cold, small enough to balance
+// trials that stop early on divergence
+const uint32_t CHUNK = 16;
+
+// Sorts values [0, count) of scratch and fills the distribution
+void describe(float *values, uint32_t count, Distribution &distribution) {
+    distribution.copy(Distribution());
+    distribution.setCount(count);
+    if(count == 0) {
+        return;
+    }
+    double sum = 0.0;
+    for(uint32_t index = 0; index < count; ++index) {
+        sum += values[index];
+    }
+    std::sort(values, values + count);
+    distribution.setMean((float)(sum / count));
+    distribution.setMin(values[0]);
+    distribution.setMedian(values[(count - 1) / 2]);
+    distribution.setP90(values[(uint32_t)(0.90 * (count - 1) + 0.5)]);
+    distribution.setP99(values[(uint32_t)(0.99 * (count - 1) + 0.5)]);
+    distribution.setMax(values[count - 1]);
+}
+
+#if defined(CONTROLALGORITHMS_HAS_THREADS)
+void worker(std::atomic<uint32_t> *next, const MonteCarloSettings *settings, const Base::ControlSettings *p_settings,
+            const PID::IntegralSettings *i_settings, const PID::DerivativeSettings *d_settings,
+            MonteCarloTrial *results, uint32_t count) {
+    for(;;) {
+        uint32_t begin = next->fetch_add(CHUNK, std::memory_order_relaxed);
+        if(begin >= count) {
+            return;
+        }
+        uint32_t end = count - begin < CHUNK ? count : begin + CHUNK;
+        for(uint32_t trial = begin; trial < end; ++trial) {
+            MonteCarlo::runTrial(trial, *settings, *p_settings, *i_settings, *d_settings, results[trial]);
+        }
+    }
+}
+#endif
+
+}  // namespace
+
+void MonteCarlo::runTrial(uint32_t trial, const MonteCarloSettings &settings, const Base::ControlSettings &p_settings,
+                          const PID::IntegralSettings &i_settings, const PID::DerivativeSettings &d_settings,
+                          MonteCarloTrial &result) {
+    // Parameters are always drawn in this order so a trial's stream does not depend on the settings' ranges
+    Philox random(settings.getSeed(), trial);
+    float plant_gain = random.uniform(settings.getMinPlantGain(), settings.getMaxPlantGain());
+    float time_constant = random.uniform(settings.getMinTimeConstant(), settings.getMaxTimeConstant());
+    uint32_t max_dead_time = settings.getMaxDeadTime() < MAX_DEAD_TIME ? settings.getMaxDeadTime() : MAX_DEAD_TIME;
+    uint32_t min_dead_time = settings.getMinDeadTime() < max_dead_time ? settings.getMinDeadTime() : max_dead_time;
+    uint32_t dead_time = min_dead_time + random.nextBits() % (max_dead_time - min_dead_time + 1);
+    float noise = random.uniform(0.0f, settings.getMaxNoise());
+
+    result.copy(MonteCarloTrial());
+    result.setPlantGain(plant_gain);
+    result.setTimeConstant(time_constant);
+    result.setDeadTime(dead_time);
+    result.setNoise(noise);
+
+    float delta_t = settings.getDeltaT();
+    float setpoint = settings.getSetpoint();
+    float decay = expf(-delta_t / PID::Kernels::lowerBound(time_constant, FLT_MIN));
+    float band = settings.getSettlingBand() * fabsf(setpoint);
+    uint32_t steps = settings.getSteps();
+
+    // Control signals waiting out the dead time; slot step % (dead_time + 1) is applied at step
+    float delayed[MAX_DEAD_TIME + 1] = {};
+
+    // Controller and plant state; the controller starts from zero like the stateful classes
+    float output = 0.0f;
+    float integrated_error = 0.0f;
+    float previous_error = 0.0f;
+
+    float peak = 0.0f;
+    float iae = 0.0f;
+    float head_error = 0.0f;
+    float tail_error = 0.0f;
+    uint32_t last_outside = 0;
+    bool diverged = false;
+    for(uint32_t step = 0; step < steps; ++step) {
+        float plant_error = setpoint - output;
+        float magnitude = fabsf(plant_error);
+        if(!(magnitude <= settings.getDivergenceLimit())) {
+            diverged = true;
+            last_outside = steps;
+            break;
+        }
+        iae += magnitude * delta_t;
+        // Excursion past the setpoint in the direction of the step; a NaN ratio (a zero setpoint) leaves the peak
+        peak = PID::Kernels::lowerBound(peak, -plant_error / setpoint);
+        if(magnitude > band) {
+            last_outside = step + 1;
+        }
+        if(step < steps / 4) {
+            head_error = PID::Kernels::lowerBound(magnitude, head_error);
+        }
+        else if(step >= steps - steps / 4) {
+            tail_error = PID::Kernels::lowerBound(magnitude, tail_error);
+        }
+
+        float error = plant_error - noise * random.normal();
+        integrated_error = PID::Kernels::integrate(integrated_error, error, delta_t, i_settings.getHasLimits(),
+                                                   i_settings.getMinLimit(), i_settings.getMaxLimit());
+        float control = PID::Kernels::proportional(error, p_settings.getGain()) +
+                        PID::Kernels::integral(integrated_error, i_settings.getGain()) +
+                        PID::Kernels::derivative(error, previous_error, delta_t, d_settings.getMinTimeStep(),
+                                                 d_settings.getGain());
+        previous_error = error;
+
+        uint32_t slot = step % (dead_time + 1);
+        delayed[slot] = control;
+        // With dead time d the plant sees the control of step - d, which sits in the next slot of the ring
+        float applied = delayed[(step + 1) % (dead_time + 1)];
+        output = decay * output + (1.0f - decay) * plant_gain * applied;
+    }
+
+    result.setOvershoot(peak);
+    result.setSettlingTime((float)last_outside * delta_t);
+    result.setIae(iae);
+    result.setDiverged(diverged);
+    result.setSettled(!diverged && last_outside < steps);
+    result.setStable(!diverged && tail_error <= 0.5f * head_error);
+}
+
+uint32_t MonteCarlo::run(const MonteCarloSettings &settings, const Base::ControlSettings &p_settings,
+                         const PID::IntegralSettings &i_settings, const PID::DerivativeSettings &d_settings,
+                         MonteCarloTrial *results, uint32_t count, uint32_t threads) {
+#if defined(CONTROLALGORITHMS_HAS_THREADS)
+    if(threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    uint32_t useful = (count + CHUNK - 1) / CHUNK;
+    threads = threads < useful ? threads : useful;
+    threads = threads < MAX_THREADS ? threads : MAX_THREADS;
+    threads = threads > 0 ? threads : 1;
+
+    std::atomic<uint32_t> next(0);
+    std::thread workers[MAX_THREADS];
+    for(uint32_t index = 1; index < threads; ++index) {
+        workers[index] = std::thread(worker, &next, &settings, &p_settings, &i_settings, &d_settings, results, count);
+    }
+    worker(&next, &settings, &p_settings, &i_settings, &d_settings, results, count);
+    for(uint32_t index = 1; index < threads; ++index) {
+        workers[index].join();
+    }
+    return threads;
+#else
+    (void)threads;
+    for(uint32_t trial = 0; trial < count; ++trial) {
+        runTrial(trial, settings, p_settings, i_settings, d_settings, results[trial]);
+    }
+    return 1;
+#endif
+}
+
+void MonteCarlo::summarize(const MonteCarloTrial *results, uint32_t count, float *scratch, MonteCarloSummary &summary) {
+    uint32_t stable = 0;
+    uint32_t settled = 0;
+    uint32_t diverged = 0;
+    for(uint32_t trial = 0; trial < count; ++trial) {
+        stable += results[trial].getStable() ? 1 : 0;
+        settled += results[trial].getSettled() ? 1 : 0;
+        diverged += results[trial].getDiverged() ? 1 : 0;
+    }
+    summary.setTrials(count);
+    summary.setStable(stable);
+    summary.setSettled(settled);
+    summary.setDiverged(diverged);
+
+    uint32_t used = 0;
+    for(uint32_t trial = 0; trial < count; ++trial) {
+        if(!results[trial].getDiverged()) {
+            scratch[used++] = results[trial].getOvershoot();
+        }
+    }
+    describe(scratch, used, summary.overshoot());
+
+    used = 0;
+    for(uint32_t trial = 0; trial < count; ++trial) {
+        if(!results[trial].getDiverged()) {
+            scratch[used++] = results[trial].getIae();
+        }
+    }
+    describe(scratch, used, summary.iae());
+
+    used = 0;
+    for(uint32_t trial = 0; trial < count; ++trial) {
+        if(results[trial].getSettled()) {
+            scratch[used++] = results[trial].getSettlingTime();
+        }
+    }
+    describe(scratch, used, summary.settlingTime());
+}
+
+}  // namespace Analysis
+
+}  // namespace ControlAlgorithms
@@ -0,0 +1,101 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Monte Carlo robustness analysis of a PID controller. Each trial draws a first order plus dead time plant and a
+ * sensor noise level, simulates a setpoint step closed around the P, I and D kernels from pidKernels.h and
+ * records overshoot, settling time, IAE and stability. Trial n draws from Philox stream n, and trials are
+ * summarized in index order afterwards, so the results are bit identical for any number of threads.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_H
+#define CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_H
+
+#include <stdint.h>
+#include <base/controlSettings.h>
+#include <pid/integralSettings.h>
+#include <pid/derivativeSettings.h>
+#include <analysis/monteCarloSettings.h>
+#include <analysis/monteCarloTrial.h>
+#include <analysis/monteCarloSummary.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class MonteCarlo {
+    public:
+        // Longest dead time that can be simulated, in steps
+        static const uint32_t MAX_DEAD_TIME = 64;
+
+        // Most worker threads used by run
+        static const uint32_t MAX_THREADS = 64;
+
+        /**
+         * Run one trial
+         * @param trial [in]: uint32_t trial index, selecting the random stream
+         * @param settings [in]: MonteCarloSettings run settings
+         * @param p_settings [in]: Base::ControlSettings proportional settings
+         * @param i_settings [in]: PID::IntegralSettings integral settings
+         * @param d_settings [in]: PID::DerivativeSettings derivative settings
+         * @param result [out]: MonteCarloTrial outcome
+         */
+        static void runTrial(uint32_t trial, const MonteCarloSettings &settings, const Base::ControlSettings &p_settings,
+                             const PID::IntegralSettings &i_settings, const PID::DerivativeSettings &d_settings,
+                             MonteCarloTrial &result);
+
+        /**
+         * Run trials [0, count). Workers take chunks of trials from a shared counter, and each trial writes only
+         * its own result. Without thread support (e.g. Arduino) the trials run on the calling thread.
+         * @param settings [in]: MonteCarloSettings run settings
+         * @param p_settings [in]: Base::ControlSettings proportional settings
+         * @param i_settings [in]: PID::IntegralSettings integral settings
+         * @param d_settings [in]: PID::DerivativeSettings derivative settings
+         * @param results [out]: MonteCarloTrial[count] outcomes, by trial index
+         * @param count [in]: uint32_t number of trials
+         * @param threads [in]: uint32_t number of threads including the caller, 0 for one per hardware thread
+         * @return uint32_t number of threads used
+         */
+        static uint32_t run(const MonteCarloSettings &settings, const Base::ControlSettings &p_settings,
+                            const PID::IntegralSettings &i_settings, const PID::DerivativeSettings &d_settings,
+                            MonteCarloTrial *results, uint32_t count, uint32_t threads);
+
+        /**
+         * Summarize trial outcomes
+         * @param results [in]: MonteCarloTrial[count] outcomes
+         * @param count [in]: uint32_t number of trials
+         * @param scratch [out]: float[count] working space for sorting
+         * @param summary [out]: MonteCarloSummary counts and distributions
+         */
+        static void summarize(const MonteCarloTrial *results, uint32_t count, float *scratch, MonteCarloSummary &summary);
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        MonteCarlo() {};
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_H
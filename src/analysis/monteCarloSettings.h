@@ -0,0 +1,128 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings of a Monte Carlo robustness run: the ranges the plant and sensor noise parameters are drawn from, the
+ * step response that is simulated, and how its result is judged. The plant is first order plus dead time,
+ * y[k + 1] = a * y[k] + (1 - a) * plant_gain * u[k - dead_time], with a = exp(-delta_t / time_constant).
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_SETTINGS_H
+#define CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_SETTINGS_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class MonteCarloSettings {
+    public:
+        MonteCarloSettings () {};
+        virtual ~MonteCarloSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: MonteCarloSettings input settings
+         */
+        void copy(const MonteCarloSettings &right) {
+            setSeed(right.getSeed());
+            setSteps(right.getSteps());
+            setDeltaT(right.getDeltaT());
+            setSetpoint(right.getSetpoint());
+            setMinPlantGain(right.getMinPlantGain());
+            setMaxPlantGain(right.getMaxPlantGain());
+            setMinTimeConstant(right.getMinTimeConstant());
+            setMaxTimeConstant(right.getMaxTimeConstant());
+            setMinDeadTime(right.getMinDeadTime());
+            setMaxDeadTime(right.getMaxDeadTime());
+            setMaxNoise(right.getMaxNoise());
+            setSettlingBand(right.getSettlingBand());
+            setDivergenceLimit(right.getDivergenceLimit());
+        }
+
+        void setSeed(uint64_t seed) { seed_ = seed; }
+        uint64_t getSeed() const { return seed_; }
+        void setSteps(uint32_t steps) { steps_ = steps; }
+        uint32_t getSteps() const { return steps_; }
+        void setDeltaT(float delta_t) { delta_t_ = delta_t; }
+        float getDeltaT() const { return delta_t_; }
+        void setSetpoint(float setpoint) { setpoint_ = setpoint; }
+        float getSetpoint() const { return setpoint_; }
+        void setMinPlantGain(float min_plant_gain) { min_plant_gain_ = min_plant_gain; }
+        float getMinPlantGain() const { return min_plant_gain_; }
+        void setMaxPlantGain(float max_plant_gain) { max_plant_gain_ = max_plant_gain; }
+        float getMaxPlantGain() const { return max_plant_gain_; }
+        void setMinTimeConstant(float min_time_constant) { min_time_constant_ = min_time_constant; }
+        float getMinTimeConstant() const { return min_time_constant_; }
+        void setMaxTimeConstant(float max_time_constant) { max_time_constant_ = max_time_constant; }
+        float getMaxTimeConstant() const { return max_time_constant_; }
+        void setMinDeadTime(uint32_t min_dead_time) { min_dead_time_ = min_dead_time; }
+        uint32_t getMinDeadTime() const { return min_dead_time_; }
+        void setMaxDeadTime(uint32_t max_dead_time) { max_dead_time_ = max_dead_time; }
+        uint32_t getMaxDeadTime() const { return max_dead_time_; }
+        void setMaxNoise(float max_noise) { max_noise_ = max_noise; }
+        float getMaxNoise() const { return max_noise_; }
+        void setSettlingBand(float settling_band) { settling_band_ = settling_band; }
+        float getSettlingBand() const { return settling_band_; }
+        void setDivergenceLimit(float divergence_limit) { divergence_limit_ = divergence_limit; }
+        float getDivergenceLimit() const { return divergence_limit_; }
+
+    private:
+        // Key of the random streams; trial n always uses stream n of this key
+        uint64_t seed_{1};
+
+        // Length of each simulated step response
+        uint32_t steps_{1000};
+        float delta_t_{0.01};
+
+        // Setpoint step applied at time zero, nonzero
+        float setpoint_{1.0};
+
+        // Plant gain is drawn uniformly from [min, max)
+        float min_plant_gain_{1.0};
+        float max_plant_gain_{1.0};
+
+        // Plant time constant is drawn uniformly from [min, max)
+        float min_time_constant_{1.0};
+        float max_time_constant_{1.0};
+
+        // Dead time in steps is drawn uniformly from [min, max], capped at MonteCarlo::MAX_DEAD_TIME
+        uint32_t min_dead_time_{0};
+        uint32_t max_dead_time_{0};
+
+        // Standard deviation of the Gaussian sensor noise is drawn uniformly from [0, max)
+        float max_noise_{0.0};
+
+        // Settled once the plant output stays within this fraction of the setpoint
+        float settling_band_{0.02};
+
+        // A trial has diverged once the plant output is further than this from the setpoint, or not finite
+        float divergence_limit_{100.0};
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_SETTINGS_H
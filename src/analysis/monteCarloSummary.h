@@ -0,0 +1,131 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Distributions of the Monte Carlo trial outcomes. Quantiles are exact (taken from the sorted values) and every
+ * sum is made in trial order, so a summary depends only on the trials and not on how they were run.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_SUMMARY_H
+#define CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_SUMMARY_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class Distribution {
+    public:
+        Distribution () {};
+        virtual ~Distribution() {};
+
+        /**
+         * Copy in
+         * @param right [in]: Distribution input
+         */
+        void copy(const Distribution &right) {
+            setCount(right.getCount());
+            setMean(right.getMean());
+            setMin(right.getMin());
+            setMedian(right.getMedian());
+            setP90(right.getP90());
+            setP99(right.getP99());
+            setMax(right.getMax());
+        }
+
+        void setCount(uint32_t count) { count_ = count; }
+        uint32_t getCount() const { return count_; }
+        void setMean(float mean) { mean_ = mean; }
+        float getMean() const { return mean_; }
+        void setMin(float min) { min_ = min; }
+        float getMin() const { return min_; }
+        void setMedian(float median) { median_ = median; }
+        float getMedian() const { return median_; }
+        void setP90(float p90) { p90_ = p90; }
+        float getP90() const { return p90_; }
+        void setP99(float p99) { p99_ = p99; }
+        float getP99() const { return p99_; }
+        void setMax(float max) { max_ = max; }
+        float getMax() const { return max_; }
+
+    private:
+        // Number of values; the statistics are zero when there are none
+        uint32_t count_{0};
+        float mean_{0.0};
+
+        // Nearest rank quantiles
+        float min_{0.0};
+        float median_{0.0};
+        float p90_{0.0};
+        float p99_{0.0};
+        float max_{0.0};
+};
+
+class MonteCarloSummary {
+    public:
+        MonteCarloSummary () {};
+        virtual ~MonteCarloSummary() {};
+
+        void setTrials(uint32_t trials) { trials_ = trials; }
+        uint32_t getTrials() const { return trials_; }
+        void setStable(uint32_t stable) { stable_ = stable; }
+        uint32_t getStable() const { return stable_; }
+        void setSettled(uint32_t settled) { settled_ = settled; }
+        uint32_t getSettled() const { return settled_; }
+        void setDiverged(uint32_t diverged) { diverged_ = diverged; }
+        uint32_t getDiverged() const { return diverged_; }
+
+        /**
+         * @return float fraction of the trials that were stable
+         */
+        float getStableFraction() const { return trials_ > 0 ? (float)stable_ / (float)trials_ : 0.0f; }
+
+        // Distributions, filled by MonteCarlo::summarize
+        Distribution &overshoot() { return overshoot_; }
+        const Distribution &overshoot() const { return overshoot_; }
+        Distribution &settlingTime() { return settling_time_; }
+        const Distribution &settlingTime() const { return settling_time_; }
+        Distribution &iae() { return iae_; }
+        const Distribution &iae() const { return iae_; }
+
+    private:
+        // Trial counts
+        uint32_t trials_{0};
+        uint32_t stable_{0};
+        uint32_t settled_{0};
+        uint32_t diverged_{0};
+
+        // Overshoot and IAE of the trials that did not diverge
+        Distribution overshoot_;
+        Distribution iae_;
+
+        // Settling time of the trials that settled
+        Distribution settling_time_;
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_SUMMARY_H
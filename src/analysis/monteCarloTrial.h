@@ -0,0 +1,112 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Outcome of one Monte Carlo trial: the plant and noise parameters that were drawn and how the step response did
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_TRIAL_H
+#define CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_TRIAL_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class MonteCarloTrial {
+    public:
+        MonteCarloTrial () {};
+        virtual ~MonteCarloTrial() {};
+
+        /**
+         * Copy in
+         * @param right [in]: MonteCarloTrial input
+         */
+        void copy(const MonteCarloTrial &right) {
+            setPlantGain(right.getPlantGain());
+            setTimeConstant(right.getTimeConstant());
+            setDeadTime(right.getDeadTime());
+            setNoise(right.getNoise());
+            setOvershoot(right.getOvershoot());
+            setSettlingTime(right.getSettlingTime());
+            setIae(right.getIae());
+            setSettled(right.getSettled());
+            setStable(right.getStable());
+            setDiverged(right.getDiverged());
+        }
+
+        void setPlantGain(float plant_gain) { plant_gain_ = plant_gain; }
+        float getPlantGain() const { return plant_gain_; }
+        void setTimeConstant(float time_constant) { time_constant_ = time_constant; }
+        float getTimeConstant() const { return time_constant_; }
+        void setDeadTime(uint32_t dead_time) { dead_time_ = dead_time; }
+        uint32_t getDeadTime() const { return dead_time_; }
+        void setNoise(float noise) { noise_ = noise; }
+        float getNoise() const { return noise_; }
+        void setOvershoot(float overshoot) { overshoot_ = overshoot; }
+        float getOvershoot() const { return overshoot_; }
+        void setSettlingTime(float settling_time) { settling_time_ = settling_time; }
+        float getSettlingTime() const { return settling_time_; }
+        void setIae(float iae) { iae_ = iae; }
+        float getIae() const { return iae_; }
+        void setSettled(bool settled) { settled_ = settled; }
+        bool getSettled() const { return settled_; }
+        void setStable(bool stable) { stable_ = stable; }
+        bool getStable() const { return stable_; }
+        void setDiverged(bool diverged) { diverged_ = diverged; }
+        bool getDiverged() const { return diverged_; }
+
+    private:
+        // Drawn plant parameters
+        float plant_gain_{0.0};
+        float time_constant_{0.0};
+        uint32_t dead_time_{0};
+
+        // Drawn sensor noise standard deviation
+        float noise_{0.0};
+
+        // Largest excursion past the setpoint as a fraction of the setpoint, zero if it never crossed
+        float overshoot_{0.0};
+
+        // Time after which the output stayed within the settling band; the whole run if it never settled
+        float settling_time_{0.0};
+
+        // Integrated absolute error of the plant output
+        float iae_{0.0};
+
+        // Output within the settling band at the end of the run
+        bool settled_{false};
+
+        // Did not diverge, and the error in the last quarter of the run is at most half the error of the first
+        bool stable_{false};
+
+        // Output left the divergence limit or stopped being finite; the simulation stops there
+        bool diverged_{false};
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_MONTE_CARLO_TRIAL_H
@@ -0,0 +1,150 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Philox4x32-10 counter based random numbers (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3").
+ * A block of four values is a pure function of a 128 bit counter and a 64 bit key, so any element of any stream
+ * can be computed directly. Giving every Monte Carlo trial its own stream makes the draws independent of which
+ * thread runs the trial and in what order.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_PHILOX_H
+#define CONTROLALGORITHMS_ANALYSIS_PHILOX_H
+
+#include <stdint.h>
+#include <math.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class Philox {
+    public:
+        /**
+         * Start a stream. Streams with different seeds or stream numbers do not overlap.
+         * @param seed [in]: uint64_t the key
+         * @param stream [in]: uint64_t the stream number, e.g. the trial index
+         */
+        Philox(uint64_t seed, uint64_t stream) {
+            key_[0] = (uint32_t)seed;
+            key_[1] = (uint32_t)(seed >> 32);
+            counter_[0] = 0;
+            counter_[1] = 0;
+            counter_[2] = (uint32_t)stream;
+            counter_[3] = (uint32_t)(stream >> 32);
+        };
+        virtual ~Philox() {};
+
+        /**
+         * One Philox4x32-10 block
+         * @param counter [in]: uint32_t[4] the counter
+         * @param key [in]: uint32_t[2] the key
+         * @param out [out]: uint32_t[4] the random bits
+         */
+        static void block(const uint32_t *counter, const uint32_t *key, uint32_t *out) {
+            uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+            uint32_t k0 = key[0], k1 = key[1];
+            for(int round = 0; round < ROUNDS; ++round) {
+                uint64_t product0 = (uint64_t)MULTIPLIER_0 * c0;
+                uint64_t product1 = (uint64_t)MULTIPLIER_1 * c2;
+                uint32_t n0 = (uint32_t)(product1 >> 32) ^ c1 ^ k0;
+                uint32_t n2 = (uint32_t)(product0 >> 32) ^ c3 ^ k1;
+                c1 = (uint32_t)product1;
+                c3 = (uint32_t)product0;
+                c0 = n0;
+                c2 = n2;
+                k0 += WEYL_0;
+                k1 += WEYL_1;
+            }
+            out[0] = c0;
+            out[1] = c1;
+            out[2] = c2;
+            out[3] = c3;
+        }
+
+        /**
+         * Next raw value of the stream
+         * @return uint32_t random bits
+         */
+        uint32_t nextBits() {
+            if(used_ == 4) {
+                block(counter_, key_, buffer_);
+                // The low 64 bits count blocks within the stream
+                if(++counter_[0] == 0) {
+                    ++counter_[1];
+                }
+                used_ = 0;
+            }
+            return buffer_[used_++];
+        }
+
+        /**
+         * @return float uniform in [min_value, max_value)
+         */
+        float uniform(float min_value, float max_value) {
+            return min_value + (max_value - min_value) * (float)(nextBits() >> 8) * (1.0f / 16777216.0f);
+        }
+
+        /**
+         * Standard normal value (Box-Muller). Values come in pairs; the second is kept for the next call.
+         * @return float normally distributed with zero mean and unit variance
+         */
+        float normal() {
+            if(has_spare_) {
+                has_spare_ = false;
+                return spare_;
+            }
+            // (0, 1] so the logarithm is finite
+            float radius_uniform = (float)((nextBits() >> 8) + 1) * (1.0f / 16777216.0f);
+            float angle = (float)(nextBits() >> 8) * (6.28318530718f / 16777216.0f);
+            float radius = sqrtf(-2.0f * logf(radius_uniform));
+            spare_ = radius * sinf(angle);
+            has_spare_ = true;
+            return radius * cosf(angle);
+        }
+
+    private:
+        static const int ROUNDS = 10;
+        static const uint32_t MULTIPLIER_0 = 0xD2511F53u;
+        static const uint32_t MULTIPLIER_1 = 0xCD9E8D57u;
+        static const uint32_t WEYL_0 = 0x9E3779B9u;
+        static const uint32_t WEYL_1 = 0xBB67AE85u;
+
+        // Block counter in words 0-1, stream number in words 2-3
+        uint32_t counter_[4];
+        uint32_t key_[2];
+
+        // Current block and how much of it has been returned
+        uint32_t buffer_[4]{};
+        uint32_t used_{4};
+
+        // Second value of the last Box-Muller pair
+        float spare_{0.0f};
+        bool has_spare_{false};
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_PHILOX_H
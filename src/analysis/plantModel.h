@@ -0,0 +1,132 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Discrete time plant model for frequency response analysis: a transfer function in z^-1 with a dead time of
+ * whole samples, G(z) = z^-delay * (b0 + b1 z^-1 + ...) / (a0 + a1 z^-1 + ...).
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_PLANT_MODEL_H
+#define CONTROLALGORITHMS_ANALYSIS_PLANT_MODEL_H
+
+#include <stdint.h>
+#include <math.h>
+#include <float.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class PlantModel {
+    public:
+        // Most coefficients of the numerator or denominator
+        static const uint32_t MAX_COEFFICIENTS = 8;
+
+        PlantModel () {};
+        virtual ~PlantModel() {};
+
+        /**
+         * Copy in
+         * @param right [in]: PlantModel input model
+         */
+        void copy(const PlantModel &right) {
+            setNumerator(right.getNumerator(), right.getNumeratorCount());
+            setDenominator(right.getDenominator(), right.getDenominatorCount());
+            setDelay(right.getDelay());
+        }
+
+        /**
+         * First order plus dead time plant sampled with a zero order hold, the plant MonteCarlo simulates:
+         * y[k + 1] = a * y[k] + (1 - a) * gain * u[k - dead_time], a = exp(-delta_t / time_constant)
+         * @param gain [in]: float static gain
+         * @param time_constant [in]: float time constant, > 0
+         * @param dead_time [in]: uint32_t dead time in samples
+         * @param delta_t [in]: float sample time
+         * @param model [out]: PlantModel the model
+         */
+        static void firstOrder(float gain, float time_constant, uint32_t dead_time, float delta_t, PlantModel &model) {
+            float decay = expf(-delta_t / (time_constant > FLT_MIN ? time_constant : FLT_MIN));
+            float numerator[] = {0.0f, gain * (1.0f - decay)};
+            float denominator[] = {1.0f, -decay};
+            model.setNumerator(numerator, 2);
+            model.setDenominator(denominator, 2);
+            model.setDelay(dead_time);
+        }
+
+        /**
+         * Set the numerator, ascending powers of z^-1
+         * @param coefficients [in]: float[count] coefficients
+         * @param count [in]: uint32_t number of coefficients
+         * @return bool false if there are more than MAX_COEFFICIENTS, and the numerator is unchanged
+         */
+        bool setNumerator(const float *coefficients, uint32_t count) {
+            if(count > MAX_COEFFICIENTS) {
+                return false;
+            }
+            for(uint32_t index = 0; index < count; ++index) {
+                numerator_[index] = coefficients[index];
+            }
+            numerator_count_ = count;
+            return true;
+        }
+        const float *getNumerator() const { return numerator_; }
+        uint32_t getNumeratorCount() const { return numerator_count_; }
+
+        /**
+         * Set the denominator, ascending powers of z^-1
+         * @param coefficients [in]: float[count] coefficients, not all zero
+         * @param count [in]: uint32_t number of coefficients
+         * @return bool false if there are more than MAX_COEFFICIENTS, and the denominator is unchanged
+         */
+        bool setDenominator(const float *coefficients, uint32_t count) {
+            if(count > MAX_COEFFICIENTS) {
+                return false;
+            }
+            for(uint32_t index = 0; index < count; ++index) {
+                denominator_[index] = coefficients[index];
+            }
+            denominator_count_ = count;
+            return true;
+        }
+        const float *getDenominator() const { return denominator_; }
+        uint32_t getDenominatorCount() const { return denominator_count_; }
+
+        void setDelay(uint32_t delay) { delay_ = delay; }
+        uint32_t getDelay() const { return delay_; }
+
+    private:
+        // Coefficients in ascending powers of z^-1; the default model is G(z) = 1
+        float numerator_[MAX_COEFFICIENTS]{1.0f};
+        uint32_t numerator_count_{1};
+        float denominator_[MAX_COEFFICIENTS]{1.0f};
+        uint32_t denominator_count_{1};
+
+        // Dead time in samples
+        uint32_t delay_{0};
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_PLANT_MODEL_H
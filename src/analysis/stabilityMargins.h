@@ -0,0 +1,97 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Classical stability margins of an open loop frequency response
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ANALYSIS_STABILITY_MARGINS_H
+#define CONTROLALGORITHMS_ANALYSIS_STABILITY_MARGINS_H
+
+#include <math.h>
+
+namespace ControlAlgorithms {
+namespace Analysis {
+
+class StabilityMargins {
+    public:
+        StabilityMargins () {};
+        virtual ~StabilityMargins() {};
+
+        /**
+         * Copy in
+         * @param right [in]: StabilityMargins input
+         */
+        void copy(const StabilityMargins &right) {
+            setGainMargin(right.getGainMargin());
+            setPhaseCrossover(right.getPhaseCrossover());
+            setPhaseMargin(right.getPhaseMargin());
+            setGainCrossover(right.getGainCrossover());
+        }
+
+        /**
+         * @return float gain margin in dB
+         */
+        float getGainMarginDb() const { return 20.0f * log10f(gain_margin_); }
+
+        /**
+         * @return bool whether the phase crosses -180 degrees within the frequencies evaluated
+         */
+        bool hasPhaseCrossover() const { return phase_crossover_ > 0.0f; }
+
+        /**
+         * @return bool whether the gain crosses one within the frequencies evaluated
+         */
+        bool hasGainCrossover() const { return gain_crossover_ > 0.0f; }
+
+        void setGainMargin(float gain_margin) { gain_margin_ = gain_margin; }
+        float getGainMargin() const { return gain_margin_; }
+        void setPhaseCrossover(float phase_crossover) { phase_crossover_ = phase_crossover; }
+        float getPhaseCrossover() const { return phase_crossover_; }
+        void setPhaseMargin(float phase_margin) { phase_margin_ = phase_margin; }
+        float getPhaseMargin() const { return phase_margin_; }
+        void setGainCrossover(float gain_crossover) { gain_crossover_ = gain_crossover; }
+        float getGainCrossover() const { return gain_crossover_; }
+
+    private:
+        // Factor the loop gain can grow by before the loop is unstable, 1 / |L| at the phase crossover; the
+        // smallest over all crossovers, infinity if there is none
+        float gain_margin_{INFINITY};
+
+        // Frequency in rad/s where the phase crosses -180 degrees, zero if there is none
+        float phase_crossover_{0.0};
+
+        // Phase lag in degrees the loop can take at the gain crossover before it is unstable; the smallest over
+        // all crossovers, infinity if there is none
+        float phase_margin_{INFINITY};
+
+        // Frequency in rad/s where |L| crosses one, zero if there is none
+        float gain_crossover_{0.0};
+};
+
+}  // namespace Analysis
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ANALYSIS_STABILITY_MARGINS_H
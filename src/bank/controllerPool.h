@@ -0,0 +1,193 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Fixed capacity pool of controllers. Controllers are created and destroyed in O(1) without touching the heap
+ * and the live controllers are always packed at the front of a single array, so iterating them is a linear
+ * walk over memory. Callers hold a PoolHandle which stays valid while its controller is alive, regardless of
+ * where compaction has moved the controller.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_BANK_CONTROLLER_POOL_H
+#define CONTROLALGORITHMS_BANK_CONTROLLER_POOL_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Bank {
+
+class PoolHandle {
+    public:
+        PoolHandle () {};
+        PoolHandle (uint16_t slot, uint16_t generation): slot_(slot), generation_(generation) {};
+
+        uint16_t getSlot() const { return slot_; }
+        uint16_t getGeneration() const { return generation_; }
+        bool isValid() const { return generation_ != 0; }
+
+    private:
+        // Slot in the pool's indirection table
+        uint16_t slot_{0};
+
+        // Generation of the slot when the handle was issued. Zero is never issued, so it marks an invalid handle.
+        uint16_t generation_{0};
+};
+
+template<typename Controller, uint16_t Capacity>
+class ControllerPool {
+    public:
+        ControllerPool() {
+            for(uint16_t slot = 0; slot < Capacity; ++slot) {
+                generation_[slot] = 1;
+                // Hand out the low slots first
+                free_slots_[slot] = Capacity - 1 - slot;
+            }
+        };
+        virtual ~ControllerPool() {};
+
+        /**
+         * Create a controller in its default state
+         * @return PoolHandle handle to the new controller, invalid if the pool is full
+         */
+        PoolHandle create() {
+            if(free_count_ == 0) {
+                return PoolHandle();
+            }
+            uint16_t slot = free_slots_[--free_count_];
+            slot_to_dense_[slot] = size_;
+            dense_to_slot_[size_] = slot;
+            ++size_;
+            return PoolHandle(slot, generation_[slot]);
+        }
+
+        /**
+         * Destroy a controller. The last live controller is moved into its place to keep the live range packed.
+         * @param handle [in]: PoolHandle handle returned from create
+         * @return bool true if the handle referred to a live controller
+         */
+        bool destroy(const PoolHandle &handle) {
+            if(!isAlive(handle)) {
+                return false;
+            }
+            uint16_t slot = handle.getSlot();
+            uint16_t dense = slot_to_dense_[slot];
+            uint16_t last = size_ - 1;
+            if(dense != last) {
+                controllers_[dense] = controllers_[last];
+                uint16_t moved_slot = dense_to_slot_[last];
+                dense_to_slot_[dense] = moved_slot;
+                slot_to_dense_[moved_slot] = dense;
+            }
+            // Leave the vacated entry in the default state for the next create
+            controllers_[last] = Controller();
+            --size_;
+
+            // Invalidate outstanding handles to this slot, skipping the reserved zero generation
+            if(++generation_[slot] == 0) {
+                generation_[slot] = 1;
+            }
+            free_slots_[free_count_++] = slot;
+            return true;
+        }
+
+        /**
+         * Destroy all controllers. Outstanding handles are invalidated.
+         */
+        void clear() {
+            while(size_ > 0) {
+                uint16_t slot = dense_to_slot_[size_ - 1];
+                destroy(PoolHandle(slot, generation_[slot]));
+            }
+        }
+
+        /**
+         * Check whether a handle refers to a live controller
+         * @param handle [in]: PoolHandle handle returned from create
+         * @return bool true if the controller is alive
+         */
+        bool isAlive(const PoolHandle &handle) const {
+            return handle.isValid() && handle.getSlot() < Capacity &&
+                   generation_[handle.getSlot()] == handle.getGeneration() &&
+                   slot_to_dense_[handle.getSlot()] < size_ &&
+                   dense_to_slot_[slot_to_dense_[handle.getSlot()]] == handle.getSlot();
+        }
+
+        /**
+         * Look up a controller. The pointer is only valid until the next create/destroy/clear.
+         * @param handle [in]: PoolHandle handle returned from create
+         * @return Controller* the controller or nullptr if the handle is stale
+         */
+        Controller *get(const PoolHandle &handle) {
+            return isAlive(handle) ? &controllers_[slot_to_dense_[handle.getSlot()]] : nullptr;
+        }
+        const Controller *get(const PoolHandle &handle) const {
+            return isAlive(handle) ? &controllers_[slot_to_dense_[handle.getSlot()]] : nullptr;
+        }
+
+        /**
+         * Handle for the controller at a position in the live range, e.g. while iterating
+         * @param index [in]: uint16_t position in [0, size())
+         * @return PoolHandle handle to the controller
+         */
+        PoolHandle handleAt(uint16_t index) const {
+            uint16_t slot = dense_to_slot_[index];
+            return PoolHandle(slot, generation_[slot]);
+        }
+
+        // Live controllers are contiguous in [begin(), end())
+        Controller *begin() { return controllers_; }
+        Controller *end() { return controllers_ + size_; }
+        const Controller *begin() const { return controllers_; }
+        const Controller *end() const { return controllers_ + size_; }
+        Controller &at(uint16_t index) { return controllers_[index]; }
+        const Controller &at(uint16_t index) const { return controllers_[index]; }
+
+        uint16_t size() const { return size_; }
+        uint16_t capacity() const { return Capacity; }
+        bool isFull() const { return free_count_ == 0; }
+
+    private:
+        // Dense storage; the live controllers are [0, size_)
+        Controller controllers_[Capacity];
+
+        // Indirection between the stable slots used by handles and the dense positions
+        uint16_t dense_to_slot_[Capacity];
+        uint16_t slot_to_dense_[Capacity]{};
+
+        // Generation per slot, bumped on destroy
+        uint16_t generation_[Capacity];
+
+        // Stack of unused slots
+        uint16_t free_slots_[Capacity];
+        uint16_t free_count_{Capacity};
+
+        // Number of live controllers
+        uint16_t size_{0};
+};
+
+}  // namespace Bank
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_BANK_CONTROLLER_POOL_H
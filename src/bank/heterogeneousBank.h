@@ -0,0 +1,244 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A bank of loops of several controller kinds. Each kind is kept in its own structure of arrays bank, e.g.
+ * PID::IntegralBank or Nonlinear::BangBangBank, and loops are numbered type sorted: the loops of the first kind,
+ * then those of the second and so on. An update therefore calls each kind's batch kernel once over a contiguous
+ * range, instead of dispatching per loop through a virtual call or a switch. The kinds are template parameters,
+ * so the dispatch is resolved at compile time.
+ *
+ * Every bank type must provide update(error, delta_t, count), reset(loop), resetAll(), getControl(loop),
+ * getControlArray() and capacity(), as the PID and nonlinear banks do.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_BANK_HETEROGENEOUS_BANK_H
+#define CONTROLALGORITHMS_BANK_HETEROGENEOUS_BANK_H
+
+#include <stddef.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Bank {
+
+template<typename... Banks>
+class HeterogeneousBank;
+
+// Bank type and accessor of a kind, by position in the template parameters
+template<size_t Kind, typename Heterogeneous>
+struct HeterogeneousBankElement;
+
+template<typename First, typename... Rest>
+struct HeterogeneousBankElement<0, HeterogeneousBank<First, Rest...>> {
+    typedef First Type;
+    static First &get(HeterogeneousBank<First, Rest...> &bank) { return bank.first_; }
+    static const First &get(const HeterogeneousBank<First, Rest...> &bank) { return bank.first_; }
+};
+
+template<size_t Kind, typename First, typename... Rest>
+struct HeterogeneousBankElement<Kind, HeterogeneousBank<First, Rest...>> {
+    typedef HeterogeneousBankElement<Kind - 1, HeterogeneousBank<Rest...>> Next;
+    typedef typename Next::Type Type;
+    static Type &get(HeterogeneousBank<First, Rest...> &bank) { return Next::get(bank.rest_); }
+    static const Type &get(const HeterogeneousBank<First, Rest...> &bank) { return Next::get(bank.rest_); }
+};
+
+// No kinds left: the end of the recursion
+template<>
+class HeterogeneousBank<> {
+    public:
+        static const size_t KINDS = 0;
+
+        bool setSize(size_t, size_t size) { return size == 0; }
+        size_t getSize(size_t) const { return 0; }
+        size_t size() const { return 0; }
+        size_t offset(size_t) const { return 0; }
+        void update(const float *, const float *) {}
+        float getControl(size_t) const { return 0.0f; }
+        void copyControl(float *) const {}
+        bool locate(size_t, size_t &, size_t &) const { return false; }
+        void reset(size_t) {}
+        void resetAll() {}
+        template<typename Visitor>
+        void forEach(Visitor &) {}
+        template<typename Visitor>
+        void forEachFrom(Visitor &, size_t, size_t) {}
+};
+
+template<typename First, typename... Rest>
+class HeterogeneousBank<First, Rest...> {
+    public:
+        // Number of controller kinds
+        static const size_t KINDS = 1 + sizeof...(Rest);
+
+        HeterogeneousBank() {};
+        virtual ~HeterogeneousBank() {};
+
+        /**
+         * The bank of one kind, e.g. to set the settings of its loops
+         * @return the bank at position Kind in the template parameters
+         */
+        template<size_t Kind>
+        typename HeterogeneousBankElement<Kind, HeterogeneousBank>::Type &getBank() {
+            return HeterogeneousBankElement<Kind, HeterogeneousBank>::get(*this);
+        }
+        template<size_t Kind>
+        const typename HeterogeneousBankElement<Kind, HeterogeneousBank>::Type &getBank() const {
+            return HeterogeneousBankElement<Kind, HeterogeneousBank>::get(*this);
+        }
+
+        /**
+         * Set the number of loops of a kind in use; they are loops [0, size) of its bank
+         * @param kind [in]: size_t kind index
+         * @param size [in]: size_t number of loops, at most the capacity of its bank
+         * @return bool false if the kind is out of range or the size exceeds the capacity
+         */
+        bool setSize(size_t kind, size_t size) {
+            if(kind > 0) {
+                return rest_.setSize(kind - 1, size);
+            }
+            if(size > first_.capacity()) {
+                return false;
+            }
+            size_ = size;
+            return true;
+        }
+
+        /**
+         * @return size_t number of loops of a kind in use
+         */
+        size_t getSize(size_t kind) const { return kind > 0 ? rest_.getSize(kind - 1) : size_; }
+
+        /**
+         * @return size_t number of loops in use over all kinds
+         */
+        size_t size() const { return size_ + rest_.size(); }
+
+        /**
+         * @return size_t type sorted index of the first loop of a kind
+         */
+        size_t offset(size_t kind) const { return kind > 0 ? size_ + rest_.offset(kind - 1) : 0; }
+
+        /**
+         * Update every loop in use with one sample each. Each kind's bank is updated once.
+         * @param error [in]: float[size()] current error signals, type sorted
+         * @param delta_t [in]: float[size()] time since the last call, type sorted
+         */
+        void update(const float *error, const float *delta_t) {
+            first_.update(error, delta_t, size_);
+            rest_.update(error + size_, delta_t + size_);
+        }
+
+        /**
+         * Control signal of one loop
+         * @param loop [in]: size_t type sorted loop index
+         * @return float the last control signal, 0 if the loop is out of range
+         */
+        float getControl(size_t loop) const { return loop < size_ ? first_.getControl(loop) : rest_.getControl(loop - size_); }
+
+        /**
+         * Copy the control signals of all loops in use
+         * @param control [out]: float[size()] control signals, type sorted
+         */
+        void copyControl(float *control) const {
+            memcpy(control, first_.getControlArray(), size_ * sizeof(float));
+            rest_.copyControl(control + size_);
+        }
+
+        /**
+         * Find the kind of a loop and its index in that kind's bank
+         * @param loop [in]: size_t type sorted loop index
+         * @param kind [out]: size_t kind index
+         * @param index [out]: size_t loop index in the kind's bank
+         * @return bool false if the loop is out of range
+         */
+        bool locate(size_t loop, size_t &kind, size_t &index) const {
+            if(loop < size_) {
+                kind = 0;
+                index = loop;
+                return true;
+            }
+            if(!rest_.locate(loop - size_, kind, index)) {
+                return false;
+            }
+            ++kind;
+            return true;
+        }
+
+        /**
+         * Reset the internal state of one loop
+         * @param loop [in]: size_t type sorted loop index
+         */
+        void reset(size_t loop) {
+            if(loop < size_) {
+                first_.reset(loop);
+                return;
+            }
+            rest_.reset(loop - size_);
+        }
+
+        /**
+         * Reset the internal state of all loops of all kinds
+         */
+        void resetAll() {
+            first_.resetAll();
+            rest_.resetAll();
+        }
+
+        /**
+         * Visit each kind's bank in order, e.g. to apply settings or collect statistics without knowing the kinds
+         * @param visitor [in]: callable as visitor(bank, kind, offset, size) for every bank type, e.g. a generic
+         *                      lambda or a struct with a templated operator(); offset is the type sorted index of
+         *                      the bank's first loop and size its number of loops in use
+         */
+        template<typename Visitor>
+        void forEach(Visitor &visitor) {
+            forEachFrom(visitor, 0, 0);
+        }
+
+    private:
+        template<size_t, typename>
+        friend struct HeterogeneousBankElement;
+        template<typename...>
+        friend class HeterogeneousBank;
+
+        template<typename Visitor>
+        void forEachFrom(Visitor &visitor, size_t kind, size_t offset) {
+            visitor(first_, kind, offset, size_);
+            rest_.forEachFrom(visitor, kind + 1, offset + size_);
+        }
+
+        // The bank of this kind and the number of its loops in use
+        First first_;
+        size_t size_{0};
+
+        // The banks of the remaining kinds
+        HeterogeneousBank<Rest...> rest_;
+};
+
+}  // namespace Bank
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_BANK_HETEROGENEOUS_BANK_H
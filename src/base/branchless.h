@@ -0,0 +1,90 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Branch free mask and select helpers. A mask is all ones when a condition holds and all zeros otherwise, so
+ * validity checks can be combined and applied with bit operations and vectorize in the batch kernels.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_BASE_BRANCHLESS_H
+#define CONTROLALGORITHMS_BASE_BRANCHLESS_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Base {
+
+class Branchless {
+    public:
+        /**
+         * @return uint32_t all ones if condition is true, else zero
+         */
+        static inline uint32_t mask(bool condition) { return 0u - (uint32_t)condition; }
+
+        /**
+         * @return uint32_t all ones if value is neither NaN nor infinite
+         */
+        static inline uint32_t finiteMask(float value) {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return mask((bits & 0x7F800000u) != 0x7F800000u);
+        }
+
+        /**
+         * @return uint32_t all ones if min_value < value <= max_value; NaN fails
+         */
+        static inline uint32_t rangeMask(float value, float min_value, float max_value) {
+            return mask((value > min_value) & (value <= max_value));
+        }
+
+        /**
+         * @return float if_set where mask is all ones, if_clear where it is zero
+         */
+        static inline float select(uint32_t mask, float if_set, float if_clear) {
+            uint32_t set_bits;
+            uint32_t clear_bits;
+            memcpy(&set_bits, &if_set, sizeof(set_bits));
+            memcpy(&clear_bits, &if_clear, sizeof(clear_bits));
+            uint32_t bits = (set_bits & mask) | (clear_bits & ~mask);
+            float result;
+            memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+
+        /**
+         * @return uint8_t flag where mask is zero, 0 where it is all ones
+         */
+        static inline uint8_t flagIfClear(uint32_t mask, uint8_t flag) { return (uint8_t)(~mask & flag); }
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Branchless() {};
+};
+
+}  // namespace Base
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_BASE_BRANCHLESS_H
@@ -0,0 +1,50 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Fault flags reported by the hardened update paths. Flags describe the most recent update only.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_BASE_CONTROL_FAULTS_H
+#define CONTROLALGORITHMS_BASE_CONTROL_FAULTS_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Base {
+
+// The input was valid
+const uint8_t FAULT_NONE = 0x00;
+
+// The error was NaN or infinite and was ignored
+const uint8_t FAULT_ERROR_NOT_FINITE = 0x01;
+
+// The time step was NaN, not positive or above the maximum time step and was ignored
+const uint8_t FAULT_DELTA_T_OUT_OF_RANGE = 0x02;
+
+}  // namespace Base
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_BASE_CONTROL_FAULTS_H
@@ -0,0 +1,132 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Numeric policies for long running accumulators such as the integral state. Inputs and outputs stay float;
+ * the policy decides how the running sum is stored and added to.
+ *     FloatPolicy:  float sum, the original behaviour and the cheapest
+ *     DoublePolicy: double sum and double multiply/add; small increments keep contributing for far longer
+ *     KahanPolicy:  float sum with a compensation term, close to double accuracy without double arithmetic,
+ *                   which suits single precision FPUs. Do not build it with -ffast-math, which removes the
+ *                   compensation.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_BASE_NUMERIC_POLICY_H
+#define CONTROLALGORITHMS_BASE_NUMERIC_POLICY_H
+
+#include <algorithm>
+
+namespace ControlAlgorithms {
+namespace Base {
+
+class FloatPolicy {
+    public:
+        class Accumulator {
+            public:
+                void setValue(float value) { sum_ = value; }
+                float getValue() const { return sum_; }
+
+                /**
+                 * Add value * delta_t to the sum
+                 */
+                void accumulate(float value, float delta_t) { sum_ = sum_ + value * delta_t; }
+
+                /**
+                 * Keep the sum within [min_limit, max_limit]
+                 */
+                void limit(float min_limit, float max_limit) { sum_ = std::min(max_limit, std::max(min_limit, sum_)); }
+
+            private:
+                float sum_{0.0};
+        };
+};
+
+class DoublePolicy {
+    public:
+        class Accumulator {
+            public:
+                void setValue(float value) { sum_ = value; }
+                float getValue() const { return (float)sum_; }
+
+                /**
+                 * Add value * delta_t to the sum
+                 */
+                void accumulate(float value, float delta_t) { sum_ = sum_ + (double)value * (double)delta_t; }
+
+                /**
+                 * Keep the sum within [min_limit, max_limit]
+                 */
+                void limit(float min_limit, float max_limit) {
+                    sum_ = std::min((double)max_limit, std::max((double)min_limit, sum_));
+                }
+
+            private:
+                double sum_{0.0};
+        };
+};
+
+class KahanPolicy {
+    public:
+        class Accumulator {
+            public:
+                void setValue(float value) {
+                    sum_ = value;
+                    compensation_ = 0.0;
+                }
+                float getValue() const { return sum_; }
+
+                /**
+                 * Add value * delta_t to the sum, carrying the low order bits lost to rounding into the next add
+                 */
+                void accumulate(float value, float delta_t) {
+                    float corrected = value * delta_t - compensation_;
+                    float sum = sum_ + corrected;
+                    compensation_ = (sum - sum_) - corrected;
+                    sum_ = sum;
+                }
+
+                /**
+                 * Keep the sum within [min_limit, max_limit]. The compensation is dropped when the limit applies.
+                 */
+                void limit(float min_limit, float max_limit) {
+                    float limited = std::min(max_limit, std::max(min_limit, sum_));
+                    if(limited != sum_) {
+                        setValue(limited);
+                    }
+                }
+
+            private:
+                // The running sum
+                float sum_{0.0};
+
+                // Rounding error of the last add, subtracted from the next one
+                float compensation_{0.0};
+        };
+};
+
+}  // namespace Base
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_BASE_NUMERIC_POLICY_H
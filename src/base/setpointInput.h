@@ -0,0 +1,84 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Input for 2-DOF control: setpoint, measurement and a feed-forward term. The base error is kept equal to
+ * setpoint - measurement, so the input also works with the controllers that only use the error.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_BASE_SETPOINT_INPUT_H
+#define CONTROLALGORITHMS_BASE_SETPOINT_INPUT_H
+
+#include <base/controlInput.h>
+
+namespace ControlAlgorithms {
+namespace Base {
+
+class SetpointInput: public ControlInput {
+    public:
+        SetpointInput () {};
+        virtual ~SetpointInput () {};
+
+        /**
+         * Copy in
+         * @param right [in]: SetpointInput input
+         */
+        void copy(const SetpointInput &right) {
+            // Super call
+            ControlInput::copy(right);
+
+            setSetpoint(right.getSetpoint());
+            setMeasurement(right.getMeasurement());
+            setFeedForward(right.getFeedForward());
+        }
+
+        void setSetpoint(float setpoint) {
+            setpoint_ = setpoint;
+            setError(setpoint_ - measurement_);
+        }
+        float getSetpoint() const { return setpoint_; }
+        void setMeasurement(float measurement) {
+            measurement_ = measurement;
+            setError(setpoint_ - measurement_);
+        }
+        float getMeasurement() const { return measurement_; }
+        void setFeedForward(float feed_forward) { feed_forward_ = feed_forward; }
+        float getFeedForward() const { return feed_forward_; }
+
+    private:
+        // The desired value
+        float setpoint_{0.0};
+
+        // The measured value
+        float measurement_{0.0};
+
+        // Precomputed feed-forward term, added to the proportional control signal
+        float feed_forward_{0.0};
+};
+
+}  // namespace Base
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_BASE_SETPOINT_INPUT_H
@@ -0,0 +1,115 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Fixed pool of equal sized blocks for coroutine frames, so tasks are created without the heap. Allocation and
+ * release are O(1). Not thread safe; the cooperative runtime only uses it from its own thread.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_COOPERATIVE_FRAME_ARENA_H
+#define CONTROLALGORITHMS_COOPERATIVE_FRAME_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Cooperative {
+
+template<size_t BlockSize, uint16_t Blocks>
+class FrameArena {
+    public:
+        // Every block must be suitably aligned for any frame
+        static const size_t ALIGNMENT = 16;
+        static_assert(BlockSize % ALIGNMENT == 0, "block size must keep blocks aligned");
+
+        FrameArena() {
+            for(uint16_t block = 0; block < Blocks; ++block) {
+                next_free_[block] = block + 1;
+            }
+        };
+        virtual ~FrameArena() {};
+
+        /**
+         * Take a block
+         * @param size [in]: size_t bytes needed
+         * @return void* the block, or nullptr if size is larger than a block or none are free
+         */
+        void *allocate(size_t size) {
+            if(size > BlockSize || free_head_ >= Blocks) {
+                ++failures_;
+                return nullptr;
+            }
+            uint16_t block = free_head_;
+            free_head_ = next_free_[block];
+            if(++used_ > peak_) {
+                peak_ = used_;
+            }
+            return &storage_[block * BlockSize];
+        }
+
+        /**
+         * Return a block taken with allocate
+         * @param memory [in]: void* the block
+         */
+        void deallocate(void *memory) {
+            if(!owns(memory)) {
+                return;
+            }
+            uint16_t block = (uint16_t)((static_cast<uint8_t *>(memory) - storage_) / BlockSize);
+            next_free_[block] = free_head_;
+            free_head_ = block;
+            --used_;
+        }
+
+        bool owns(const void *memory) const {
+            const uint8_t *bytes = static_cast<const uint8_t *>(memory);
+            return bytes >= storage_ && bytes < storage_ + sizeof(storage_);
+        }
+
+        uint16_t getUsed() const { return used_; }
+        uint16_t getPeak() const { return peak_; }
+        // Requests refused because the frame was too large or the arena was full
+        uint32_t getFailures() const { return failures_; }
+        size_t getBlockSize() const { return BlockSize; }
+        uint16_t capacity() const { return Blocks; }
+
+    private:
+        // The blocks
+        alignas(ALIGNMENT) uint8_t storage_[BlockSize * Blocks];
+
+        // Free list threaded through the block indices
+        uint16_t next_free_[Blocks];
+        uint16_t free_head_{0};
+
+        // Statistics
+        uint16_t used_{0};
+        uint16_t peak_{0};
+        uint32_t failures_{0};
+};
+
+}  // namespace Cooperative
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_COOPERATIVE_FRAME_ARENA_H
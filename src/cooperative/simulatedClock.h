@@ -0,0 +1,55 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Clock moved by hand, for running schedulers deterministically on a host. Pass now() to the pollAt functions.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_COOPERATIVE_SIMULATED_CLOCK_H
+#define CONTROLALGORITHMS_COOPERATIVE_SIMULATED_CLOCK_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Cooperative {
+
+class SimulatedClock {
+    public:
+        SimulatedClock(uint32_t start_us = 0): now_us_(start_us) {};
+        virtual ~SimulatedClock() {};
+
+        uint32_t now() const { return now_us_; }
+        void set(uint32_t now_us) { now_us_ = now_us; }
+        void advance(uint32_t delta_us) { now_us_ += delta_us; }
+
+    private:
+        // Wrapping microseconds, like Ingest::MonotonicClock
+        uint32_t now_us_;
+};
+
+}  // namespace Cooperative
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_COOPERATIVE_SIMULATED_CLOCK_H
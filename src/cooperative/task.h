@@ -0,0 +1,122 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A cooperative control task: a coroutine returning Task, started by a TaskScheduler. Frames come from a fixed
+ * FrameArena, sized by CONTROLALGORITHMS_COROUTINE_FRAME_SIZE and CONTROLALGORITHMS_COROUTINE_FRAMES, so creating
+ * a task never touches the heap; if the arena cannot hold the frame the Task is invalid. Requires C++20.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_COOPERATIVE_TASK_H
+#define CONTROLALGORITHMS_COOPERATIVE_TASK_H
+
+#include <cooperative/coroutineSupport.h>
+
+#if defined(CONTROLALGORITHMS_HAS_COROUTINES)
+
+#include <stddef.h>
+#include <coroutine>
+#include <exception>
+#include <cooperative/frameArena.h>
+
+#ifndef CONTROLALGORITHMS_COROUTINE_FRAME_SIZE
+#define CONTROLALGORITHMS_COROUTINE_FRAME_SIZE 512
+#endif
+#ifndef CONTROLALGORITHMS_COROUTINE_FRAMES
+#define CONTROLALGORITHMS_COROUTINE_FRAMES 16
+#endif
+
+namespace ControlAlgorithms {
+namespace Cooperative {
+
+typedef FrameArena<CONTROLALGORITHMS_COROUTINE_FRAME_SIZE, CONTROLALGORITHMS_COROUTINE_FRAMES> TaskFrameArena;
+
+/**
+ * The arena every Task frame is allocated from
+ * @return TaskFrameArena& the arena
+ */
+inline TaskFrameArena &taskFrameArena() {
+    static TaskFrameArena arena;
+    return arena;
+}
+
+class Task {
+    public:
+        struct promise_type {
+            Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+            // Used instead of throwing when operator new returns nullptr
+            static Task get_return_object_on_allocation_failure() { return Task(); }
+
+            // Tasks start when the scheduler first resumes them and stay suspended at the end until destroyed
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+
+            static void *operator new(size_t size) noexcept { return taskFrameArena().allocate(size); }
+            static void operator delete(void *memory) noexcept { taskFrameArena().deallocate(memory); }
+        };
+
+        Task() {};
+        Task(Task &&right): handle_(right.handle_) { right.handle_ = nullptr; }
+        Task &operator=(Task &&right) {
+            if(this != &right) {
+                destroy();
+                handle_ = right.handle_;
+                right.handle_ = nullptr;
+            }
+            return *this;
+        }
+        virtual ~Task() { destroy(); }
+
+        // False if the frame could not be allocated
+        bool isValid() const { return (bool)handle_; }
+        // True once the coroutine has returned
+        bool isDone() const { return handle_ && handle_.done(); }
+        std::coroutine_handle<> getHandle() const { return handle_; }
+
+    private:
+        explicit Task(std::coroutine_handle<promise_type> handle): handle_(handle) {};
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+
+        void destroy() {
+            if(handle_) {
+                handle_.destroy();
+                handle_ = nullptr;
+            }
+        }
+
+        // The coroutine, owned
+        std::coroutine_handle<promise_type> handle_;
+};
+
+}  // namespace Cooperative
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_HAS_COROUTINES
+
+#endif  // CONTROLALGORITHMS_COOPERATIVE_TASK_H
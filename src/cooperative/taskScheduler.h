@@ -0,0 +1,228 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Cooperative scheduler for control tasks on single core targets. Each loop is a Task that awaits its next
+ * period through a PeriodicTimer, and other work (e.g. comms) can await sleepFor or yield between updates. Timers
+ * live in a fixed TimerWheel and runnable tasks in a fixed queue, so nothing is allocated once tasks are spawned.
+ * Requires C++20.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_COOPERATIVE_TASK_SCHEDULER_H
+#define CONTROLALGORITHMS_COOPERATIVE_TASK_SCHEDULER_H
+
+#include <cooperative/coroutineSupport.h>
+
+#if defined(CONTROLALGORITHMS_HAS_COROUTINES)
+
+#include <stdint.h>
+#include <coroutine>
+#include <cooperative/task.h>
+#include <cooperative/timerWheel.h>
+#include <ingest/monotonicClock.h>
+
+namespace ControlAlgorithms {
+namespace Cooperative {
+
+template<uint16_t Tasks, uint16_t Slots = 64, uint32_t ResolutionMicros = 100>
+class TaskScheduler {
+    public:
+        TaskScheduler() {};
+        virtual ~TaskScheduler() {};
+
+        /**
+         * Set the scheduler's time. Call before spawning tasks.
+         * @param now_us [in]: uint32_t current time in microseconds
+         */
+        void startAt(uint32_t now_us) {
+            now_us_ = now_us;
+            timers_.start(now_us);
+        }
+        void start() { startAt(Ingest::MonotonicClock::nowMicros()); }
+
+        /**
+         * Make a task runnable. It first runs on the next poll. The caller keeps ownership of the Task, which
+         * must outlive the scheduler's use of it.
+         * @param task [in]: Task the task
+         * @return bool false if the task is invalid or the scheduler is full
+         */
+        bool spawn(const Task &task) {
+            return task.isValid() && !task.isDone() && makeReady(task.getHandle());
+        }
+
+        /**
+         * Fire due timers and resume every runnable task once
+         * @param now_us [in]: uint32_t current time in microseconds, e.g. from a SimulatedClock
+         * @return uint16_t number of tasks resumed
+         */
+        uint16_t pollAt(uint32_t now_us) {
+            now_us_ = now_us;
+            timers_.advance(now_us, *this);
+
+            // Only the tasks runnable now; tasks that yield again run on the next poll
+            uint16_t runnable = ready_count_;
+            for(uint16_t resumed = 0; resumed < runnable; ++resumed) {
+                std::coroutine_handle<> handle = ready_[ready_head_];
+                ready_head_ = (uint16_t)((ready_head_ + 1) % Tasks);
+                --ready_count_;
+                handle.resume();
+            }
+            return runnable;
+        }
+        uint16_t poll() { return pollAt(Ingest::MonotonicClock::nowMicros()); }
+
+        /**
+         * Time the scheduler next has work, e.g. to sleep or to move a SimulatedClock
+         * @return uint32_t the next timer expiry, or now if tasks are runnable or nothing is pending
+         */
+        uint32_t getNextWakeMicros() const {
+            uint32_t expiry = now_us_;
+            if(ready_count_ == 0 && timers_.getNextExpiry(now_us_, expiry)) {
+                return expiry;
+            }
+            return now_us_;
+        }
+
+        // Time of the current poll; what tasks see as now
+        uint32_t getNow() const { return now_us_; }
+        uint16_t getReadyCount() const { return ready_count_; }
+        uint16_t getSleepingCount() const { return timers_.size(); }
+
+        /**
+         * Suspend the calling task until a time. Continues immediately if the timers are full.
+         */
+        struct SleepAwaiter {
+            TaskScheduler &scheduler;
+            uint32_t wake_us;
+            bool await_ready() const { return (int32_t)(wake_us - scheduler.getNow()) <= 0; }
+            bool await_suspend(std::coroutine_handle<> handle) { return scheduler.wakeAt(handle, wake_us); }
+            void await_resume() const {}
+        };
+        SleepAwaiter sleepUntil(uint32_t wake_us) { return SleepAwaiter{*this, wake_us}; }
+        SleepAwaiter sleepFor(uint32_t delay_us) { return SleepAwaiter{*this, now_us_ + delay_us}; }
+
+        /**
+         * Let the other runnable tasks run, resuming on the next poll
+         */
+        struct YieldAwaiter {
+            TaskScheduler &scheduler;
+            bool await_ready() const { return false; }
+            bool await_suspend(std::coroutine_handle<> handle) { return scheduler.makeReady(handle); }
+            void await_resume() const {}
+        };
+        YieldAwaiter yield() { return YieldAwaiter{*this}; }
+
+        /**
+         * Register a suspended task to resume at a time
+         * @param handle [in]: std::coroutine_handle<> the task
+         * @param wake_us [in]: uint32_t time to resume
+         * @return bool false if the timers are full, in which case the task must not stay suspended
+         */
+        bool wakeAt(std::coroutine_handle<> handle, uint32_t wake_us) { return timers_.schedule(wake_us, handle); }
+
+        // Called by the timer wheel for each due timer
+        void operator()(const std::coroutine_handle<> &handle) { makeReady(handle); }
+
+    private:
+        bool makeReady(std::coroutine_handle<> handle) {
+            if(ready_count_ >= Tasks) {
+                return false;
+            }
+            ready_[(uint16_t)((ready_head_ + ready_count_) % Tasks)] = handle;
+            ++ready_count_;
+            return true;
+        }
+
+        // Sleeping tasks
+        TimerWheel<std::coroutine_handle<>, Slots, Tasks, ResolutionMicros> timers_;
+
+        // Runnable tasks, in order
+        std::coroutine_handle<> ready_[Tasks];
+        uint16_t ready_head_{0};
+        uint16_t ready_count_{0};
+
+        uint32_t now_us_{0};
+};
+
+template<typename Scheduler>
+class PeriodicTimer {
+    public:
+        /**
+         * @param scheduler [in]: the TaskScheduler running the task
+         * @param period_us [in]: uint32_t loop period in microseconds; zero is raised to 1, the shortest period
+         */
+        PeriodicTimer(Scheduler &scheduler, uint32_t period_us):
+            scheduler_(scheduler), period_us_(period_us > 0 ? period_us : 1), last_us_(scheduler.getNow()),
+            next_release_us_(scheduler.getNow() + period_us_) {};
+        virtual ~PeriodicTimer() {};
+
+        // Awaiting the timer suspends until the next release and returns the time step in seconds
+        bool await_ready() const { return false; }
+        bool await_suspend(std::coroutine_handle<> handle) { return scheduler_.wakeAt(handle, next_release_us_); }
+        float await_resume() {
+            uint32_t now = scheduler_.getNow();
+            int32_t lateness = (int32_t)(now - next_release_us_);
+            uint32_t missed = 0;
+            if(lateness > 0) {
+                missed = (uint32_t)lateness / period_us_;
+                if((uint32_t)lateness > max_lateness_us_) {
+                    max_lateness_us_ = (uint32_t)lateness;
+                }
+            }
+            // Missed releases are skipped rather than run back to back
+            missed_deadlines_ += missed;
+            next_release_us_ += (missed + 1) * period_us_;
+
+            float delta_t = (float)(now - last_us_) * 1.0e-6f;
+            last_us_ = now;
+            ++runs_;
+            return delta_t;
+        }
+
+        uint32_t getPeriodMicros() const { return period_us_; }
+        uint32_t getRuns() const { return runs_; }
+        uint32_t getMissedDeadlines() const { return missed_deadlines_; }
+        uint32_t getMaxLatenessMicros() const { return max_lateness_us_; }
+
+    private:
+        Scheduler &scheduler_;
+        uint32_t period_us_;
+
+        // Clock
+        uint32_t last_us_;
+        uint32_t next_release_us_;
+
+        // Statistics
+        uint32_t runs_{0};
+        uint32_t missed_deadlines_{0};
+        uint32_t max_lateness_us_{0};
+};
+
+}  // namespace Cooperative
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_HAS_COROUTINES
+
+#endif  // CONTROLALGORITHMS_COOPERATIVE_TASK_SCHEDULER_H
@@ -0,0 +1,186 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Fixed capacity hashed timer wheel. Timers hash into Slots buckets of ResolutionMicros each, so scheduling is
+ * O(1) and advancing the clock only visits the buckets that have come due. Timers further ahead than one turn
+ * of the wheel wait in their bucket until their turn comes round. Times are wrapping microseconds.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_COOPERATIVE_TIMER_WHEEL_H
+#define CONTROLALGORITHMS_COOPERATIVE_TIMER_WHEEL_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Cooperative {
+
+template<typename T, uint16_t Slots, uint16_t Capacity, uint32_t ResolutionMicros>
+class TimerWheel {
+    public:
+        static_assert(ResolutionMicros > 0, "resolution must be positive");
+
+        TimerWheel() {
+            for(uint16_t slot = 0; slot < Slots; ++slot) {
+                heads_[slot] = NONE;
+            }
+            for(uint16_t node = 0; node < Capacity; ++node) {
+                next_[node] = node + 1 < Capacity ? node + 1 : NONE;
+            }
+        };
+        virtual ~TimerWheel() {};
+
+        /**
+         * Set the wheel's time. Call before scheduling.
+         * @param now_us [in]: uint32_t current time in microseconds
+         */
+        void start(uint32_t now_us) {
+            slot_time_us_ = now_us;
+        }
+
+        /**
+         * Add a timer
+         * @param expiry_us [in]: uint32_t time the timer fires, may already have passed
+         * @param payload [in]: T value handed back when the timer fires
+         * @return bool false if the wheel is full
+         */
+        bool schedule(uint32_t expiry_us, const T &payload) {
+            if(free_ == NONE) {
+                return false;
+            }
+            uint16_t node = free_;
+            free_ = next_[node];
+
+            // Timers that are already due go into the current bucket
+            int32_t ahead = (int32_t)(expiry_us - slot_time_us_);
+            uint32_t ticks = ahead > 0 ? (uint32_t)ahead / ResolutionMicros : 0;
+            uint16_t slot = (uint16_t)((cursor_ + ticks) % Slots);
+
+            expiry_us_[node] = expiry_us;
+            payloads_[node] = payload;
+            next_[node] = heads_[slot];
+            heads_[slot] = node;
+            ++size_;
+            return true;
+        }
+
+        /**
+         * Fire every timer that is due by now_us. Timers scheduled by the callback fire on a later advance.
+         * @param now_us [in]: uint32_t current time in microseconds
+         * @param fire [in]: callable taking const T&, called once per due timer
+         * @return uint16_t number of timers fired
+         */
+        template<typename Function>
+        uint16_t advance(uint32_t now_us, Function &fire) {
+            uint16_t fired = 0;
+            // Visit each bucket at most once per call, however far the clock moved
+            for(uint16_t visited = 0; visited < Slots; ++visited) {
+                fired += fireSlot(cursor_, now_us, fire);
+                if((int32_t)(now_us - (slot_time_us_ + ResolutionMicros)) < 0) {
+                    break;
+                }
+                slot_time_us_ += ResolutionMicros;
+                cursor_ = (uint16_t)((cursor_ + 1) % Slots);
+            }
+            // After a long gap, resume from the bucket that holds now
+            if((int32_t)(now_us - (slot_time_us_ + ResolutionMicros)) >= 0) {
+                uint32_t behind = (now_us - slot_time_us_) / ResolutionMicros;
+                slot_time_us_ += behind * ResolutionMicros;
+                cursor_ = (uint16_t)((cursor_ + behind) % Slots);
+            }
+            return fired;
+        }
+
+        /**
+         * Earliest pending expiry
+         * @param now_us [in]: uint32_t current time in microseconds, the reference for wrapping
+         * @param expiry_us [out]: uint32_t earliest expiry
+         * @return bool false if no timers are pending
+         */
+        bool getNextExpiry(uint32_t now_us, uint32_t &expiry_us) const {
+            bool found = false;
+            int32_t earliest = 0;
+            for(uint16_t slot = 0; slot < Slots; ++slot) {
+                for(uint16_t node = heads_[slot]; node != NONE; node = next_[node]) {
+                    int32_t until = (int32_t)(expiry_us_[node] - now_us);
+                    if(!found || until < earliest) {
+                        earliest = until;
+                        found = true;
+                    }
+                }
+            }
+            expiry_us = now_us + (uint32_t)earliest;
+            return found;
+        }
+
+        uint16_t size() const { return size_; }
+        uint16_t capacity() const { return Capacity; }
+        bool isFull() const { return free_ == NONE; }
+
+    private:
+        static const uint16_t NONE = 0xFFFF;
+        static_assert(Capacity < NONE, "capacity must leave room for the list terminator");
+
+        template<typename Function>
+        uint16_t fireSlot(uint16_t slot, uint32_t now_us, Function &fire) {
+            uint16_t fired = 0;
+            uint16_t *link = &heads_[slot];
+            while(*link != NONE) {
+                uint16_t node = *link;
+                if((int32_t)(expiry_us_[node] - now_us) > 0) {
+                    // A later turn of the wheel
+                    link = &next_[node];
+                    continue;
+                }
+                // Unlink and free before firing, so the callback can schedule again
+                *link = next_[node];
+                next_[node] = free_;
+                free_ = node;
+                --size_;
+                fire(payloads_[node]);
+                ++fired;
+            }
+            return fired;
+        }
+
+        // Timer nodes; next_ links either a bucket or the free list
+        uint32_t expiry_us_[Capacity];
+        T payloads_[Capacity];
+        uint16_t next_[Capacity];
+        uint16_t free_{0};
+        uint16_t size_{0};
+
+        // Bucket lists
+        uint16_t heads_[Slots];
+
+        // The current bucket and the start of its time span
+        uint16_t cursor_{0};
+        uint32_t slot_time_us_{0};
+};
+
+}  // namespace Cooperative
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_COOPERATIVE_TIMER_WHEEL_H
@@ -0,0 +1,88 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched extended Kalman filtering for many independent estimators sharing one model, in the layout of
+ * KalmanBatch. The model and its Jacobians are evaluated per loop, so the loops are filtered one at a time.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_EXTENDED_KALMAN_BATCH_H
+#define CONTROLALGORITHMS_ESTIMATE_EXTENDED_KALMAN_BATCH_H
+
+#include <stddef.h>
+#include <estimate/extendedKalmanStateless.h>
+#include <estimate/kalmanBatch.h>
+#include <estimate/kalmanSettings.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<typename Model>
+class ExtendedKalmanBatch {
+    public:
+        static const size_t N = Model::STATES;
+        static const size_t M = Model::MEASUREMENTS;
+        static const size_t U = Model::CONTROLS;
+
+        /**
+         * Predict and correct every estimator
+         * @param measurement [in]: float[M * count] measurements
+         * @param control [in]: float[U * count] control inputs applied over the time step
+         * @param delta_t [in]: float[count] time steps
+         * @param available [in]: bool[count] whether each loop has a measurement, or nullptr if all do
+         * @param settings [in]: KalmanNoiseSettings noise for all loops
+         * @param estimate [in/out]: float[N * count] state estimates
+         * @param covariance [in/out]: float[N * N * count] covariances
+         * @param setpoint [in]: float[count] setpoints, or nullptr
+         * @param error [out]: float[count] setpoint - filtered value, or nullptr
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *measurement, const float *control, const float *delta_t, const bool *available,
+                           const KalmanNoiseSettings<N, M> &settings, float *estimate, float *covariance,
+                           const float *setpoint, float *error, size_t count) {
+            for(size_t loop = 0; loop < count; ++loop) {
+                float z[M];
+                float u[U];
+                for(size_t row = 0; row < M; ++row) {
+                    z[row] = measurement[row * count + loop];
+                }
+                for(size_t row = 0; row < U; ++row) {
+                    u[row] = control[row * count + loop];
+                }
+                ExtendedKalmanStateless<Model>::step(estimate + loop, covariance + loop, count, z, u, delta_t[loop],
+                                                     available == nullptr || available[loop], settings);
+            }
+            KalmanBatch<N, M, U>::writeError(estimate + settings.getOutputState() * count, setpoint, error, count);
+        }
+
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        ExtendedKalmanBatch() {};
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_EXTENDED_KALMAN_BATCH_H
@@ -0,0 +1,126 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless extended Kalman filter. The model is a class with the sizes and two static functions, which return
+ * the nonlinear prediction and measurement with their Jacobians:
+ *
+ *     struct Model {
+ *         static const size_t STATES = 2, MEASUREMENTS = 1, CONTROLS = 1;
+ *         static void predict(const float x[STATES], const float u[CONTROLS], float delta_t,
+ *                             float x_next[STATES], float jacobian[STATES][STATES]);
+ *         static void measure(const float x[STATES], float z[MEASUREMENTS], float jacobian[MEASUREMENTS][STATES]);
+ *     };
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_EXTENDED_KALMAN_STATELESS_H
+#define CONTROLALGORITHMS_ESTIMATE_EXTENDED_KALMAN_STATELESS_H
+
+#include <stddef.h>
+#include <string.h>
+#include <estimate/kalmanInput.h>
+#include <estimate/kalmanKernels.h>
+#include <estimate/kalmanOutput.h>
+#include <estimate/kalmanSettings.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<typename Model>
+class ExtendedKalmanStateless {
+    public:
+        static const size_t N = Model::STATES;
+        static const size_t M = Model::MEASUREMENTS;
+        static const size_t U = Model::CONTROLS;
+
+        /**
+         * Predict over one time step with the model and correct with the measurement, if available, using the
+         * Jacobians at the current estimate. The output is set up as for KalmanStateless.
+         * @param input [in]: KalmanInput measurement, control input, time step and the state from the last update
+         * @param settings [in]: KalmanNoiseSettings noise and output state
+         * @param out [out]: KalmanOutput the updated state and filtered controlled value; the setpoint is kept
+         */
+        static void update(const KalmanInput<N, M, U> &input, const KalmanNoiseSettings<N, M> &settings,
+                           KalmanOutput<N> &out) {
+            KalmanState<N> &state = out.getState();
+            state.copy(input.getState());
+            bool accepted = step(state.getEstimate(), &state.getCovariance()[0][0], 1, input.getMeasurement(),
+                                 input.getControl(), input.getDeltaT(), input.getMeasurementAvailable(), settings);
+            out.setCorrected(accepted);
+            out.setDeltaT(input.getDeltaT());
+            out.setMeasurement(state.getEstimate()[settings.getOutputState()]);
+        }
+
+        /**
+         * One filter step on a lane of arrays, element i at [i * stride]; shared with the batch form
+         * @param x [in/out]: float[N] state estimate
+         * @param covariance [in/out]: float[N*N] covariance, row major
+         * @param stride [in]: size_t distance between elements
+         * @param z [in]: float[M] measurement, contiguous
+         * @param u [in]: float[U] control input, contiguous
+         * @param delta_t [in]: float time step
+         * @param available [in]: bool whether there is a measurement
+         * @param settings [in]: KalmanNoiseSettings noise
+         * @return bool true if the measurement was used
+         */
+        static bool step(float *x, float *covariance, size_t stride, const float *z, const float *u, float delta_t,
+                         bool available, const KalmanNoiseSettings<N, M> &settings) {
+            typedef KalmanKernels<N, M, U, 1> Kernels;
+            float current[N];
+            float next[N];
+            float jacobian[N][N];
+            for(size_t row = 0; row < N; ++row) {
+                current[row] = x[row * stride];
+            }
+            Model::predict(current, u, delta_t, next, jacobian);
+            for(size_t row = 0; row < N; ++row) {
+                x[row * stride] = next[row];
+            }
+            Kernels::propagateCovariance(covariance, stride, 1, jacobian, settings.getProcessNoise());
+
+            bool accepted[1] = {available};
+            if(available) {
+                float predicted[M];
+                float measurement[M][N];
+                float innovation[M][1];
+                Model::measure(next, predicted, measurement);
+                for(size_t row = 0; row < M; ++row) {
+                    innovation[row][0] = z[row] - predicted[row];
+                }
+                Kernels::correct(x, covariance, innovation, stride, 1, measurement, settings.getMeasurementNoise(),
+                                 accepted);
+            }
+            return accepted[0];
+        }
+
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        ExtendedKalmanStateless() {};
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_EXTENDED_KALMAN_STATELESS_H
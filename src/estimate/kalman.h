@@ -0,0 +1,137 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Linear Kalman filter. The filtered output is a Base::SetpointInput, so getOutput() can be passed straight to a
+ * controller's update in place of a raw error.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_H
+
+#include <stddef.h>
+#include <estimate/kalmanInput.h>
+#include <estimate/kalmanOutput.h>
+#include <estimate/kalmanSettings.h>
+#include <estimate/kalmanStateless.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N, size_t M, size_t U>
+class Kalman {
+    public:
+        Kalman() {};
+        virtual ~Kalman() {};
+
+        /**
+         * Set the model and noise
+         * @param settings [in]: KalmanSettings settings
+         */
+        virtual void setSettings(const KalmanSettings<N, M, U> &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the model and noise
+         * @param settings [out]: KalmanSettings settings
+         */
+        virtual void getSettings(KalmanSettings<N, M, U> &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: KalmanOutput the internal state
+         */
+        virtual void getState(KalmanOutput<N> &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: KalmanOutput the internal state
+         */
+        virtual void setState(const KalmanOutput<N> &state) {
+            state_.copy(state);
+        }
+
+        /**
+         * Predict and correct with a measurement
+         * @param measurement [in]: float[M] measurement, or nullptr to only predict
+         * @param control [in]: float[U] control input applied over the time step
+         * @param delta_t [in]: float the time step
+         * @return KalmanOutput the filtered output, valid until the next update
+         */
+        virtual const KalmanOutput<N> &update(const float *measurement, const float *control, float delta_t) {
+            // Fill the input with state in place
+            if(measurement != nullptr) {
+                input_with_state_.setMeasurement(measurement);
+            }
+            input_with_state_.setMeasurementAvailable(measurement != nullptr);
+            input_with_state_.setControl(control);
+            input_with_state_.setDeltaT(delta_t);
+            input_with_state_.setState(state_.getState());
+
+            // Run the update
+            KalmanStateless<N, M, U>::update(input_with_state_, settings_, state_);
+            return state_;
+        }
+
+        /**
+         * Restart from a known estimate
+         * @param estimate [in]: float[N] initial estimate, or nullptr for zero
+         * @param variance [in]: float initial variance of every state
+         */
+        virtual void reset(const float *estimate, float variance) {
+            state_.getState().reset(estimate, variance);
+            state_.setCorrected(false);
+        }
+
+        virtual bool isStateful() { return true; }
+
+        /**
+         * The desired value of the output state; the output's error is setpoint - estimate
+         * @param setpoint [in]: float setpoint
+         */
+        virtual void setSetpoint(float setpoint) { state_.setSetpoint(setpoint); }
+        virtual const KalmanOutput<N> &getOutput() const { return state_; }
+        virtual const float *getEstimate() const { return state_.getState().getEstimate(); }
+
+    private:
+        // The stored settings
+        KalmanSettings<N, M, U> settings_;
+
+        // Contains all required state info and doubles as the controller input
+        KalmanOutput<N> state_;
+
+        // Used for the internal call with state
+        KalmanInput<N, M, U> input_with_state_;
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_H
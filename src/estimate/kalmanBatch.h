@@ -0,0 +1,107 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) linear Kalman filtering for many independent estimators sharing one model.
+ * Element i of a vector belongs to loop l at [i * count + l] and element (i, j) of a covariance at
+ * [(i * N + j) * count + l], so each row is a float[count] array. Loops are processed Width at a time with the
+ * matrix products vectorized across them.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_BATCH_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_BATCH_H
+
+#include <stddef.h>
+#include <estimate/kalmanKernels.h>
+#include <estimate/kalmanSettings.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N, size_t M, size_t U, size_t Width = 8>
+class KalmanBatch {
+    public:
+        /**
+         * Predict and correct every estimator. The output state row of estimate, i.e. &estimate[output * count],
+         * is the filtered controlled value of every loop; with setpoint and error, the errors for a bank are
+         * written as well.
+         * @param measurement [in]: float[M * count] measurements
+         * @param control [in]: float[U * count] control inputs applied over the time step
+         * @param available [in]: bool[count] whether each loop has a measurement, or nullptr if all do
+         * @param settings [in]: KalmanSettings model and noise for all loops
+         * @param estimate [in/out]: float[N * count] state estimates
+         * @param covariance [in/out]: float[N * N * count] covariances
+         * @param setpoint [in]: float[count] setpoints, or nullptr
+         * @param error [out]: float[count] setpoint - filtered value, or nullptr
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *measurement, const float *control, const bool *available,
+                           const KalmanSettings<N, M, U> &settings, float *estimate, float *covariance,
+                           const float *setpoint, float *error, size_t count) {
+            typedef KalmanKernels<N, M, U, Width> Kernels;
+            for(size_t offset = 0; offset < count; offset += Width) {
+                size_t lanes = count - offset < Width ? count - offset : Width;
+                float *x = estimate + offset;
+                float *p = covariance + offset;
+                Kernels::predictState(x, control + offset, count, lanes, settings.getTransition(), settings.getControl());
+                Kernels::propagateCovariance(p, count, lanes, settings.getTransition(), settings.getProcessNoise());
+
+                bool accepted[Width];
+                for(size_t lane = 0; lane < lanes; ++lane) {
+                    accepted[lane] = available == nullptr || available[offset + lane];
+                }
+                float innovation[M][Width];
+                Kernels::innovation(x, measurement + offset, count, lanes, settings.getMeasurement(), innovation);
+                Kernels::correct(x, p, innovation, count, lanes, settings.getMeasurement(),
+                                 settings.getMeasurementNoise(), accepted);
+            }
+            writeError(estimate + settings.getOutputState() * count, setpoint, error, count);
+        }
+
+        /**
+         * Error for a bank from the filtered values
+         * @param filtered [in]: float[count] filtered controlled values
+         * @param setpoint [in]: float[count] setpoints, or nullptr to skip
+         * @param error [out]: float[count] setpoint - filtered value, or nullptr to skip
+         * @param count [in]: size_t number of loops
+         */
+        static void writeError(const float *filtered, const float *setpoint, float *error, size_t count) {
+            if(setpoint == nullptr || error == nullptr) {
+                return;
+            }
+            for(size_t loop = 0; loop < count; ++loop) {
+                error[loop] = setpoint[loop] - filtered[loop];
+            }
+        }
+
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        KalmanBatch() {};
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_BATCH_H
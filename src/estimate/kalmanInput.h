@@ -0,0 +1,89 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Input for Kalman filtering: the measurements, the control inputs over the last time step and the time step
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_INPUT_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_INPUT_H
+
+#include <stddef.h>
+#include <string.h>
+#include <base/controlInput.h>
+#include <estimate/kalmanState.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N, size_t M, size_t U>
+class KalmanInput: public Base::ControlInput {
+    public:
+        KalmanInput () {};
+        virtual ~KalmanInput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: KalmanInput input
+         */
+        void copy(const KalmanInput &right) {
+            // Super call
+            Base::ControlInput::copy(right);
+
+            setMeasurement(right.getMeasurement());
+            setControl(right.getControl());
+            setMeasurementAvailable(right.getMeasurementAvailable());
+            setState(right.getState());
+        }
+
+        void setMeasurement(const float *measurement) { memcpy(measurement_, measurement, sizeof(measurement_)); }
+        const float *getMeasurement() const { return measurement_; }
+        float *getMeasurement() { return measurement_; }
+        void setControl(const float *control) { memcpy(control_, control, sizeof(control_)); }
+        const float *getControl() const { return control_; }
+        float *getControl() { return control_; }
+        void setMeasurementAvailable(bool measurement_available) { measurement_available_ = measurement_available; }
+        bool getMeasurementAvailable() const { return measurement_available_; }
+        void setState(const KalmanState<N> &state) { state_.copy(state); }
+        const KalmanState<N> &getState() const { return state_; }
+
+    private:
+        // Measurement vector z
+        float measurement_[M]{};
+
+        // Control input u applied over the last time step
+        float control_[U]{};
+
+        // False to only predict, e.g. when a sample was dropped
+        bool measurement_available_{true};
+
+        // The filter state from the last update
+        KalmanState<N> state_;
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_INPUT_H
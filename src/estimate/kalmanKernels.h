@@ -0,0 +1,291 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Fixed size Kalman filter steps, shared by the single estimator and batch forms. Persistent arrays are
+ * addressed as lanes: element i of lane l is at [i * stride + l], so one estimator uses stride 1 and a batch in
+ * structure of arrays form uses the batch size as stride and vectorizes across lanes. Temporaries live on the
+ * stack, sized by the lane width W.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_KERNELS_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_KERNELS_H
+
+#include <stddef.h>
+#include <math.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N, size_t M, size_t U, size_t W>
+class KalmanKernels {
+    public:
+        /**
+         * Linear state prediction x = F x + B u
+         * @param x [in/out]: float[N lanes] states
+         * @param u [in]: float[U lanes] control inputs
+         * @param stride [in]: size_t distance between elements of one lane
+         * @param lanes [in]: size_t lanes to update, at most W
+         * @param transition [in]: float[N][N] F
+         * @param control [in]: float[N][U] B
+         */
+        static void predictState(float *x, const float *u, size_t stride, size_t lanes, const float transition[N][N],
+                                 const float control[N][U]) {
+            float next[N][W];
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t lane = 0; lane < lanes; ++lane) {
+                    float sum = 0.0f;
+                    for(size_t column = 0; column < N; ++column) {
+                        sum += transition[row][column] * x[column * stride + lane];
+                    }
+                    for(size_t column = 0; column < U; ++column) {
+                        sum += control[row][column] * u[column * stride + lane];
+                    }
+                    next[row][lane] = sum;
+                }
+            }
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t lane = 0; lane < lanes; ++lane) {
+                    x[row * stride + lane] = next[row][lane];
+                }
+            }
+        }
+
+        /**
+         * Covariance prediction P = F P F' + Q
+         * @param covariance [in/out]: float[N*N lanes] P, row major
+         * @param stride [in]: size_t distance between elements of one lane
+         * @param lanes [in]: size_t lanes to update, at most W
+         * @param transition [in]: float[N][N] F, or its Jacobian for the extended filter
+         * @param process_noise [in]: float[N][N] Q
+         */
+        static void propagateCovariance(float *covariance, size_t stride, size_t lanes, const float transition[N][N],
+                                        const float process_noise[N][N]) {
+            float fp[N][N][W];
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = 0; column < N; ++column) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = 0.0f;
+                        for(size_t inner = 0; inner < N; ++inner) {
+                            sum += transition[row][inner] * covariance[(inner * N + column) * stride + lane];
+                        }
+                        fp[row][column][lane] = sum;
+                    }
+                }
+            }
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = row; column < N; ++column) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = process_noise[row][column];
+                        for(size_t inner = 0; inner < N; ++inner) {
+                            sum += fp[row][inner][lane] * transition[column][inner];
+                        }
+                        covariance[(row * N + column) * stride + lane] = sum;
+                        covariance[(column * N + row) * stride + lane] = sum;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Linear innovation z - H x
+         * @param x [in]: float[N lanes] states
+         * @param z [in]: float[M lanes] measurements
+         * @param stride [in]: size_t distance between elements of one lane
+         * @param lanes [in]: size_t lanes, at most W
+         * @param measurement [in]: float[M][N] H
+         * @param innovation [out]: float[M][W] innovations
+         */
+        static void innovation(const float *x, const float *z, size_t stride, size_t lanes, const float measurement[M][N],
+                               float innovation[M][W]) {
+            for(size_t row = 0; row < M; ++row) {
+                for(size_t lane = 0; lane < lanes; ++lane) {
+                    float sum = z[row * stride + lane];
+                    for(size_t column = 0; column < N; ++column) {
+                        sum -= measurement[row][column] * x[column * stride + lane];
+                    }
+                    innovation[row][lane] = sum;
+                }
+            }
+        }
+
+        /**
+         * Measurement update with the Joseph form P = (I - K H) P (I - K H)' + K R K', which keeps P symmetric and
+         * positive semi-definite in float. A lane whose innovation covariance is not positive definite, or that is
+         * not accepted on entry, gets a zero gain and keeps its prediction.
+         * @param x [in/out]: float[N lanes] states
+         * @param covariance [in/out]: float[N*N lanes] P, row major
+         * @param innovation [in]: float[M][W] innovations
+         * @param stride [in]: size_t distance between elements of one lane
+         * @param lanes [in]: size_t lanes to update, at most W
+         * @param measurement [in]: float[M][N] H, or its Jacobian for the extended filter
+         * @param measurement_noise [in]: float[M][M] R
+         * @param accepted [in/out]: bool[W] whether each lane has a measurement; cleared for lanes that were rejected
+         */
+        static void correct(float *x, float *covariance, const float innovation[M][W], size_t stride, size_t lanes,
+                            const float measurement[M][N], const float measurement_noise[M][M], bool accepted[W]) {
+            // P H'
+            float pht[N][M][W];
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = 0; column < M; ++column) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = 0.0f;
+                        for(size_t inner = 0; inner < N; ++inner) {
+                            sum += covariance[(row * N + inner) * stride + lane] * measurement[column][inner];
+                        }
+                        pht[row][column][lane] = sum;
+                    }
+                }
+            }
+
+            // Cholesky factor of S = H P H' + R, lower triangle only
+            float factor[M][M][W];
+            for(size_t column = 0; column < M; ++column) {
+                for(size_t row = column; row < M; ++row) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = measurement_noise[row][column];
+                        for(size_t inner = 0; inner < N; ++inner) {
+                            sum += measurement[row][inner] * pht[inner][column][lane];
+                        }
+                        for(size_t inner = 0; inner < column; ++inner) {
+                            sum -= factor[row][inner][lane] * factor[column][inner][lane];
+                        }
+                        if(row == column) {
+                            // NaN fails the comparison as well
+                            if(!(sum > 0.0f)) {
+                                accepted[lane] = false;
+                                sum = 1.0f;
+                            }
+                            factor[row][column][lane] = sqrtf(sum);
+                        } else {
+                            factor[row][column][lane] = sum / factor[column][column][lane];
+                        }
+                    }
+                }
+            }
+
+            // K = P H' S^-1, row by row: S k' = (P H')' by forward and back substitution
+            float gain[N][M][W];
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t lane = 0; lane < lanes; ++lane) {
+                    float solution[M];
+                    for(size_t column = 0; column < M; ++column) {
+                        float sum = pht[row][column][lane];
+                        for(size_t inner = 0; inner < column; ++inner) {
+                            sum -= factor[column][inner][lane] * solution[inner];
+                        }
+                        solution[column] = sum / factor[column][column][lane];
+                    }
+                    for(size_t column = M; column-- > 0;) {
+                        float sum = solution[column];
+                        for(size_t inner = column + 1; inner < M; ++inner) {
+                            sum -= factor[inner][column][lane] * solution[inner];
+                        }
+                        solution[column] = sum / factor[column][column][lane];
+                    }
+                    for(size_t column = 0; column < M; ++column) {
+                        gain[row][column][lane] = accepted[lane] ? solution[column] : 0.0f;
+                    }
+                }
+            }
+
+            // x = x + K y
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t lane = 0; lane < lanes; ++lane) {
+                    float sum = 0.0f;
+                    for(size_t column = 0; column < M; ++column) {
+                        sum += gain[row][column][lane] * innovation[column][lane];
+                    }
+                    x[row * stride + lane] += sum;
+                }
+            }
+
+            // (I - K H) P
+            float ikh[N][N][W];
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = 0; column < N; ++column) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = row == column ? 1.0f : 0.0f;
+                        for(size_t inner = 0; inner < M; ++inner) {
+                            sum -= gain[row][inner][lane] * measurement[inner][column];
+                        }
+                        ikh[row][column][lane] = sum;
+                    }
+                }
+            }
+            float ikhp[N][N][W];
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = 0; column < N; ++column) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = 0.0f;
+                        for(size_t inner = 0; inner < N; ++inner) {
+                            sum += ikh[row][inner][lane] * covariance[(inner * N + column) * stride + lane];
+                        }
+                        ikhp[row][column][lane] = sum;
+                    }
+                }
+            }
+
+            // K R
+            float kr[N][M][W];
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = 0; column < M; ++column) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = 0.0f;
+                        for(size_t inner = 0; inner < M; ++inner) {
+                            sum += gain[row][inner][lane] * measurement_noise[inner][column];
+                        }
+                        kr[row][column][lane] = sum;
+                    }
+                }
+            }
+
+            // P = (I - K H) P (I - K H)' + K R K', upper triangle mirrored
+            for(size_t row = 0; row < N; ++row) {
+                for(size_t column = row; column < N; ++column) {
+                    for(size_t lane = 0; lane < lanes; ++lane) {
+                        float sum = 0.0f;
+                        for(size_t inner = 0; inner < N; ++inner) {
+                            sum += ikhp[row][inner][lane] * ikh[column][inner][lane];
+                        }
+                        for(size_t inner = 0; inner < M; ++inner) {
+                            sum += kr[row][inner][lane] * gain[column][inner][lane];
+                        }
+                        covariance[(row * N + column) * stride + lane] = sum;
+                        covariance[(column * N + row) * stride + lane] = sum;
+                    }
+                }
+            }
+        }
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        KalmanKernels() {};
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_KERNELS_H
@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Output of Kalman filtering. It is a Base::SetpointInput whose measurement is the filtered controlled value, so
+ * it can be handed to any controller as its input as it is: set the setpoint once and the error follows each
+ * update.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_OUTPUT_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_OUTPUT_H
+
+#include <stddef.h>
+#include <base/setpointInput.h>
+#include <estimate/kalmanState.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N>
+class KalmanOutput: public Base::SetpointInput {
+    public:
+        KalmanOutput () {};
+        virtual ~KalmanOutput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: KalmanOutput input
+         */
+        void copy(const KalmanOutput &right) {
+            // Super call
+            Base::SetpointInput::copy(right);
+
+            setState(right.getState());
+            setCorrected(right.getCorrected());
+        }
+
+        void setState(const KalmanState<N> &state) { state_.copy(state); }
+        const KalmanState<N> &getState() const { return state_; }
+        KalmanState<N> &getState() { return state_; }
+        void setCorrected(bool corrected) { corrected_ = corrected; }
+        bool getCorrected() const { return corrected_; }
+
+    private:
+        // The filter state for the next update
+        KalmanState<N> state_;
+
+        // Whether the last update used a measurement; false if none was available or it was rejected
+        bool corrected_{false};
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_OUTPUT_H
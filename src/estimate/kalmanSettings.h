@@ -0,0 +1,114 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for Kalman filtering. KalmanNoiseSettings holds what every filter needs, the noise covariances and
+ * which state is the controlled value; KalmanSettings adds the linear model.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_SETTINGS_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_SETTINGS_H
+
+#include <stddef.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N, size_t M>
+class KalmanNoiseSettings {
+    public:
+        KalmanNoiseSettings () {};
+        virtual ~KalmanNoiseSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: KalmanNoiseSettings input settings
+         */
+        void copy(const KalmanNoiseSettings &right) {
+            memcpy(process_noise_, right.process_noise_, sizeof(process_noise_));
+            memcpy(measurement_noise_, right.measurement_noise_, sizeof(measurement_noise_));
+            setOutputState(right.getOutputState());
+        }
+
+        float (*getProcessNoise())[N] { return process_noise_; }
+        const float (*getProcessNoise() const)[N] { return process_noise_; }
+        float (*getMeasurementNoise())[M] { return measurement_noise_; }
+        const float (*getMeasurementNoise() const)[M] { return measurement_noise_; }
+        void setOutputState(size_t output_state) { output_state_ = output_state < N ? output_state : 0; }
+        size_t getOutputState() const { return output_state_; }
+
+    private:
+        // Process noise covariance Q
+        float process_noise_[N][N]{};
+
+        // Measurement noise covariance R
+        float measurement_noise_[M][M]{};
+
+        // The state passed on to the controllers as the measurement
+        size_t output_state_{0};
+};
+
+template<size_t N, size_t M, size_t U>
+class KalmanSettings: public KalmanNoiseSettings<N, M> {
+    public:
+        KalmanSettings () {};
+        virtual ~KalmanSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: KalmanSettings input settings
+         */
+        void copy(const KalmanSettings &right) {
+            // Super call
+            KalmanNoiseSettings<N, M>::copy(right);
+
+            memcpy(transition_, right.transition_, sizeof(transition_));
+            memcpy(control_, right.control_, sizeof(control_));
+            memcpy(measurement_, right.measurement_, sizeof(measurement_));
+        }
+
+        float (*getTransition())[N] { return transition_; }
+        const float (*getTransition() const)[N] { return transition_; }
+        float (*getControl())[U] { return control_; }
+        const float (*getControl() const)[U] { return control_; }
+        float (*getMeasurement())[N] { return measurement_; }
+        const float (*getMeasurement() const)[N] { return measurement_; }
+
+    private:
+        // State transition F over one time step
+        float transition_[N][N]{};
+
+        // Control input matrix B; leave zero without a known input
+        float control_[N][U]{};
+
+        // Measurement matrix H
+        float measurement_[M][N]{};
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_SETTINGS_H
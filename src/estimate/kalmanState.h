@@ -0,0 +1,86 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * State carried between Kalman filter updates: the state estimate and its covariance
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_STATE_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_STATE_H
+
+#include <stddef.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N>
+class KalmanState {
+    public:
+        KalmanState () {
+            reset(nullptr, 1.0f);
+        };
+        virtual ~KalmanState() {};
+
+        /**
+         * Copy in
+         * @param right [in]: KalmanState input
+         */
+        void copy(const KalmanState &right) {
+            memcpy(estimate_, right.estimate_, sizeof(estimate_));
+            memcpy(covariance_, right.covariance_, sizeof(covariance_));
+        }
+
+        /**
+         * Start from a known estimate with independent errors of equal variance
+         * @param estimate [in]: float[N] initial estimate, or nullptr for zero
+         * @param variance [in]: float initial variance of every state
+         */
+        void reset(const float *estimate, float variance) {
+            for(size_t row = 0; row < N; ++row) {
+                estimate_[row] = estimate != nullptr ? estimate[row] : 0.0f;
+                for(size_t column = 0; column < N; ++column) {
+                    covariance_[row][column] = row == column ? variance : 0.0f;
+                }
+            }
+        }
+
+        float *getEstimate() { return estimate_; }
+        const float *getEstimate() const { return estimate_; }
+        float (*getCovariance())[N] { return covariance_; }
+        const float (*getCovariance() const)[N] { return covariance_; }
+
+    private:
+        // State estimate x
+        float estimate_[N];
+
+        // Estimate covariance P, kept symmetric
+        float covariance_[N][N];
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_STATE_H
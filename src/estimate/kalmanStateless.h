@@ -0,0 +1,85 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless linear Kalman filter with compile time sizes: N states, M measurements and U control inputs. Each
+ * update predicts with the model and corrects with the measurement, all on fixed size arrays on the stack.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_ESTIMATE_KALMAN_STATELESS_H
+#define CONTROLALGORITHMS_ESTIMATE_KALMAN_STATELESS_H
+
+#include <stddef.h>
+#include <estimate/kalmanInput.h>
+#include <estimate/kalmanKernels.h>
+#include <estimate/kalmanOutput.h>
+#include <estimate/kalmanSettings.h>
+
+namespace ControlAlgorithms {
+namespace Estimate {
+
+template<size_t N, size_t M, size_t U>
+class KalmanStateless {
+    public:
+        /**
+         * Predict over one time step and correct with the measurement, if available. The output's measurement
+         * is set to the output state and its time step to the input's, so it is ready to be used as a controller
+         * input.
+         * @param input [in]: KalmanInput measurement, control input, time step and the state from the last update
+         * @param settings [in]: KalmanSettings model and noise
+         * @param out [out]: KalmanOutput the updated state and filtered controlled value; the setpoint is kept
+         */
+        static void update(const KalmanInput<N, M, U> &input, const KalmanSettings<N, M, U> &settings,
+                           KalmanOutput<N> &out) {
+            typedef KalmanKernels<N, M, U, 1> Kernels;
+            KalmanState<N> &state = out.getState();
+            state.copy(input.getState());
+            float *x = state.getEstimate();
+            float *covariance = &state.getCovariance()[0][0];
+
+            Kernels::predictState(x, input.getControl(), 1, 1, settings.getTransition(), settings.getControl());
+            Kernels::propagateCovariance(covariance, 1, 1, settings.getTransition(), settings.getProcessNoise());
+
+            bool accepted[1] = {input.getMeasurementAvailable()};
+            if(accepted[0]) {
+                float innovation[M][1];
+                Kernels::innovation(x, input.getMeasurement(), 1, 1, settings.getMeasurement(), innovation);
+                Kernels::correct(x, covariance, innovation, 1, 1, settings.getMeasurement(),
+                                 settings.getMeasurementNoise(), accepted);
+            }
+            out.setCorrected(accepted[0]);
+            out.setDeltaT(input.getDeltaT());
+            out.setMeasurement(x[settings.getOutputState()]);
+        }
+
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        KalmanStateless() {};
+};
+
+}  // namespace Estimate
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_ESTIMATE_KALMAN_STATELESS_H
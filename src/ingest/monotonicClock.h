@@ -0,0 +1,66 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Monotonic microsecond clock used to timestamp samples. Uses micros() with the Arduino toolchain and
+ * std::chrono::steady_clock elsewhere.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_INGEST_MONOTONIC_CLOCK_H
+#define CONTROLALGORITHMS_INGEST_MONOTONIC_CLOCK_H
+
+#include <stdint.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace ControlAlgorithms {
+namespace Ingest {
+
+class MonotonicClock {
+    public:
+        /**
+         * Current monotonic time
+         * @return uint32_t microseconds since an arbitrary epoch, wrapping at 2^32
+         */
+        static uint32_t nowMicros() {
+#if defined(ARDUINO)
+            return (uint32_t)micros();
+#else
+            return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+    private:
+        // Private constructor to ensure only the static functions are used.
+        MonotonicClock() {};
+};
+
+}  // namespace Ingest
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_INGEST_MONOTONIC_CLOCK_H
@@ -0,0 +1,116 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Bounded lock-free multi-producer single-consumer queue. Producers claim a cell with a compare-and-swap on
+ * the tail and publish it through a per-cell sequence number, so a slow producer never blocks the others and
+ * the consumer never takes a lock. Storage is fixed at compile time.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_INGEST_MPSC_QUEUE_H
+#define CONTROLALGORITHMS_INGEST_MPSC_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+namespace ControlAlgorithms {
+namespace Ingest {
+
+template<typename T, uint32_t Capacity>
+class MpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MpscQueue capacity must be a power of two");
+
+    public:
+        MpscQueue() {
+            for(uint32_t i = 0; i < Capacity; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        };
+        virtual ~MpscQueue() {};
+
+        /**
+         * Add an item. Safe to call from any number of threads.
+         * @param item [in]: T the item to add
+         * @return bool false if the queue is full
+         */
+        bool push(const T &item) {
+            uint32_t position = tail_.load(std::memory_order_relaxed);
+            for(;;) {
+                Cell &cell = cells_[position & (Capacity - 1)];
+                uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+                int32_t difference = (int32_t)(sequence - position);
+                if(difference == 0) {
+                    if(tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        cell.item = item;
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if(difference < 0) {
+                    return false;
+                } else {
+                    position = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * Remove the oldest item. Only one thread may consume.
+         * @param item [out]: T the removed item
+         * @return bool false if the queue is empty
+         */
+        bool pop(T &item) {
+            Cell &cell = cells_[head_ & (Capacity - 1)];
+            uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if((int32_t)(sequence - (head_ + 1)) < 0) {
+                return false;
+            }
+            item = cell.item;
+            cell.sequence.store(head_ + Capacity, std::memory_order_release);
+            ++head_;
+            return true;
+        }
+
+        uint32_t capacity() const { return Capacity; }
+
+    private:
+        struct Cell {
+            std::atomic<uint32_t> sequence;
+            T item;
+        };
+
+        // The ring of cells
+        Cell cells_[Capacity];
+
+        // Next position producers claim
+        std::atomic<uint32_t> tail_{0};
+
+        // Next position the consumer reads; only touched by the consumer
+        uint32_t head_{0};
+};
+
+}  // namespace Ingest
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_INGEST_MPSC_QUEUE_H
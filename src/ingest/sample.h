@@ -0,0 +1,64 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A single timestamped error sample for one control loop
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_INGEST_SAMPLE_H
+#define CONTROLALGORITHMS_INGEST_SAMPLE_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Ingest {
+
+class Sample {
+    public:
+        Sample () {};
+        Sample (uint32_t loop, float error, uint32_t timestamp_us): loop_(loop), error_(error), timestamp_us_(timestamp_us) {};
+
+        void setLoop(uint32_t loop) { loop_ = loop; }
+        uint32_t getLoop() const { return loop_; }
+        void setError(float error) { error_ = error; }
+        float getError() const { return error_; }
+        void setTimestamp(uint32_t timestamp_us) { timestamp_us_ = timestamp_us; }
+        uint32_t getTimestamp() const { return timestamp_us_; }
+
+    private:
+        // The loop the sample belongs to
+        uint32_t loop_{0};
+
+        // The error signal
+        float error_{0.0};
+
+        // Monotonic time the sample was taken in microseconds. Wraps; only differences are used.
+        uint32_t timestamp_us_{0};
+};
+
+}  // namespace Ingest
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_INGEST_SAMPLE_H
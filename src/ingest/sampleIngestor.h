@@ -0,0 +1,206 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Asynchronous sample ingestion for banks of controllers. Producers on any thread submit timestamped error
+ * samples through a lock-free queue; the control thread drains a bounded number of them per dispatch, computes
+ * each loop's time step from the monotonic timestamps and hands them to the banks as one indexed batch.
+ * This replaces the per-caller millis() bookkeeping used to fill Base::ControlInput::delta_t.
+ *
+ * A loop's first sample (and its first after resetLoop) is not dispatched: it has no previous timestamp, so there
+ * is no time step to give the controllers. It only starts the loop's clock and is counted by getStartCount. A
+ * producer that needs every error applied should submit one priming sample per loop first.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_INGEST_SAMPLE_INGESTOR_H
+#define CONTROLALGORITHMS_INGEST_SAMPLE_INGESTOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <ingest/sample.h>
+#include <ingest/mpscQueue.h>
+#include <ingest/monotonicClock.h>
+#include <timing/timingStats.h>
+
+namespace ControlAlgorithms {
+namespace Ingest {
+
+template<uint32_t Loops, uint32_t QueueCapacity, uint32_t MaxBatch>
+class SampleIngestor {
+    public:
+        SampleIngestor() {
+            for(uint32_t loop = 0; loop < Loops; ++loop) {
+                resetLoop(loop);
+            }
+        };
+        virtual ~SampleIngestor() {};
+
+        /**
+         * Submit a sample stamped with the current monotonic time. Safe to call from any thread.
+         * @param loop [in]: uint32_t loop the sample belongs to
+         * @param error [in]: float error signal
+         * @return bool false if the loop is out of range or the queue is full
+         */
+        bool submit(uint32_t loop, float error) {
+            return submit(Sample(loop, error, MonotonicClock::nowMicros()));
+        }
+
+        /**
+         * Submit a sample stamped by the producer. Safe to call from any thread.
+         * @param sample [in]: Sample the sample
+         * @return bool false if the loop is out of range or the queue is full
+         */
+        bool submit(const Sample &sample) {
+            if(sample.getLoop() >= Loops || !queue_.push(sample)) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Drain up to MaxBatch samples and update every target with them. Call from the control thread only.
+         * Targets provide updateIndexed(const uint32_t *loops, const float *error, const float *delta_t, size_t count),
+         * e.g. PID::IntegralBank. The first sample of a loop only starts its clock and is not dispatched, since it
+         * has no time step; see getStartCount.
+         * @param targets [in/out]: banks to update with the same samples
+         * @return size_t number of samples dispatched
+         */
+        template<typename... Targets>
+        size_t dispatch(Targets &... targets) {
+            return dispatchAt(MonotonicClock::nowMicros(), targets...);
+        }
+
+        /**
+         * As dispatch, with the current time supplied by the caller (used for latency tracking only)
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         * @param targets [in/out]: banks to update with the same samples
+         * @return size_t number of samples dispatched
+         */
+        template<typename... Targets>
+        size_t dispatchAt(uint32_t now_us, Targets &... targets) {
+            size_t count = 0;
+            Sample sample;
+            for(uint32_t popped = 0; popped < MaxBatch && queue_.pop(sample); ++popped) {
+                uint32_t loop = sample.getLoop();
+                uint32_t timestamp = sample.getTimestamp();
+
+                uint32_t latency = now_us - timestamp;
+                // A producer stamping after now_us was read gives a small negative latency; count it as zero
+                latency = (int32_t)latency > 0 ? latency : 0;
+                max_latency_us_ = latency > max_latency_us_ ? latency : max_latency_us_;
+                if(latency_stats_ != nullptr) {
+                    latency_stats_->record(latency);
+                }
+
+                if(!started_[loop]) {
+                    started_[loop] = 1;
+                    last_timestamp_[loop] = timestamp;
+                    ++starts_;
+                    continue;
+                }
+                int32_t elapsed = (int32_t)(timestamp - last_timestamp_[loop]);
+                if(elapsed <= 0) {
+                    // Out of order or duplicate; it would produce a zero or negative time step
+                    ++stale_;
+                    continue;
+                }
+                last_timestamp_[loop] = timestamp;
+
+                loops_[count] = loop;
+                errors_[count] = sample.getError();
+                delta_ts_[count] = (float)elapsed * 1.0e-6f;
+                ++count;
+            }
+            if(count > 0) {
+                int expand[] = {0, (targets.updateIndexed(loops_, errors_, delta_ts_, count), 0)...};
+                (void)expand;
+            }
+            return count;
+        }
+
+        /**
+         * Restart a loop's clock, e.g. after resetting its controllers
+         * @param loop [in]: uint32_t loop index
+         */
+        void resetLoop(uint32_t loop) {
+            started_[loop] = 0;
+            last_timestamp_[loop] = 0;
+        }
+
+        /**
+         * Record the latency of every dispatched sample, from its timestamp to the dispatch, e.g. for percentiles.
+         * Called from the control thread only.
+         * @param stats [in]: Timing::TimingStats* histogram to add to, nullptr to stop
+         */
+        void setLatencyStats(Timing::TimingStats *stats) { latency_stats_ = stats; }
+
+        /**
+         * Clear the statistics counters
+         */
+        void resetStatistics() {
+            dropped_.store(0, std::memory_order_relaxed);
+            stale_ = 0;
+            starts_ = 0;
+            max_latency_us_ = 0;
+        }
+
+        // Samples rejected by submit
+        uint32_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+        // Samples discarded because their timestamp did not advance
+        uint32_t getStaleCount() const { return stale_; }
+        // Samples that only started a loop's clock and were not dispatched
+        uint32_t getStartCount() const { return starts_; }
+        // Longest time from a sample's timestamp to its dispatch
+        uint32_t getMaxLatencyMicros() const { return max_latency_us_; }
+
+    private:
+        // Samples waiting for dispatch
+        MpscQueue<Sample, QueueCapacity> queue_;
+
+        // Per loop clock
+        uint32_t last_timestamp_[Loops];
+        uint8_t started_[Loops];
+
+        // The batch handed to the targets
+        uint32_t loops_[MaxBatch];
+        float errors_[MaxBatch];
+        float delta_ts_[MaxBatch];
+
+        // Statistics
+        std::atomic<uint32_t> dropped_{0};
+        uint32_t stale_{0};
+        uint32_t starts_{0};
+        uint32_t max_latency_us_{0};
+
+        // Optional latency histogram
+        Timing::TimingStats *latency_stats_{nullptr};
+};
+
+}  // namespace Ingest
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_INGEST_SAMPLE_INGESTOR_H
@@ -0,0 +1,70 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF) used to protect link frames. It catches every
+ * single burst error up to 16 bits, which a sum based checksum does not on a noisy serial line.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_LINK_CRC16_H
+#define CONTROLALGORITHMS_LINK_CRC16_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Link {
+
+// Initial value of a CRC
+const uint16_t CRC16_INITIAL = 0xFFFF;
+
+class Crc16 {
+    public:
+        /**
+         * Continue a CRC over more bytes, one table lookup per byte
+         * @param crc [in]: uint16_t CRC so far, CRC16_INITIAL to start
+         * @param data [in]: const void* bytes
+         * @param size [in]: size_t number of bytes
+         * @return uint16_t the updated CRC
+         */
+        static uint16_t update(uint16_t crc, const void *data, size_t size);
+
+        /**
+         * CRC of a byte range
+         * @param data [in]: const void* bytes
+         * @param size [in]: size_t number of bytes
+         * @return uint16_t the CRC
+         */
+        static uint16_t compute(const void *data, size_t size) { return update(CRC16_INITIAL, data, size); }
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Crc16() {};
+};
+
+}  // namespace Link
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_LINK_CRC16_H
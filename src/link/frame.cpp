@@ -0,0 +1,147 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Binary link frames
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "frame.h"
+#include <link/crc16.h>
+
+// Headers and values are copied to and from the wire as they are in memory
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "link frames are little endian"
+#endif
+
+namespace ControlAlgorithms {
+
+namespace Link {
+
+static_assert(sizeof(FrameHeader) == FRAME_HEADER_SIZE, "FrameHeader is the wire header");
+static_assert(sizeof(BlockHeader) == BLOCK_HEADER_SIZE, "BlockHeader is the wire block header");
+static_assert(sizeof(SettingRecord) == SETTING_RECORD_SIZE, "SettingRecord is the wire record");
+
+namespace {
+
+// Header bytes covered by the header CRC
+const size_t HEADER_CRC_OFFSET = 6;
+
+uint16_t readCrc(const uint8_t *data) {
+    uint16_t crc;
+    memcpy(&crc, data, sizeof(crc));
+    return crc;
+}
+
+// Offset of the next byte that could start a frame, or size if none
+size_t findSync(const uint8_t *data, size_t size) {
+    for(size_t offset = 0; offset < size; ++offset) {
+        if(data[offset] == FRAME_SYNC_0 && (offset + 1 == size || data[offset + 1] == FRAME_SYNC_1)) {
+            return offset;
+        }
+    }
+    return size;
+}
+
+}  // namespace
+
+uint32_t Frame::channelCount(uint8_t type) {
+    switch(type) {
+        case FRAME_INPUT: return 2;
+        case FRAME_OUTPUT: return 1;
+        case FRAME_TELEMETRY: return 2;
+        default: return 0;
+    }
+}
+
+int Frame::parse(const uint8_t *data, size_t size, size_t max_payload, FrameView &view, size_t &consumed) {
+    consumed = findSync(data, size);
+    if(consumed > 0) {
+        return PARSE_SKIP;
+    }
+    if(size < FRAME_HEADER_SIZE) {
+        return PARSE_NEED_MORE;
+    }
+
+    FrameHeader header;
+    memcpy(&header, data, sizeof(header));
+    // On a bad header only the sync byte is dropped, in case a real frame starts inside it
+    consumed = 1;
+    if(header.header_crc != Crc16::compute(data, HEADER_CRC_OFFSET) || header.payload_size > max_payload) {
+        return PARSE_SKIP;
+    }
+    uint32_t channels = channelCount(header.type);
+    bool valid_size;
+    if(channels > 0) {
+        BlockHeader block;
+        valid_size = header.payload_size >= BLOCK_HEADER_SIZE;
+        if(valid_size && size >= FRAME_HEADER_SIZE + BLOCK_HEADER_SIZE) {
+            memcpy(&block, data + FRAME_HEADER_SIZE, sizeof(block));
+            valid_size = header.payload_size == BLOCK_HEADER_SIZE + (size_t)channels * block.count * sizeof(float);
+        }
+    }
+    else {
+        valid_size = header.type == FRAME_SETTINGS && header.payload_size % SETTING_RECORD_SIZE == 0;
+    }
+    if(!valid_size) {
+        return PARSE_SKIP;
+    }
+
+    size_t frame_size = frameSize(header.payload_size);
+    if(size < frame_size) {
+        consumed = 0;
+        return PARSE_NEED_MORE;
+    }
+    if(readCrc(data + FRAME_HEADER_SIZE + header.payload_size) !=
+       Crc16::compute(data + FRAME_HEADER_SIZE, header.payload_size)) {
+        return PARSE_SKIP;
+    }
+    view.set(data);
+    consumed = frame_size;
+    return PARSE_FRAME;
+}
+
+void Frame::writeHeader(uint8_t type, uint8_t sequence, uint16_t payload_size, uint8_t *frame) {
+    FrameHeader header;
+    header.sync[0] = FRAME_SYNC_0;
+    header.sync[1] = FRAME_SYNC_1;
+    header.type = type;
+    header.sequence = sequence;
+    header.payload_size = payload_size;
+    memcpy(frame, &header, HEADER_CRC_OFFSET);
+    header.header_crc = Crc16::compute(frame, HEADER_CRC_OFFSET);
+    memcpy(frame, &header, sizeof(header));
+}
+
+size_t Frame::finish(uint8_t *frame) {
+    FrameHeader header;
+    memcpy(&header, frame, sizeof(header));
+    uint16_t crc = Crc16::compute(frame + FRAME_HEADER_SIZE, header.payload_size);
+    memcpy(frame + FRAME_HEADER_SIZE + header.payload_size, &crc, sizeof(crc));
+    return frameSize(header.payload_size);
+}
+
+}  // namespace Link
+
+}  // namespace ControlAlgorithms
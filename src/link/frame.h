@@ -0,0 +1,232 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Binary frames for controller I/O and settings over a serial link, replacing one line of text per value.
+ *
+ * Frame layout (little endian, no alignment required):
+ *     FrameHeader (8 bytes): sync 0xA5 0x5A, type, sequence, payload size, CRC of the first 6 header bytes
+ *     payload
+ *     CRC of the payload (2 bytes)
+ * Block frames (FRAME_INPUT, FRAME_OUTPUT, FRAME_TELEMETRY) carry one sample of a contiguous range of loops:
+ *     BlockHeader (8 bytes): timestamp, first loop, count
+ *     one float array of count values per channel, in the same structure of arrays form as the banks
+ * FRAME_SETTINGS carries SettingRecord entries (8 bytes each).
+ *
+ * The header CRC lets a receiver reject a corrupted length at once instead of waiting for a frame that never
+ * ends. Several frames can be written back to back and sent in one write. Frames are decoded in place: a
+ * FrameView points into the receive buffer and reads the channels from there.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_LINK_FRAME_H
+#define CONTROLALGORITHMS_LINK_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Link {
+
+const uint8_t FRAME_SYNC_0 = 0xA5;
+const uint8_t FRAME_SYNC_1 = 0x5A;
+
+// Frame types; block channels in order
+// error, delta_t: samples for the controllers
+const uint8_t FRAME_INPUT = 1;
+// control: controller outputs
+const uint8_t FRAME_OUTPUT = 2;
+// error, control: what the controllers saw and did
+const uint8_t FRAME_TELEMETRY = 3;
+// SettingRecord entries
+const uint8_t FRAME_SETTINGS = 4;
+
+// Settings a SettingRecord can change
+const uint8_t SETTING_PROPORTIONAL_GAIN = 1;
+const uint8_t SETTING_INTEGRAL_GAIN = 2;
+const uint8_t SETTING_DERIVATIVE_GAIN = 3;
+const uint8_t SETTING_SETPOINT = 4;
+
+const size_t FRAME_HEADER_SIZE = 8;
+const size_t FRAME_CRC_SIZE = 2;
+const size_t BLOCK_HEADER_SIZE = 8;
+const size_t SETTING_RECORD_SIZE = 8;
+
+// Largest payload a sender produces
+const size_t FRAME_MAX_PAYLOAD = 4096;
+
+// Results of Frame::parse
+const int PARSE_FRAME = 0;
+const int PARSE_NEED_MORE = 1;
+const int PARSE_SKIP = 2;
+
+struct FrameHeader {
+    uint8_t sync[2];
+    // FRAME_INPUT, FRAME_OUTPUT, FRAME_TELEMETRY or FRAME_SETTINGS
+    uint8_t type;
+    // Per sender, incremented by every frame so the receiver can count lost frames
+    uint8_t sequence;
+    uint16_t payload_size;
+    // Crc16 of the fields above
+    uint16_t header_crc;
+};
+
+struct BlockHeader {
+    // Sender clock, e.g. microseconds
+    uint32_t timestamp;
+    uint16_t first_loop;
+    uint16_t count;
+};
+
+struct SettingRecord {
+    uint16_t loop;
+    // SETTING_PROPORTIONAL_GAIN, ...
+    uint8_t parameter;
+    uint8_t reserved;
+    float value;
+};
+
+class FrameView {
+    public:
+        FrameView () {};
+        virtual ~FrameView() {};
+
+        /**
+         * Point the view at a frame that passed Frame::parse
+         * @param frame [in]: const uint8_t* start of the frame
+         */
+        void set(const uint8_t *frame) {
+            memcpy(&header_, frame, sizeof(header_));
+            payload_ = frame + FRAME_HEADER_SIZE;
+            if(isBlock()) {
+                memcpy(&block_, payload_, sizeof(block_));
+            }
+        }
+
+        uint8_t getType() const { return header_.type; }
+        uint8_t getSequence() const { return header_.sequence; }
+        const uint8_t *getPayload() const { return payload_; }
+        uint16_t getPayloadSize() const { return header_.payload_size; }
+        bool isBlock() const {
+            return header_.type == FRAME_INPUT || header_.type == FRAME_OUTPUT || header_.type == FRAME_TELEMETRY;
+        }
+
+        // Block frames
+        uint32_t getTimestamp() const { return block_.timestamp; }
+        uint16_t getFirstLoop() const { return block_.first_loop; }
+        uint16_t getCount() const { return block_.count; }
+
+        /**
+         * A channel in place; it may not be aligned for float access, so read it with getValue or copyChannel
+         * @param channel [in]: uint32_t channel index for the frame type
+         * @return const uint8_t* first byte of the channel
+         */
+        const uint8_t *getChannel(uint32_t channel) const {
+            return payload_ + BLOCK_HEADER_SIZE + (size_t)channel * block_.count * sizeof(float);
+        }
+
+        float getValue(uint32_t channel, uint32_t index) const {
+            float value;
+            memcpy(&value, getChannel(channel) + index * sizeof(float), sizeof(float));
+            return value;
+        }
+
+        /**
+         * Copy a channel out, e.g. straight into a bank's error array
+         * @param channel [in]: uint32_t channel index for the frame type
+         * @param values [out]: float[getCount()] the values
+         */
+        void copyChannel(uint32_t channel, float *values) const {
+            memcpy(values, getChannel(channel), (size_t)block_.count * sizeof(float));
+        }
+
+        // Settings frames
+        uint32_t getSettingCount() const { return header_.payload_size / SETTING_RECORD_SIZE; }
+        void getSetting(uint32_t index, SettingRecord &record) const {
+            memcpy(&record, payload_ + (size_t)index * SETTING_RECORD_SIZE, sizeof(record));
+        }
+
+    private:
+        // Copies of the headers, the channels and records are read in place
+        FrameHeader header_{};
+        BlockHeader block_{};
+
+        // Payload within the receive buffer
+        const uint8_t *payload_{nullptr};
+};
+
+class Frame {
+    public:
+        /**
+         * Number of float channels of a block frame type
+         * @param type [in]: uint8_t frame type
+         * @return uint32_t channels, 0 if the type is not a block frame
+         */
+        static uint32_t channelCount(uint8_t type);
+
+        /**
+         * Bytes of a frame on the wire
+         * @param payload_size [in]: size_t payload bytes
+         * @return size_t frame bytes
+         */
+        static size_t frameSize(size_t payload_size) { return FRAME_HEADER_SIZE + payload_size + FRAME_CRC_SIZE; }
+
+        /**
+         * Look for a frame at the start of received bytes. Bytes that cannot start a valid frame, and frames that
+         * fail a CRC, are reported as PARSE_SKIP so the caller drops them and tries again.
+         * @param data [in]: const uint8_t* received bytes
+         * @param size [in]: size_t number of bytes
+         * @param max_payload [in]: size_t largest payload accepted, e.g. what the receive buffer can hold
+         * @param view [out]: FrameView the frame, if PARSE_FRAME
+         * @param consumed [out]: size_t bytes to drop: the frame for PARSE_FRAME, the garbage for PARSE_SKIP
+         * @return int PARSE_FRAME, PARSE_NEED_MORE or PARSE_SKIP
+         */
+        static int parse(const uint8_t *data, size_t size, size_t max_payload, FrameView &view, size_t &consumed);
+
+        /**
+         * Write a frame header, leaving the payload CRC to finish
+         * @param type [in]: uint8_t frame type
+         * @param sequence [in]: uint8_t sender sequence number
+         * @param payload_size [in]: uint16_t payload bytes
+         * @param frame [out]: uint8_t* start of the frame
+         */
+        static void writeHeader(uint8_t type, uint8_t sequence, uint16_t payload_size, uint8_t *frame);
+
+        /**
+         * Write the payload CRC after the payload
+         * @param frame [in/out]: uint8_t* start of a frame with header and payload written
+         * @return size_t frame bytes
+         */
+        static size_t finish(uint8_t *frame);
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Frame() {};
+};
+
+}  // namespace Link
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_LINK_FRAME_H
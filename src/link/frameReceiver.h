@@ -0,0 +1,135 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Receive buffer that frames link bytes. Bytes are read straight into the buffer (writePointer/commit) and frames
+ * are decoded in place, so a frame is never copied between the read and the FrameView. Garbage and frames that
+ * fail a CRC are dropped and counted, and the receiver resynchronizes on the next sync bytes.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_LINK_FRAME_RECEIVER_H
+#define CONTROLALGORITHMS_LINK_FRAME_RECEIVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <link/frame.h>
+
+namespace ControlAlgorithms {
+namespace Link {
+
+template<size_t Capacity>
+class FrameReceiver {
+    public:
+        FrameReceiver() {};
+        virtual ~FrameReceiver() {};
+
+        /**
+         * Where to read new bytes to. Unparsed bytes are moved to the front first, so all the free space is
+         * contiguous.
+         * @return uint8_t* free space of writeSpace() bytes
+         */
+        uint8_t *writePointer() {
+            if(begin_ > 0) {
+                memmove(buffer_, buffer_ + begin_, end_ - begin_);
+                end_ -= begin_;
+                begin_ = 0;
+            }
+            return buffer_ + end_;
+        }
+        size_t writeSpace() const { return Capacity - end_ + begin_; }
+
+        /**
+         * Add bytes read to writePointer()
+         * @param size [in]: size_t number of bytes read
+         */
+        void commit(size_t size) { end_ += size; }
+
+        /**
+         * Copy bytes in, for sources that cannot read into writePointer() directly
+         * @param data [in]: const uint8_t* bytes
+         * @param size [in]: size_t number of bytes
+         * @return size_t bytes taken, less than size if the buffer is full
+         */
+        size_t push(const uint8_t *data, size_t size) {
+            uint8_t *destination = writePointer();
+            size_t taken = size < writeSpace() ? size : writeSpace();
+            memcpy(destination, data, taken);
+            commit(taken);
+            return taken;
+        }
+
+        /**
+         * Next complete frame. The view points into the buffer and is valid until the next writePointer or push.
+         * @param view [out]: FrameView the frame
+         * @return bool false if no complete frame has been received yet
+         */
+        bool next(FrameView &view) {
+            for(;;) {
+                size_t consumed = 0;
+                int result = Frame::parse(buffer_ + begin_, end_ - begin_, MAX_PAYLOAD, view, consumed);
+                begin_ += consumed;
+                if(result == PARSE_FRAME) {
+                    // A gap in the sender's sequence numbers means frames were lost
+                    if(frames_ > 0) {
+                        lost_frames_ += (uint8_t)(view.getSequence() - expected_sequence_);
+                    }
+                    expected_sequence_ = (uint8_t)(view.getSequence() + 1);
+                    ++frames_;
+                    return true;
+                }
+                if(result == PARSE_NEED_MORE) {
+                    return false;
+                }
+                dropped_bytes_ += consumed;
+            }
+        }
+
+        uint32_t getFrames() const { return frames_; }
+        uint32_t getLostFrames() const { return lost_frames_; }
+        uint32_t getDroppedBytes() const { return dropped_bytes_; }
+
+    private:
+        // Largest payload that fits the buffer
+        static const size_t MAX_PAYLOAD = Capacity - FRAME_HEADER_SIZE - FRAME_CRC_SIZE;
+
+        // Unparsed bytes are [begin_, end_)
+        uint8_t buffer_[Capacity];
+        size_t begin_{0};
+        size_t end_{0};
+
+        // Frames decoded, frames missing from the sequence, and bytes dropped while resynchronizing
+        uint32_t frames_{0};
+        uint32_t lost_frames_{0};
+        uint32_t dropped_bytes_{0};
+
+        // Sequence number the next frame should have
+        uint8_t expected_sequence_{0};
+};
+
+}  // namespace Link
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_LINK_FRAME_RECEIVER_H
@@ -0,0 +1,81 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batches link frames into a transmit buffer
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "frameWriter.h"
+#include <string.h>
+
+namespace ControlAlgorithms {
+
+namespace Link {
+
+uint8_t *FrameWriter::reserve(size_t payload_size) {
+    if(payload_size > FRAME_MAX_PAYLOAD || Frame::frameSize(payload_size) > capacity_ - size_) {
+        return nullptr;
+    }
+    return buffer_ + size_;
+}
+
+bool FrameWriter::appendBlock(uint8_t type, uint32_t timestamp, uint16_t first_loop, const float *const *channels,
+                              uint16_t count) {
+    uint32_t channel_count = Frame::channelCount(type);
+    size_t channel_size = (size_t)count * sizeof(float);
+    size_t payload_size = BLOCK_HEADER_SIZE + channel_count * channel_size;
+    uint8_t *frame = channel_count > 0 ? reserve(payload_size) : nullptr;
+    if(frame == nullptr) {
+        return false;
+    }
+    Frame::writeHeader(type, sequence_++, (uint16_t)payload_size, frame);
+    BlockHeader block;
+    block.timestamp = timestamp;
+    block.first_loop = first_loop;
+    block.count = count;
+    uint8_t *payload = frame + FRAME_HEADER_SIZE;
+    memcpy(payload, &block, sizeof(block));
+    for(uint32_t channel = 0; channel < channel_count; ++channel) {
+        memcpy(payload + BLOCK_HEADER_SIZE + channel * channel_size, channels[channel], channel_size);
+    }
+    size_ += Frame::finish(frame);
+    return true;
+}
+
+bool FrameWriter::appendSettings(const SettingRecord *records, uint16_t count) {
+    size_t payload_size = (size_t)count * SETTING_RECORD_SIZE;
+    uint8_t *frame = reserve(payload_size);
+    if(frame == nullptr) {
+        return false;
+    }
+    Frame::writeHeader(FRAME_SETTINGS, sequence_++, (uint16_t)payload_size, frame);
+    memcpy(frame + FRAME_HEADER_SIZE, records, payload_size);
+    size_ += Frame::finish(frame);
+    return true;
+}
+
+}  // namespace Link
+
+}  // namespace ControlAlgorithms
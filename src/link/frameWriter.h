@@ -0,0 +1,114 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batches link frames into a caller owned transmit buffer. Channels are copied once, straight from the bank
+ * arrays into their place in the frame, and the whole batch goes out in one write (Serial.write on a device,
+ * HostLink::write on a host).
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_LINK_FRAME_WRITER_H
+#define CONTROLALGORITHMS_LINK_FRAME_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <link/frame.h>
+
+namespace ControlAlgorithms {
+namespace Link {
+
+class FrameWriter {
+    public:
+        /**
+         * @param buffer [in]: uint8_t* transmit buffer, owned by the caller
+         * @param capacity [in]: size_t bytes in the buffer
+         */
+        FrameWriter(uint8_t *buffer, size_t capacity): buffer_(buffer), capacity_(capacity) {};
+        virtual ~FrameWriter() {};
+
+        /**
+         * Append a block frame
+         * @param type [in]: uint8_t FRAME_INPUT, FRAME_OUTPUT or FRAME_TELEMETRY
+         * @param timestamp [in]: uint32_t sender clock
+         * @param first_loop [in]: uint16_t loop of the first value
+         * @param channels [in]: const float*[Frame::channelCount(type)] the channel arrays, count values each
+         * @param count [in]: uint16_t number of loops
+         * @return bool false if the type is not a block frame, the payload is over FRAME_MAX_PAYLOAD or the
+         *         frame does not fit; nothing is appended then
+         */
+        bool appendBlock(uint8_t type, uint32_t timestamp, uint16_t first_loop, const float *const *channels,
+                         uint16_t count);
+
+        bool appendInput(uint32_t timestamp, uint16_t first_loop, const float *error, const float *delta_t,
+                         uint16_t count) {
+            const float *channels[] = {error, delta_t};
+            return appendBlock(FRAME_INPUT, timestamp, first_loop, channels, count);
+        }
+        bool appendOutput(uint32_t timestamp, uint16_t first_loop, const float *control, uint16_t count) {
+            const float *channels[] = {control};
+            return appendBlock(FRAME_OUTPUT, timestamp, first_loop, channels, count);
+        }
+        bool appendTelemetry(uint32_t timestamp, uint16_t first_loop, const float *error, const float *control,
+                             uint16_t count) {
+            const float *channels[] = {error, control};
+            return appendBlock(FRAME_TELEMETRY, timestamp, first_loop, channels, count);
+        }
+
+        /**
+         * Append a settings frame
+         * @param records [in]: SettingRecord[count] settings to change
+         * @param count [in]: uint16_t number of records
+         * @return bool false if the payload is over FRAME_MAX_PAYLOAD or the frame does not fit
+         */
+        bool appendSettings(const SettingRecord *records, uint16_t count);
+
+        /**
+         * Start a new batch once the last one has been sent. Sequence numbers carry on.
+         */
+        void clear() { size_ = 0; }
+
+        const uint8_t *getBuffer() const { return buffer_; }
+        size_t size() const { return size_; }
+        size_t capacity() const { return capacity_; }
+        bool isEmpty() const { return size_ == 0; }
+        uint8_t getSequence() const { return sequence_; }
+
+    private:
+        // Reserve a frame at the end of the batch, nullptr if it does not fit
+        uint8_t *reserve(size_t payload_size);
+
+        // Transmit buffer and the bytes of the batch so far
+        uint8_t *buffer_;
+        size_t capacity_;
+        size_t size_{0};
+
+        // Sequence number of the next frame
+        uint8_t sequence_{0};
+};
+
+}  // namespace Link
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_LINK_FRAME_WRITER_H
@@ -0,0 +1,219 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * POSIX implementation of the host link
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "hostLink.h"
+
+#if defined(__unix__) && !defined(ARDUINO)
+#define CONTROLALGORITHMS_HAS_HOST_LINK 1
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace ControlAlgorithms {
+
+namespace Link {
+
+#if defined(CONTROLALGORITHMS_HAS_HOST_LINK)
+
+namespace {
+
+bool setNonBlocking(int descriptor) {
+    int flags = fcntl(descriptor, F_GETFL);
+    return flags >= 0 && fcntl(descriptor, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// No echo, no line editing and no character translation, so the terminal passes bytes through unchanged
+bool setRaw(int descriptor) {
+    struct termios settings;
+    if(tcgetattr(descriptor, &settings) != 0) {
+        return false;
+    }
+    cfmakeraw(&settings);
+    return tcsetattr(descriptor, TCSANOW, &settings) == 0;
+}
+
+bool wait(int descriptor, short events, int timeout_ms) {
+    struct pollfd request;
+    request.fd = descriptor;
+    request.events = events;
+    request.revents = 0;
+    int result;
+    do {
+        result = poll(&request, 1, timeout_ms);
+    } while(result < 0 && errno == EINTR);
+    return result > 0;
+}
+
+}  // namespace
+
+bool HostLink::openPty() {
+    close();
+    int descriptor = posix_openpt(O_RDWR | O_NOCTTY);
+    if(descriptor < 0) {
+        return false;
+    }
+    const char *path = nullptr;
+    if(grantpt(descriptor) != 0 || unlockpt(descriptor) != 0 || (path = ptsname(descriptor)) == nullptr ||
+       strlen(path) >= MAX_PATH || !setNonBlocking(descriptor)) {
+        ::close(descriptor);
+        return false;
+    }
+    strcpy(peer_path_, path);
+    descriptor_ = descriptor;
+    // The line discipline is set on the terminal side; set it raw now so a late opener sees raw bytes
+    int terminal = ::open(peer_path_, O_RDWR | O_NOCTTY);
+    bool raw = terminal >= 0 && setRaw(terminal);
+    if(terminal >= 0) {
+        ::close(terminal);
+    }
+    if(!raw) {
+        close();
+    }
+    return raw;
+}
+
+bool HostLink::openPty(HostLink &peer) {
+    peer.close();
+    if(!openPty()) {
+        return false;
+    }
+    int terminal = ::open(peer_path_, O_RDWR | O_NOCTTY);
+    if(terminal < 0 || !setRaw(terminal) || !setNonBlocking(terminal)) {
+        if(terminal >= 0) {
+            ::close(terminal);
+        }
+        close();
+        return false;
+    }
+    peer.descriptor_ = terminal;
+    return true;
+}
+
+bool HostLink::openSocketPair(HostLink &peer) {
+    close();
+    peer.close();
+    int descriptors[2];
+    if(socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors) != 0) {
+        return false;
+    }
+    if(!setNonBlocking(descriptors[0]) || !setNonBlocking(descriptors[1])) {
+        ::close(descriptors[0]);
+        ::close(descriptors[1]);
+        return false;
+    }
+    descriptor_ = descriptors[0];
+    peer.descriptor_ = descriptors[1];
+    return true;
+}
+
+size_t HostLink::write(const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    size_t written = 0;
+    while(isOpen() && written < size) {
+        ssize_t result = ::write(descriptor_, bytes + written, size - written);
+        if(result > 0) {
+            written += (size_t)result;
+        }
+        else if(result < 0 && errno == EINTR) {
+            continue;
+        }
+        else if(result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            wait(descriptor_, POLLOUT, -1);
+        }
+        else {
+            break;
+        }
+    }
+    return written;
+}
+
+size_t HostLink::read(void *data, size_t capacity, int timeout_ms) {
+    if(!isOpen() || capacity == 0 || !wait(descriptor_, POLLIN, timeout_ms)) {
+        return 0;
+    }
+    ssize_t result;
+    do {
+        result = ::read(descriptor_, data, capacity);
+    } while(result < 0 && errno == EINTR);
+    return result > 0 ? (size_t)result : 0;
+}
+
+void HostLink::close() {
+    if(descriptor_ >= 0) {
+        ::close(descriptor_);
+    }
+    descriptor_ = -1;
+    peer_path_[0] = '\0';
+}
+
+#else
+
+bool HostLink::openPty() {
+    return false;
+}
+
+bool HostLink::openPty(HostLink &peer) {
+    (void)peer;
+    return false;
+}
+
+bool HostLink::openSocketPair(HostLink &peer) {
+    (void)peer;
+    return false;
+}
+
+size_t HostLink::write(const void *data, size_t size) {
+    (void)data;
+    (void)size;
+    return 0;
+}
+
+size_t HostLink::read(void *data, size_t capacity, int timeout_ms) {
+    (void)data;
+    (void)capacity;
+    (void)timeout_ms;
+    return 0;
+}
+
+void HostLink::close() {
+    descriptor_ = -1;
+}
+
+#endif
+
+}  // namespace Link
+
+}  // namespace ControlAlgorithms
@@ -0,0 +1,111 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Host stand-in for a device's serial port, so the device to host pipeline can be run and benchmarked on one
+ * machine. A pseudo terminal behaves like a USB serial port, including the tty layer; a socket pair skips it.
+ * Either end can be handed to a thread playing the device, and openPty exposes the terminal path so another
+ * process can attach instead. On targets without POSIX terminals, e.g. Arduino, opening fails; use Serial there.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_LINK_HOST_LINK_H
+#define CONTROLALGORITHMS_LINK_HOST_LINK_H
+
+#include <stddef.h>
+
+namespace ControlAlgorithms {
+namespace Link {
+
+class HostLink {
+    public:
+        // Longest terminal path kept by openPty
+        static const size_t MAX_PATH = 64;
+
+        HostLink() {};
+        virtual ~HostLink() { close(); };
+
+        /**
+         * Open the controlling side of a pseudo terminal in raw mode. The other side is left for another process
+         * to open at getPeerPath().
+         * @return bool false if no terminal could be opened
+         */
+        bool openPty();
+
+        /**
+         * Open both sides of a pseudo terminal in raw mode, this link on one side and the peer on the other
+         * @param peer [out]: HostLink the other side
+         * @return bool false if no terminal could be opened
+         */
+        bool openPty(HostLink &peer);
+
+        /**
+         * Open a connected pair of stream sockets
+         * @param peer [out]: HostLink the other end
+         * @return bool false if the sockets could not be created
+         */
+        bool openSocketPair(HostLink &peer);
+
+        /**
+         * Write all bytes, waiting while the link is full
+         * @param data [in]: const void* bytes
+         * @param size [in]: size_t number of bytes
+         * @return size_t bytes written, less than size if the link failed or closed
+         */
+        size_t write(const void *data, size_t size);
+
+        /**
+         * Read what is available, waiting up to a timeout for the first byte
+         * @param data [out]: void* destination, e.g. FrameReceiver::writePointer()
+         * @param capacity [in]: size_t bytes available at data
+         * @param timeout_ms [in]: int longest wait in milliseconds, 0 to poll, -1 to wait indefinitely
+         * @return size_t bytes read, 0 on timeout or when the link closed
+         */
+        size_t read(void *data, size_t capacity, int timeout_ms);
+
+        /**
+         * Close the link
+         */
+        void close();
+
+        bool isOpen() const { return descriptor_ >= 0; }
+        int getDescriptor() const { return descriptor_; }
+        const char *getPeerPath() const { return peer_path_; }
+
+    private:
+        // Not copyable, the descriptor is owned
+        HostLink(const HostLink &);
+        HostLink &operator=(const HostLink &);
+
+        // Open file descriptor, -1 when closed
+        int descriptor_{-1};
+
+        // Path of the other side of a pseudo terminal, empty otherwise
+        char peer_path_[MAX_PATH]{};
+};
+
+}  // namespace Link
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_LINK_HOST_LINK_H
@@ -0,0 +1,148 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Layout and sequence lock of the bank segment
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "bankSegment.h"
+#include <new>
+
+namespace ControlAlgorithms {
+
+namespace Monitor {
+
+static_assert(sizeof(BankSegmentHeader) == 64, "segment header fills one cache line");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "the sequence must be lock free to be shared between processes");
+
+size_t BankSegment::segmentSize(uint32_t loops) {
+    return sectionOffset(loops, SEGMENT_SECTIONS);
+}
+
+size_t BankSegment::sectionSize(uint32_t loops, uint32_t section) {
+    size_t element_size = section >= SEGMENT_INTEGRAL_FAULTS ? sizeof(uint8_t) : sizeof(float);
+    return (loops * element_size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+size_t BankSegment::sectionOffset(uint32_t loops, uint32_t section) {
+    size_t offset = sizeof(BankSegmentHeader);
+    for(uint32_t index = 0; index < section; ++index) {
+        offset += sectionSize(loops, index);
+    }
+    return offset;
+}
+
+bool BankSegment::format(void *memory, size_t size, uint32_t loops) {
+    if(memory == nullptr || ((uintptr_t)memory & (ALIGNMENT - 1)) != 0 || size < segmentSize(loops)) {
+        return false;
+    }
+    memset(memory, 0, segmentSize(loops));
+    header_ = new(memory) BankSegmentHeader();
+    header_->magic = BANK_SEGMENT_MAGIC;
+    header_->version = BANK_SEGMENT_VERSION;
+    header_->header_size = sizeof(BankSegmentHeader);
+    header_->byte_order = BANK_SEGMENT_BYTE_ORDER;
+    header_->loops = loops;
+    header_->section_count = SEGMENT_SECTIONS;
+    header_->segment_size = (uint32_t)segmentSize(loops);
+    header_->sequence.store(0, std::memory_order_release);
+    memory_ = static_cast<const uint8_t *>(memory);
+    writable_ = static_cast<uint8_t *>(memory);
+    loops_ = loops;
+    return true;
+}
+
+bool BankSegment::attach(const void *memory, size_t size) {
+    memory_ = nullptr;
+    writable_ = nullptr;
+    header_ = nullptr;
+    loops_ = 0;
+    if(memory == nullptr || size < sizeof(BankSegmentHeader)) {
+        return false;
+    }
+    // Readers never write through the header; the sequence is only loaded
+    BankSegmentHeader *header = const_cast<BankSegmentHeader *>(static_cast<const BankSegmentHeader *>(memory));
+    if(header->magic != BANK_SEGMENT_MAGIC || header->version != BANK_SEGMENT_VERSION ||
+       header->header_size != sizeof(BankSegmentHeader) || header->byte_order != BANK_SEGMENT_BYTE_ORDER ||
+       header->section_count != SEGMENT_SECTIONS || header->segment_size != segmentSize(header->loops) ||
+       header->segment_size > size) {
+        return false;
+    }
+    memory_ = static_cast<const uint8_t *>(memory);
+    header_ = header;
+    loops_ = header->loops;
+    return true;
+}
+
+uint32_t BankSegment::beginRead() const {
+    uint32_t sequence = header_->sequence.load(std::memory_order_acquire);
+    while(sequence & 1) {
+        sequence = header_->sequence.load(std::memory_order_acquire);
+    }
+    return sequence;
+}
+
+bool BankSegment::validateRead(uint32_t sequence) const {
+    // Order the section reads before the second load of the sequence
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return header_->sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+uint32_t BankSegment::getPublishCount() const {
+    return header_ == nullptr ? 0 : (header_->sequence.load(std::memory_order_relaxed) >> 1);
+}
+
+const float *BankSegment::getFloatSection(uint32_t section) const {
+    if(memory_ == nullptr || section >= SEGMENT_INTEGRAL_FAULTS) {
+        return nullptr;
+    }
+    return reinterpret_cast<const float *>(memory_ + sectionOffset(loops_, section));
+}
+
+const uint8_t *BankSegment::getFaultSection(uint32_t section) const {
+    if(memory_ == nullptr || section < SEGMENT_INTEGRAL_FAULTS || section >= SEGMENT_SECTIONS) {
+        return nullptr;
+    }
+    return memory_ + sectionOffset(loops_, section);
+}
+
+void BankSegment::beginWrite() {
+    uint32_t sequence = header_->sequence.load(std::memory_order_relaxed);
+    header_->sequence.store(sequence + 1, std::memory_order_relaxed);
+    // Order the odd sequence before the section writes
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void BankSegment::endWrite() {
+    uint32_t sequence = header_->sequence.load(std::memory_order_relaxed);
+    header_->sequence.store(sequence + 1, std::memory_order_release);
+}
+
+void BankSegment::write(uint32_t section, const void *source, size_t element_size) {
+    memcpy(writable_ + sectionOffset(loops_, section), source, loops_ * element_size);
+}
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
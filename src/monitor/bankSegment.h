@@ -0,0 +1,182 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Live export of bank outputs and state for monitoring processes, e.g. an HMI or historian mapping a
+ * Monitor::SharedSegment. The control thread publishes after each batch update; readers access the arrays in
+ * place and use the sequence lock to detect a publish that overlapped their read, so they never block the writer.
+ *
+ * Layout (native byte order, recorded in the header):
+ *     BankSegmentHeader (64 bytes)
+ *     one section per field, each loops elements long and starting on a 64 byte boundary
+ * Sections: proportional control, integral control, integrated error, derivative control, previous error (float),
+ *           integral faults, derivative faults (uint8_t)
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_BANK_SEGMENT_H
+#define CONTROLALGORITHMS_MONITOR_BANK_SEGMENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+// Sections, in segment order
+const uint32_t SEGMENT_PROPORTIONAL_CONTROL = 0;
+const uint32_t SEGMENT_INTEGRAL_CONTROL = 1;
+const uint32_t SEGMENT_INTEGRATED_ERROR = 2;
+const uint32_t SEGMENT_DERIVATIVE_CONTROL = 3;
+const uint32_t SEGMENT_PREVIOUS_ERROR = 4;
+const uint32_t SEGMENT_INTEGRAL_FAULTS = 5;
+const uint32_t SEGMENT_DERIVATIVE_FAULTS = 6;
+const uint32_t SEGMENT_SECTIONS = 7;
+
+struct BankSegmentHeader {
+    // BANK_SEGMENT_MAGIC
+    uint32_t magic;
+    // BANK_SEGMENT_VERSION, bumped whenever the layout changes
+    uint16_t version;
+    // sizeof(BankSegmentHeader)
+    uint16_t header_size;
+    // BANK_SEGMENT_BYTE_ORDER as written by the publisher
+    uint32_t byte_order;
+    // Elements per section
+    uint32_t loops;
+    // SEGMENT_SECTIONS
+    uint32_t section_count;
+    // Total bytes used
+    uint32_t segment_size;
+    // Odd while a publish is in progress; advances by two per publish
+    std::atomic<uint32_t> sequence;
+    uint32_t reserved[9];
+};
+
+class BankSegment {
+    public:
+        static const uint32_t BANK_SEGMENT_MAGIC = 0x4D534143;
+        static const uint16_t BANK_SEGMENT_VERSION = 1;
+        static const uint32_t BANK_SEGMENT_BYTE_ORDER = 0x01020304;
+        static const size_t ALIGNMENT = 64;
+
+        BankSegment() {};
+        virtual ~BankSegment() {};
+
+        /**
+         * Bytes needed for a segment
+         * @param loops [in]: uint32_t loops per bank
+         * @return size_t segment size
+         */
+        static size_t segmentSize(uint32_t loops);
+
+        /**
+         * Write a new header over memory and zero the sections. Used by the publisher before its first publish.
+         * @param memory [in]: void* segment memory, at least segmentSize(loops) bytes and 64 byte aligned
+         * @param size [in]: size_t bytes available
+         * @param loops [in]: uint32_t loops per bank
+         * @return bool false if the memory is too small or misaligned
+         */
+        bool format(void *memory, size_t size, uint32_t loops);
+
+        /**
+         * Use a segment formatted by a publisher, e.g. from a read only mapping
+         * @param memory [in]: const void* segment memory
+         * @param size [in]: size_t bytes mapped
+         * @return bool false if the header is missing, from another version or byte order, or larger than size
+         */
+        bool attach(const void *memory, size_t size);
+
+        /**
+         * Publish the bank outputs. Call from the single publishing thread only, after format.
+         * Banks provide the array accessors of PID::ProportionalBank, IntegralBank and DerivativeBank.
+         * @param proportional [in]: the proportional bank
+         * @param integral [in]: the integral bank
+         * @param derivative [in]: the derivative bank
+         * @return bool false if not formatted or a bank has fewer loops than the segment
+         */
+        template<typename ProportionalBank, typename IntegralBank, typename DerivativeBank>
+        bool publish(const ProportionalBank &proportional, const IntegralBank &integral,
+                     const DerivativeBank &derivative) {
+            if(writable_ == nullptr || proportional.capacity() < loops_ || integral.capacity() < loops_ ||
+               derivative.capacity() < loops_) {
+                return false;
+            }
+            beginWrite();
+            write(SEGMENT_PROPORTIONAL_CONTROL, proportional.getControlArray(), sizeof(float));
+            write(SEGMENT_INTEGRAL_CONTROL, integral.getControlArray(), sizeof(float));
+            write(SEGMENT_INTEGRATED_ERROR, integral.getIntegratedErrorArray(), sizeof(float));
+            write(SEGMENT_DERIVATIVE_CONTROL, derivative.getControlArray(), sizeof(float));
+            write(SEGMENT_PREVIOUS_ERROR, derivative.getPreviousErrorArray(), sizeof(float));
+            write(SEGMENT_INTEGRAL_FAULTS, integral.getFaultsArray(), sizeof(uint8_t));
+            write(SEGMENT_DERIVATIVE_FAULTS, derivative.getFaultsArray(), sizeof(uint8_t));
+            endWrite();
+            return true;
+        }
+
+        /**
+         * Start reading in place. Waits out a publish in progress.
+         * @return uint32_t sequence to pass to validateRead
+         */
+        uint32_t beginRead() const;
+
+        /**
+         * Check that no publish overlapped the reads since beginRead. If it did, the values read may be torn and
+         * must be read again.
+         * @param sequence [in]: uint32_t value returned from beginRead
+         * @return bool true if the values read are consistent
+         */
+        bool validateRead(uint32_t sequence) const;
+
+        /**
+         * Number of publishes so far
+         * @return uint32_t publish count
+         */
+        uint32_t getPublishCount() const;
+
+        // Sections for reading in place, nullptr before format/attach
+        const float *getFloatSection(uint32_t section) const;
+        const uint8_t *getFaultSection(uint32_t section) const;
+        uint32_t getLoops() const { return loops_; }
+
+    private:
+        static size_t sectionSize(uint32_t loops, uint32_t section);
+        static size_t sectionOffset(uint32_t loops, uint32_t section);
+        void beginWrite();
+        void endWrite();
+        void write(uint32_t section, const void *source, size_t element_size);
+
+        // The segment
+        const uint8_t *memory_{nullptr};
+        uint8_t *writable_{nullptr};
+        BankSegmentHeader *header_{nullptr};
+        uint32_t loops_{0};
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_BANK_SEGMENT_H
@@ -0,0 +1,94 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Closed loop performance metrics attached to a controller. Pass each sample given to the controller to update
+ * as well; the metrics and the health score are then available at any time.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_LOOP_METRICS_H
+#define CONTROLALGORITHMS_MONITOR_LOOP_METRICS_H
+
+#include <base/controlInput.h>
+#include <monitor/loopMetricsSettings.h>
+#include <monitor/loopMetricsState.h>
+#include <monitor/loopMetricsStateless.h>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+class LoopMetrics {
+    public:
+        LoopMetrics() {};
+        virtual ~LoopMetrics() {};
+
+        /**
+         * Set the metrics settings
+         * @param settings [in]: LoopMetricsSettings metrics settings
+         */
+        virtual void setSettings(const LoopMetricsSettings &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the metrics settings
+         * @param settings [out]: LoopMetricsSettings metrics settings
+         */
+        virtual void getSettings(LoopMetricsSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Fold one sample into the metrics
+         * @param input [in]: Base::ControlInput the error and time step given to the controller
+         */
+        virtual void update(const Base::ControlInput &input) {
+            LoopMetricsStateless::update(input, settings_, state_);
+        }
+
+        /**
+         * Start the metrics over
+         */
+        virtual void reset() {
+            state_.reset();
+        }
+
+        // The running metrics
+        const LoopMetricsState &getState() const { return state_; }
+        float getHealth() const { return LoopMetricsStateless::health(state_, settings_); }
+        bool isOscillating() const { return LoopMetricsStateless::isOscillating(state_, settings_); }
+
+    private:
+        // The stored settings
+        LoopMetricsSettings settings_;
+
+        // The running metrics
+        LoopMetricsState state_;
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_LOOP_METRICS_H
@@ -0,0 +1,183 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A fixed capacity bank of loop metrics stored as structure of arrays and updated with LoopMetricsBatch. Feed it
+ * the same error and time step arrays as the controller banks to monitor a whole fleet.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_LOOP_METRICS_BANK_H
+#define CONTROLALGORITHMS_MONITOR_LOOP_METRICS_BANK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <monitor/loopMetricsBatch.h>
+#include <monitor/loopMetricsSettings.h>
+#include <monitor/loopMetricsState.h>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+template<size_t Capacity>
+class LoopMetricsBank {
+    public:
+        LoopMetricsBank() {
+            resetAll();
+        };
+        virtual ~LoopMetricsBank() {};
+
+        /**
+         * Set the metrics settings, shared by all loops
+         * @param settings [in]: LoopMetricsSettings metrics settings
+         */
+        void setSettings(const LoopMetricsSettings &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the metrics settings
+         * @param settings [out]: LoopMetricsSettings metrics settings
+         */
+        void getSettings(LoopMetricsSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Update loops [0, count) with one sample each
+         * @param error [in]: float[count] current error signals
+         * @param delta_t [in]: float[count] time since the last call
+         * @param count [in]: size_t number of loops, at most Capacity
+         */
+        void update(const float *error, const float *delta_t, size_t count) {
+            LoopMetricsBatch::update(error, delta_t, settings_, elapsed_, iae_, ise_, itae_, elapsed_compensation_,
+                                     iae_compensation_, ise_compensation_, itae_compensation_, samples_, mean_,
+                                     sum_squares_, sign_, segment_iae_, detections_, mean_square_, count);
+        }
+
+        /**
+         * Update a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param delta_t [in]: float[count] time step of each sample
+         * @param count [in]: size_t number of samples
+         */
+        void updateIndexed(const uint32_t *loops, const float *error, const float *delta_t, size_t count) {
+            LoopMetricsBatch::updateIndexed(loops, error, delta_t, settings_, elapsed_, iae_, ise_, itae_,
+                                            elapsed_compensation_, iae_compensation_, ise_compensation_,
+                                            itae_compensation_, samples_, mean_, sum_squares_, sign_, segment_iae_,
+                                            detections_, mean_square_, count);
+        }
+
+        /**
+         * Health scores of loops [0, count)
+         * @param health [out]: float[count] scores in [0, 1]
+         * @param count [in]: size_t number of loops, at most Capacity
+         */
+        void health(float *health, size_t count) const {
+            LoopMetricsBatch::health(settings_, detections_, mean_square_, health, count);
+        }
+
+        /**
+         * Get the metrics of one loop
+         * @param loop [in]: size_t loop index
+         * @param state [out]: LoopMetricsState the running metrics
+         */
+        void getState(size_t loop, LoopMetricsState &state) const {
+            state.setElapsed(elapsed_[loop]);
+            state.setIae(iae_[loop]);
+            state.setIse(ise_[loop]);
+            state.setItae(itae_[loop]);
+            state.setElapsedCompensation(elapsed_compensation_[loop]);
+            state.setIaeCompensation(iae_compensation_[loop]);
+            state.setIseCompensation(ise_compensation_[loop]);
+            state.setItaeCompensation(itae_compensation_[loop]);
+            state.setSamples(samples_[loop]);
+            state.setMean(mean_[loop]);
+            state.setSumSquares(sum_squares_[loop]);
+            state.setSign(sign_[loop]);
+            state.setSegmentIae(segment_iae_[loop]);
+            state.setDetections(detections_[loop]);
+            state.setMeanSquare(mean_square_[loop]);
+        }
+
+        /**
+         * Start the metrics of one loop over
+         */
+        void reset(size_t loop) {
+            elapsed_[loop] = 0.0;
+            iae_[loop] = 0.0;
+            ise_[loop] = 0.0;
+            itae_[loop] = 0.0;
+            elapsed_compensation_[loop] = 0.0;
+            iae_compensation_[loop] = 0.0;
+            ise_compensation_[loop] = 0.0;
+            itae_compensation_[loop] = 0.0;
+            samples_[loop] = 0;
+            mean_[loop] = 0.0;
+            sum_squares_[loop] = 0.0;
+            sign_[loop] = 0.0;
+            segment_iae_[loop] = 0.0;
+            detections_[loop] = 0.0;
+            mean_square_[loop] = 0.0;
+        }
+
+        /**
+         * Start the metrics of all loops over
+         */
+        void resetAll() {
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                reset(loop);
+            }
+        }
+
+        bool isOscillating(size_t loop) const { return detections_[loop] > settings_.getDetectionLimit(); }
+        size_t capacity() const { return Capacity; }
+
+    private:
+        // Settings shared by all loops
+        LoopMetricsSettings settings_;
+
+        // Running metrics, one entry per loop; see LoopMetricsState
+        float elapsed_[Capacity];
+        float iae_[Capacity];
+        float ise_[Capacity];
+        float itae_[Capacity];
+        float elapsed_compensation_[Capacity];
+        float iae_compensation_[Capacity];
+        float ise_compensation_[Capacity];
+        float itae_compensation_[Capacity];
+        uint32_t samples_[Capacity];
+        float mean_[Capacity];
+        float sum_squares_[Capacity];
+        float sign_[Capacity];
+        float segment_iae_[Capacity];
+        float detections_[Capacity];
+        float mean_square_[Capacity];
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_LOOP_METRICS_BANK_H
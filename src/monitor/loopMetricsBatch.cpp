@@ -0,0 +1,119 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of the closed loop performance metrics
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "loopMetricsBatch.h"
+#include <math.h>
+#include <base/branchless.h>
+#include <monitor/loopMetricsKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Monitor {
+
+// The arrays of one call must not overlap. __restrict lets the loops vectorize without runtime alias checks.
+void LoopMetricsBatch::update(const float *__restrict error, const float *__restrict delta_t,
+                              const LoopMetricsSettings &settings, float *__restrict elapsed, float *__restrict iae,
+                              float *__restrict ise, float *__restrict itae, float *__restrict elapsed_compensation,
+                              float *__restrict iae_compensation, float *__restrict ise_compensation,
+                              float *__restrict itae_compensation, uint32_t *__restrict samples,
+                              float *__restrict mean, float *__restrict sum_squares, float *__restrict sign,
+                              float *__restrict segment_iae, float *__restrict detections,
+                              float *__restrict mean_square, size_t count) {
+    const float hysteresis = settings.getHysteresis();
+    const float iae_limit = settings.getIaeLimit();
+    const float supervision_time = settings.getSupervisionTime();
+    for(size_t i = 0; i < count; ++i) {
+        float absolute = fabsf(error[i]);
+        float squared = error[i] * error[i];
+
+        // Integral criteria, compensated so they keep growing over long runs
+        Kernels::compensatedAdd(delta_t[i], elapsed[i], elapsed_compensation[i]);
+        Kernels::compensatedAdd(absolute * delta_t[i], iae[i], iae_compensation[i]);
+        Kernels::compensatedAdd(squared * delta_t[i], ise[i], ise_compensation[i]);
+        Kernels::compensatedAdd(elapsed[i] * absolute * delta_t[i], itae[i], itae_compensation[i]);
+
+        // Welford mean and variance
+        uint32_t next = Kernels::nextSample(samples[i]);
+        float deviation = error[i] - mean[i];
+        float updated = mean[i] + deviation / (float)next;
+        samples[i] = next;
+        mean[i] = updated;
+        sum_squares[i] += deviation * (error[i] - updated);
+
+        // Load disturbance detection. The selections of Kernels::hysteresisSign are made with masks: gcc sinks the
+        // arithmetic on constant results into ternary branches and then cannot if-convert them.
+        float side = Base::Branchless::select(Base::Branchless::mask(error[i] > hysteresis), 1.0f,
+                                              Base::Branchless::select(Base::Branchless::mask(error[i] < -hysteresis),
+                                                                       -1.0f, sign[i]));
+        uint32_t crossing = Base::Branchless::mask(side * sign[i] < 0.0f);
+        float segment = segment_iae[i] + absolute * delta_t[i];
+        float weight = Kernels::forgetting(delta_t[i], supervision_time);
+        float detected = Base::Branchless::select(crossing & Base::Branchless::mask(segment > iae_limit), 1.0f, 0.0f);
+        sign[i] = side;
+        segment_iae[i] = Base::Branchless::select(crossing, 0.0f, segment);
+        detections[i] = detections[i] * (1.0f - weight) + detected;
+
+        // Recent mean square error for the health score
+        mean_square[i] += weight * (squared - mean_square[i]);
+    }
+}
+
+void LoopMetricsBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict error,
+                                     const float *__restrict delta_t, const LoopMetricsSettings &settings,
+                                     float *__restrict elapsed, float *__restrict iae, float *__restrict ise,
+                                     float *__restrict itae, float *__restrict elapsed_compensation,
+                                     float *__restrict iae_compensation, float *__restrict ise_compensation,
+                                     float *__restrict itae_compensation, uint32_t *__restrict samples,
+                                     float *__restrict mean, float *__restrict sum_squares, float *__restrict sign,
+                                     float *__restrict segment_iae, float *__restrict detections,
+                                     float *__restrict mean_square, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        update(&error[i], &delta_t[i], settings, &elapsed[loop], &iae[loop], &ise[loop], &itae[loop],
+               &elapsed_compensation[loop], &iae_compensation[loop], &ise_compensation[loop], &itae_compensation[loop],
+               &samples[loop], &mean[loop], &sum_squares[loop], &sign[loop], &segment_iae[loop], &detections[loop],
+               &mean_square[loop], 1);
+    }
+}
+
+void LoopMetricsBatch::health(const LoopMetricsSettings &settings, const float *__restrict detections,
+                              const float *__restrict mean_square, float *__restrict health, size_t count) {
+    const float error_tolerance = settings.getErrorTolerance();
+    const float detection_limit = settings.getDetectionLimit();
+    const float tolerance_squared = error_tolerance * error_tolerance;
+    for(size_t i = 0; i < count; ++i) {
+        // Kernels::health, with the bound on the detection fraction applied by mask as in update
+        float fraction = detections[i] / detection_limit;
+        fraction = Base::Branchless::select(Base::Branchless::mask(fraction < 1.0f), fraction, 1.0f);
+        health[i] = tolerance_squared / (tolerance_squared + mean_square[i]) * (1.0f - 0.5f * fraction);
+    }
+}
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
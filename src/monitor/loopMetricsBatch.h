@@ -0,0 +1,103 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) version of the closed loop performance metrics, sharing one set of settings
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_LOOP_METRICS_BATCH_H
+#define CONTROLALGORITHMS_MONITOR_LOOP_METRICS_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <monitor/loopMetricsSettings.h>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+class LoopMetricsBatch {
+    public:
+        /**
+         * Fold one sample into the metrics of many loops. Element i of every array belongs to loop i; the state
+         * arrays match the fields of LoopMetricsState.
+         * @param error [in]: float[count] current error signals
+         * @param delta_t [in]: float[count] time since the last call
+         * @param settings [in]: LoopMetricsSettings metrics settings for all loops
+         * @param elapsed [in/out]: float[count] time since the reset
+         * @param iae [in/out]: float[count] integrated absolute error
+         * @param ise [in/out]: float[count] integrated squared error
+         * @param itae [in/out]: float[count] integrated time weighted absolute error
+         * @param elapsed_compensation [in/out]: float[count] Kahan compensation of elapsed
+         * @param iae_compensation [in/out]: float[count] Kahan compensation of iae
+         * @param ise_compensation [in/out]: float[count] Kahan compensation of ise
+         * @param itae_compensation [in/out]: float[count] Kahan compensation of itae
+         * @param samples [in/out]: uint32_t[count] samples since the reset
+         * @param mean [in/out]: float[count] mean error
+         * @param sum_squares [in/out]: float[count] sum of squared deviations from the mean
+         * @param sign [in/out]: float[count] side of zero of the error
+         * @param segment_iae [in/out]: float[count] integrated absolute error since the last zero crossing
+         * @param detections [in/out]: float[count] decayed load disturbance detections
+         * @param mean_square [in/out]: float[count] recent mean square error
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *error, const float *delta_t, const LoopMetricsSettings &settings,
+                           float *elapsed, float *iae, float *ise, float *itae, float *elapsed_compensation,
+                           float *iae_compensation, float *ise_compensation, float *itae_compensation,
+                           uint32_t *samples, float *mean, float *sum_squares, float *sign, float *segment_iae,
+                           float *detections, float *mean_square, size_t count);
+
+        /**
+         * Fold in samples for a scattered subset of loops. Samples are applied in order, so a loop may appear more than once.
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param delta_t [in]: float[count] time step of each sample
+         * Remaining parameters are indexed by loop, as in update.
+         */
+        static void updateIndexed(const uint32_t *loops, const float *error, const float *delta_t,
+                                  const LoopMetricsSettings &settings, float *elapsed, float *iae, float *ise,
+                                  float *itae, float *elapsed_compensation, float *iae_compensation,
+                                  float *ise_compensation, float *itae_compensation, uint32_t *samples, float *mean,
+                                  float *sum_squares, float *sign, float *segment_iae, float *detections,
+                                  float *mean_square, size_t count);
+
+        /**
+         * Health scores of many loops
+         * @param settings [in]: LoopMetricsSettings metrics settings for all loops
+         * @param detections [in]: float[count] decayed load disturbance detections
+         * @param mean_square [in]: float[count] recent mean square error
+         * @param health [out]: float[count] scores in [0, 1]
+         * @param count [in]: size_t number of loops
+         */
+        static void health(const LoopMetricsSettings &settings, const float *detections, const float *mean_square,
+                           float *health, size_t count);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        LoopMetricsBatch() {};
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_LOOP_METRICS_BATCH_H
@@ -0,0 +1,106 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Header only kernels of the closed loop performance metrics, constexpr like the PID kernels. Oscillation is
+ * detected as in Hagglund's load disturbance detector: every half period whose integrated absolute error exceeds
+ * a limit counts as a detection, detections are forgotten exponentially over a supervision time, and too many of
+ * them mean the loop oscillates.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_LOOP_METRICS_KERNELS_H
+#define CONTROLALGORITHMS_MONITOR_LOOP_METRICS_KERNELS_H
+
+#include <stdint.h>
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+namespace Kernels {
+
+/**
+ * Side of zero the error is on, held inside the hysteresis band
+ * @param error [in]: float the error signal
+ * @param hysteresis [in]: float half width of the band
+ * @param sign [in]: float the side last seen, -1, 0 or 1
+ * @return float the new side
+ */
+constexpr float hysteresisSign(float error, float hysteresis, float sign) {
+    return error > hysteresis ? 1.0f : (error < -hysteresis ? -1.0f : sign);
+}
+
+/**
+ * Weight of a new sample in a value forgotten exponentially over a time constant
+ * @param delta_t [in]: float time since the last sample
+ * @param time_constant [in]: float forgetting time constant
+ * @return float weight in [0, 1], 1 if the time constant is shorter than the time step
+ */
+constexpr float forgetting(float delta_t, float time_constant) {
+    // Dividing by the bounded time constant, rather than selecting after the division, keeps batch loops branch free
+    return delta_t / PID::Kernels::lowerBound(time_constant, delta_t);
+}
+
+/**
+ * Kahan compensated add, as Base::KahanPolicy: the rounding error of each add is carried into the next one, so a
+ * float running sum keeps counting small increments long after a plain sum would have stopped changing
+ * @param term [in]: float value to add
+ * @param sum [in/out]: float the running sum
+ * @param compensation [in/out]: float rounding error of the last add
+ */
+inline void compensatedAdd(float term, float &sum, float &compensation) {
+    float corrected = term - compensation;
+    float next = sum + corrected;
+    compensation = (next - sum) - corrected;
+    sum = next;
+}
+
+/**
+ * Sample count after one more sample, held at the largest count instead of wrapping to zero
+ * @param samples [in]: uint32_t samples so far
+ * @return uint32_t the new count
+ */
+constexpr uint32_t nextSample(uint32_t samples) {
+    return samples + (samples != 0xFFFFFFFFu ? 1u : 0u);
+}
+
+/**
+ * Health score of a loop, from 1 (no error, no oscillation) towards 0. The error term is 0.5 when the recent
+ * RMS error equals the tolerance; an oscillating loop scores at most half.
+ * @param mean_square [in]: float recent mean square error
+ * @param error_tolerance [in]: float RMS error the loop is expected to hold
+ * @param detections [in]: float decayed number of detections
+ * @param detection_limit [in]: float detections at which the loop counts as oscillating
+ * @return float the score in [0, 1]
+ */
+constexpr float health(float mean_square, float error_tolerance, float detections, float detection_limit) {
+    return error_tolerance * error_tolerance / (error_tolerance * error_tolerance + mean_square) *
+           (1.0f - 0.5f * PID::Kernels::upperBound(detections / detection_limit, 1.0f));
+}
+
+}  // namespace Kernels
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_LOOP_METRICS_KERNELS_H
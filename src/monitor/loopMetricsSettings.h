@@ -0,0 +1,85 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for closed loop performance metrics
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_LOOP_METRICS_SETTINGS_H
+#define CONTROLALGORITHMS_MONITOR_LOOP_METRICS_SETTINGS_H
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+class LoopMetricsSettings {
+    public:
+        LoopMetricsSettings () {};
+        virtual ~LoopMetricsSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: LoopMetricsSettings input settings
+         */
+        void copy(const LoopMetricsSettings &right) {
+            setErrorTolerance(right.getErrorTolerance());
+            setHysteresis(right.getHysteresis());
+            setIaeLimit(right.getIaeLimit());
+            setSupervisionTime(right.getSupervisionTime());
+            setDetectionLimit(right.getDetectionLimit());
+        }
+
+        void setErrorTolerance(float error_tolerance) { error_tolerance_ = error_tolerance; }
+        float getErrorTolerance() const { return error_tolerance_; }
+        void setHysteresis(float hysteresis) { hysteresis_ = hysteresis; }
+        float getHysteresis() const { return hysteresis_; }
+        void setIaeLimit(float iae_limit) { iae_limit_ = iae_limit; }
+        float getIaeLimit() const { return iae_limit_; }
+        void setSupervisionTime(float supervision_time) { supervision_time_ = supervision_time; }
+        float getSupervisionTime() const { return supervision_time_; }
+        void setDetectionLimit(float detection_limit) { detection_limit_ = detection_limit; }
+        float getDetectionLimit() const { return detection_limit_; }
+
+    private:
+        // RMS error the loop is expected to hold; the health score is 0.5 when the recent RMS error equals it
+        float error_tolerance_{1.0};
+
+        // Error band ignored when looking for zero crossings, to keep noise from counting as oscillation
+        float hysteresis_{0.0};
+
+        // Integrated absolute error between two zero crossings above which the half period counts as a load
+        // disturbance; 2 * amplitude / frequency for the smallest oscillation (amplitude, rad/s) worth reporting
+        float iae_limit_{1.0};
+
+        // Time constant over which detections and the recent mean square error are forgotten
+        float supervision_time_{100.0};
+
+        // Decayed number of detections above which the loop is reported as oscillating
+        float detection_limit_{10.0};
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_LOOP_METRICS_SETTINGS_H
@@ -0,0 +1,148 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Running state of the closed loop performance metrics. Everything is accumulated per sample, so no history is kept.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_LOOP_METRICS_STATE_H
+#define CONTROLALGORITHMS_MONITOR_LOOP_METRICS_STATE_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+class LoopMetricsState {
+    public:
+        LoopMetricsState () {};
+        virtual ~LoopMetricsState() {};
+
+        /**
+         * Copy in
+         * @param right [in]: LoopMetricsState input
+         */
+        void copy(const LoopMetricsState &right) {
+            setElapsed(right.getElapsed());
+            setIae(right.getIae());
+            setIse(right.getIse());
+            setItae(right.getItae());
+            setElapsedCompensation(right.getElapsedCompensation());
+            setIaeCompensation(right.getIaeCompensation());
+            setIseCompensation(right.getIseCompensation());
+            setItaeCompensation(right.getItaeCompensation());
+            setSamples(right.getSamples());
+            setMean(right.getMean());
+            setSumSquares(right.getSumSquares());
+            setSign(right.getSign());
+            setSegmentIae(right.getSegmentIae());
+            setDetections(right.getDetections());
+            setMeanSquare(right.getMeanSquare());
+        }
+
+        /**
+         * Start the metrics over
+         */
+        void reset() {
+            LoopMetricsState cleared;
+            copy(cleared);
+        }
+
+        /**
+         * @return float variance of the error since the reset, 0 before two samples
+         */
+        float getVariance() const { return samples_ > 1 ? sum_squares_ / (float)(samples_ - 1) : 0.0f; }
+
+        void setElapsed(float elapsed) { elapsed_ = elapsed; }
+        float getElapsed() const { return elapsed_; }
+        void setIae(float iae) { iae_ = iae; }
+        float getIae() const { return iae_; }
+        void setIse(float ise) { ise_ = ise; }
+        float getIse() const { return ise_; }
+        void setItae(float itae) { itae_ = itae; }
+        float getItae() const { return itae_; }
+        void setElapsedCompensation(float compensation) { elapsed_compensation_ = compensation; }
+        float getElapsedCompensation() const { return elapsed_compensation_; }
+        void setIaeCompensation(float compensation) { iae_compensation_ = compensation; }
+        float getIaeCompensation() const { return iae_compensation_; }
+        void setIseCompensation(float compensation) { ise_compensation_ = compensation; }
+        float getIseCompensation() const { return ise_compensation_; }
+        void setItaeCompensation(float compensation) { itae_compensation_ = compensation; }
+        float getItaeCompensation() const { return itae_compensation_; }
+        void setSamples(uint32_t samples) { samples_ = samples; }
+        uint32_t getSamples() const { return samples_; }
+        void setMean(float mean) { mean_ = mean; }
+        float getMean() const { return mean_; }
+        void setSumSquares(float sum_squares) { sum_squares_ = sum_squares; }
+        float getSumSquares() const { return sum_squares_; }
+        void setSign(float sign) { sign_ = sign; }
+        float getSign() const { return sign_; }
+        void setSegmentIae(float segment_iae) { segment_iae_ = segment_iae; }
+        float getSegmentIae() const { return segment_iae_; }
+        void setDetections(float detections) { detections_ = detections; }
+        float getDetections() const { return detections_; }
+        void setMeanSquare(float mean_square) { mean_square_ = mean_square; }
+        float getMeanSquare() const { return mean_square_; }
+
+    private:
+        // Time since the reset
+        float elapsed_{0.0};
+
+        // Integrals since the reset of |e|, e^2 and t * |e|
+        float iae_{0.0};
+        float ise_{0.0};
+        float itae_{0.0};
+
+        // Kahan compensation of the time and the integrals. A plain float sum of 1 ms steps stops advancing after
+        // about 9 hours, which would freeze the ITAE time weight and the integrals with it.
+        float elapsed_compensation_{0.0};
+        float iae_compensation_{0.0};
+        float ise_compensation_{0.0};
+        float itae_compensation_{0.0};
+
+        // Welford accumulators of the error: samples, mean and sum of squared deviations from the mean. The count
+        // holds at 2^32 - 1 (about 49.7 days at 1 kHz) rather than wrapping; by then each sample moves the mean by
+        // less than float resolution anyway.
+        uint32_t samples_{0};
+        float mean_{0.0};
+        float sum_squares_{0.0};
+
+        // Side of zero the error was last seen on outside the hysteresis band: -1, 1, or 0 before the first
+        float sign_{0.0};
+
+        // Integrated absolute error since the last zero crossing
+        float segment_iae_{0.0};
+
+        // Load disturbances detected, forgotten over the supervision time
+        float detections_{0.0};
+
+        // Mean square error, forgotten over the supervision time
+        float mean_square_{0.0};
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_LOOP_METRICS_STATE_H
@@ -0,0 +1,102 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of the closed loop performance metrics
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "loopMetricsStateless.h"
+#include <math.h>
+#include <monitor/loopMetricsKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Monitor {
+
+// Compile time checks of the kernels: the hysteresis band holds the side, and the health score halves at the
+// tolerance and again when oscillating
+static_assert(Kernels::hysteresisSign(0.05f, 0.1f, -1.0f) == -1.0f, "hold inside the band");
+static_assert(Kernels::hysteresisSign(0.2f, 0.1f, -1.0f) == 1.0f, "switch above the band");
+static_assert(Kernels::health(4.0f, 2.0f, 0.0f, 10.0f) == 0.5f, "error at the tolerance");
+static_assert(Kernels::health(0.0f, 2.0f, 20.0f, 10.0f) == 0.5f, "oscillating");
+static_assert(Kernels::nextSample(0xFFFFFFFFu) == 0xFFFFFFFFu, "sample count holds");
+
+void LoopMetricsStateless::update(const Base::ControlInput &input, const LoopMetricsSettings &settings, LoopMetricsState &state) {
+    float error = input.getError();
+    float delta_t = input.getDeltaT();
+    float absolute = fabsf(error);
+    float squared = error * error;
+
+    // Integral criteria, compensated so they keep growing over long runs
+    float elapsed = state.getElapsed();
+    float elapsed_compensation = state.getElapsedCompensation();
+    Kernels::compensatedAdd(delta_t, elapsed, elapsed_compensation);
+    state.setElapsed(elapsed);
+    state.setElapsedCompensation(elapsed_compensation);
+    float iae = state.getIae();
+    float iae_compensation = state.getIaeCompensation();
+    Kernels::compensatedAdd(absolute * delta_t, iae, iae_compensation);
+    state.setIae(iae);
+    state.setIaeCompensation(iae_compensation);
+    float ise = state.getIse();
+    float ise_compensation = state.getIseCompensation();
+    Kernels::compensatedAdd(squared * delta_t, ise, ise_compensation);
+    state.setIse(ise);
+    state.setIseCompensation(ise_compensation);
+    float itae = state.getItae();
+    float itae_compensation = state.getItaeCompensation();
+    Kernels::compensatedAdd(elapsed * absolute * delta_t, itae, itae_compensation);
+    state.setItae(itae);
+    state.setItaeCompensation(itae_compensation);
+
+    // Welford mean and variance
+    uint32_t samples = Kernels::nextSample(state.getSamples());
+    float deviation = error - state.getMean();
+    float mean = state.getMean() + deviation / (float)samples;
+    state.setSamples(samples);
+    state.setMean(mean);
+    state.setSumSquares(state.getSumSquares() + deviation * (error - mean));
+
+    // Load disturbance detection: a zero crossing closes a half period, which counts if its IAE is large
+    float sign = Kernels::hysteresisSign(error, settings.getHysteresis(), state.getSign());
+    bool crossing = sign * state.getSign() < 0.0f;
+    float segment_iae = state.getSegmentIae() + absolute * delta_t;
+    float weight = Kernels::forgetting(delta_t, settings.getSupervisionTime());
+    float detected = crossing && segment_iae > settings.getIaeLimit() ? 1.0f : 0.0f;
+    state.setSign(sign);
+    state.setSegmentIae(crossing ? 0.0f : segment_iae);
+    state.setDetections(state.getDetections() * (1.0f - weight) + detected);
+
+    // Recent mean square error for the health score
+    state.setMeanSquare(state.getMeanSquare() + weight * (squared - state.getMeanSquare()));
+}
+
+float LoopMetricsStateless::health(const LoopMetricsState &state, const LoopMetricsSettings &settings) {
+    return Kernels::health(state.getMeanSquare(), settings.getErrorTolerance(), state.getDetections(),
+                           settings.getDetectionLimit());
+}
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
@@ -0,0 +1,70 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless update of the closed loop performance metrics: IAE, ISE, ITAE, the Welford mean and variance of the
+ * error, oscillation detection and a health score, all in O(1) per sample.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_LOOP_METRICS_STATELESS_H
+#define CONTROLALGORITHMS_MONITOR_LOOP_METRICS_STATELESS_H
+
+#include <base/controlInput.h>
+#include <monitor/loopMetricsSettings.h>
+#include <monitor/loopMetricsState.h>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+class LoopMetricsStateless {
+    public:
+        /**
+         * Fold one sample into the metrics
+         * @param input [in]: Base::ControlInput the error and time step, e.g. the input given to the controller
+         * @param settings [in]: LoopMetricsSettings the metrics settings
+         * @param state [in/out]: LoopMetricsState the running metrics
+         */
+        static void update(const Base::ControlInput &input, const LoopMetricsSettings &settings, LoopMetricsState &state);
+
+        /**
+         * @return float health score in [0, 1], see Kernels::health
+         */
+        static float health(const LoopMetricsState &state, const LoopMetricsSettings &settings);
+
+        /**
+         * @return bool true if recent detections exceed the detection limit
+         */
+        static bool isOscillating(const LoopMetricsState &state, const LoopMetricsSettings &settings) {
+            return state.getDetections() > settings.getDetectionLimit();
+        }
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        LoopMetricsStateless() {};
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_LOOP_METRICS_STATELESS_H
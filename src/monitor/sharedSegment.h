@@ -0,0 +1,90 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A named POSIX shared memory segment (shm_open/mmap). On targets without POSIX shared memory, e.g. Arduino,
+ * every call fails and the segment stays closed.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_MONITOR_SHARED_SEGMENT_H
+#define CONTROLALGORITHMS_MONITOR_SHARED_SEGMENT_H
+
+#include <stddef.h>
+
+namespace ControlAlgorithms {
+namespace Monitor {
+
+class SharedSegment {
+    public:
+        SharedSegment() {};
+        virtual ~SharedSegment() { close(); };
+
+        /**
+         * Create the segment, or resize an existing one, and map it read/write
+         * @param name [in]: const char* segment name, starting with '/'
+         * @param size [in]: size_t segment size in bytes
+         * @return bool false if the segment could not be created or mapped
+         */
+        bool create(const char *name, size_t size);
+
+        /**
+         * Map an existing segment at its current size
+         * @param name [in]: const char* segment name, starting with '/'
+         * @param writable [in]: bool map read/write rather than read only
+         * @return bool false if the segment does not exist or could not be mapped
+         */
+        bool open(const char *name, bool writable);
+
+        /**
+         * Unmap the segment. The segment itself persists until unlink.
+         */
+        void close();
+
+        /**
+         * Remove a segment name; mappings stay valid until closed
+         * @param name [in]: const char* segment name
+         * @return bool false if the name did not exist
+         */
+        static bool unlink(const char *name);
+
+        void *getData() { return data_; }
+        const void *getData() const { return data_; }
+        size_t getSize() const { return size_; }
+        bool isOpen() const { return data_ != nullptr; }
+
+    private:
+        // Not copyable, the mapping is owned
+        SharedSegment(const SharedSegment &);
+        SharedSegment &operator=(const SharedSegment &);
+
+        // The mapping
+        void *data_{nullptr};
+        size_t size_{0};
+};
+
+}  // namespace Monitor
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_MONITOR_SHARED_SEGMENT_H
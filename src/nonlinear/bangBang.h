@@ -0,0 +1,119 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A hysteretic bang-bang controller for on/off actuators such as heaters, valves and relays.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_BANG_BANG_H
+#define CONTROLALGORITHMS_NONLINEAR_BANG_BANG_H
+
+#include <nonlinear/bangBangInput.h>
+#include <nonlinear/bangBangSettings.h>
+#include <nonlinear/bangBangOutput.h>
+#include <nonlinear/bangBangStateless.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class BangBang {
+    public:
+        BangBang() {};
+        virtual ~BangBang() {};
+
+        /**
+         * Set the controller settings
+         * @param settings [in]: BangBangSettings controller settings
+         */
+        virtual void setSettings(const BangBangSettings &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the controller settings
+         * @param settings [out]: BangBangSettings controller settings
+         */
+        virtual void getSettings(BangBangSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: BangBangOutput the internal state
+         */
+        virtual void getState(BangBangOutput &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: BangBangOutput the internal state
+         */
+        virtual void setState(const BangBangOutput &state) {
+            state_.copy(state);
+        }
+
+        /**
+         * The calculate function for the bang-bang controller
+         * @param input [in]: Base::ControlInput values used to calculate the control signal
+         * @param out [out]: Base::ControlOutput the output signal and any additional/changed data used for continued computations
+         */
+        virtual void update(const Base::ControlInput &input, Base::ControlOutput &out) {
+            // Fill the input with state in place; the new sample and state are written directly to the members
+            input_with_state_.setError(input.getError());
+            input_with_state_.setDeltaT(input.getDeltaT());
+            input_with_state_.setOn(state_.getOn());
+
+            // Run the update
+            BangBangStateless::update(input_with_state_, settings_, state_);
+
+            // Copy to output
+            out.copy(state_);
+        }
+
+        /**
+         * Reset the internal state. The switch starts off.
+         */
+        virtual void reset() {
+            state_.setOn(false);
+        }
+
+        virtual bool isStateful() { return true; }
+
+    private:
+        // The stored settings
+        BangBangSettings settings_;
+
+        // Contains all required state info
+        BangBangOutput state_;
+
+        // Used for the internal call with state
+        BangBangInput input_with_state_;
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_BANG_BANG_H
@@ -0,0 +1,148 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A fixed capacity bank of bang-bang controllers stored as structure of arrays and updated with BangBangBatch.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_BANG_BANG_BANK_H
+#define CONTROLALGORITHMS_NONLINEAR_BANG_BANG_BANK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <nonlinear/bangBangSettings.h>
+#include <nonlinear/bangBangBatch.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+template<size_t Capacity>
+class BangBangBank {
+    public:
+        BangBangBank() {
+            BangBangSettings defaults;
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                setSettings(loop, defaults);
+            }
+            resetAll();
+        };
+        virtual ~BangBangBank() {};
+
+        /**
+         * Set the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [in]: BangBangSettings controller settings
+         */
+        void setSettings(size_t loop, const BangBangSettings &settings) {
+            gain_[loop] = settings.getGain();
+            off_output_[loop] = settings.getOffOutput();
+            hysteresis_[loop] = settings.getHysteresis();
+        }
+
+        /**
+         * Get the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [out]: BangBangSettings controller settings
+         */
+        void getSettings(size_t loop, BangBangSettings &settings) const {
+            settings.setGain(gain_[loop]);
+            settings.setOffOutput(off_output_[loop]);
+            settings.setHysteresis(hysteresis_[loop]);
+        }
+
+        /**
+         * Update loops [0, count) with one sample each
+         * @param error [in]: float[count] current error signals
+         * @param delta_t [in]: float[count] unused, kept so all banks share one update signature
+         * @param count [in]: size_t number of loops, at most Capacity
+         */
+        void update(const float *error, const float *delta_t, size_t count) {
+            (void)delta_t;
+            BangBangBatch::update(error, gain_, off_output_, hysteresis_, on_, control_, count);
+        }
+
+        /**
+         * Update a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param delta_t [in]: float[count] unused, kept so all banks share one update signature
+         * @param count [in]: size_t number of samples
+         */
+        void updateIndexed(const uint32_t *loops, const float *error, const float *delta_t, size_t count) {
+            (void)delta_t;
+            BangBangBatch::updateIndexed(loops, error, gain_, off_output_, hysteresis_, on_, control_, count);
+        }
+
+        /**
+         * Reset the internal state of one loop. The switch starts off.
+         */
+        void reset(size_t loop) {
+            on_[loop] = 0;
+            control_[loop] = 0.0;
+        }
+
+        /**
+         * Reset the internal state of all loops
+         */
+        void resetAll() {
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                reset(loop);
+            }
+        }
+
+        float getControl(size_t loop) const { return control_[loop]; }
+        void setOn(size_t loop, bool on) { on_[loop] = on ? 1 : 0; }
+        bool getOn(size_t loop) const { return on_[loop] != 0; }
+        size_t capacity() const { return Capacity; }
+
+        // Raw per loop arrays, for bulk copies
+        float *getGainArray() { return gain_; }
+        const float *getGainArray() const { return gain_; }
+        float *getOffOutputArray() { return off_output_; }
+        const float *getOffOutputArray() const { return off_output_; }
+        float *getHysteresisArray() { return hysteresis_; }
+        const float *getHysteresisArray() const { return hysteresis_; }
+        uint8_t *getOnArray() { return on_; }
+        const uint8_t *getOnArray() const { return on_; }
+        float *getControlArray() { return control_; }
+        const float *getControlArray() const { return control_; }
+
+    private:
+        // Settings, one entry per loop
+        float gain_[Capacity];
+        float off_output_[Capacity];
+        float hysteresis_[Capacity];
+
+        // Switch state, one entry per loop
+        uint8_t on_[Capacity];
+
+        // Last control signal, one entry per loop
+        float control_[Capacity];
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_BANG_BANG_BANK_H
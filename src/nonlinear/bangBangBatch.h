@@ -0,0 +1,70 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) version of hysteretic bang-bang control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_BANG_BANG_BATCH_H
+#define CONTROLALGORITHMS_NONLINEAR_BANG_BANG_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class BangBangBatch {
+    public:
+        /**
+         * The calculate function for many independent bang-bang controllers. Element i of every array belongs to loop i.
+         * @param error [in]: float[count] current error signals
+         * @param gain [in]: float[count] control signals while on
+         * @param off_output [in]: float[count] control signals while off
+         * @param hysteresis [in]: float[count] half widths of the hold band
+         * @param on [in/out]: uint8_t[count] switch states, 0 or 1
+         * @param control [out]: float[count] control signals
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *error, const float *gain, const float *off_output, const float *hysteresis,
+                           uint8_t *on, float *control, size_t count);
+
+        /**
+         * The calculate function for a scattered subset of loops. Samples are applied in order, so a loop may appear more than once.
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * Remaining parameters are indexed by loop, as in update.
+         */
+        static void updateIndexed(const uint32_t *loops, const float *error, const float *gain, const float *off_output,
+                                  const float *hysteresis, uint8_t *on, float *control, size_t count);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        BangBangBatch() {};
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_BANG_BANG_BATCH_H
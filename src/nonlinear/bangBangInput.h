@@ -0,0 +1,65 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Input for bang-bang controller
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_BANG_BANG_INPUT_H
+#define CONTROLALGORITHMS_NONLINEAR_BANG_BANG_INPUT_H
+
+#include <base/controlInput.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class BangBangInput: public Base::ControlInput {
+    public:
+        BangBangInput () {};
+        virtual ~BangBangInput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: BangBangInput input
+         */
+        void copy(const BangBangInput &right) {
+            // Super call
+            Base::ControlInput::copy(right);
+
+            setOn(right.getOn());
+        }
+
+        void setOn(bool on) { on_ = on; }
+        bool getOn() const { return on_; }
+
+    private:
+        // The switch state after the previous call
+        bool on_{false};
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_BANG_BANG_INPUT_H
@@ -0,0 +1,71 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for a hysteretic bang-bang controller. The base gain is the control signal while the switch is on.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_BANG_BANG_SETTINGS_H
+#define CONTROLALGORITHMS_NONLINEAR_BANG_BANG_SETTINGS_H
+
+#include <base/controlSettings.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class BangBangSettings : public Base::ControlSettings {
+    public:
+        BangBangSettings () {};
+        virtual ~BangBangSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: BangBangSettings input control settings
+         */
+        void copy(const BangBangSettings &right) {
+            // Call super class
+            Base::ControlSettings::copy(right);
+
+            setOffOutput(right.getOffOutput());
+            setHysteresis(right.getHysteresis());
+        }
+
+        void setOffOutput(float off_output) { off_output_ = off_output; }
+        float getOffOutput() const { return off_output_; }
+        void setHysteresis(float hysteresis) { hysteresis_ = hysteresis; }
+        float getHysteresis() const { return hysteresis_; }
+
+    private:
+        // Control signal while the switch is off, e.g. 0 for on/off actuators or -gain for bipolar ones
+        float off_output_{0.0};
+
+        // The switch turns on above +hysteresis and off below -hysteresis, and holds in between
+        float hysteresis_{0.0};
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_BANG_BANG_SETTINGS_H
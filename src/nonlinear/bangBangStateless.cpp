@@ -0,0 +1,54 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of bang-bang control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "bangBangStateless.h"
+#include <nonlinear/nonlinearKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Nonlinear {
+
+// Compile time checks of the kernel: switching outside the band and holding inside it
+static_assert(Kernels::bangBang(0.6f, 0.5f, 0) == 1, "switch on above the band");
+static_assert(Kernels::bangBang(-0.6f, 0.5f, 1) == 0, "switch off below the band");
+static_assert(Kernels::bangBang(0.4f, 0.5f, 0) == 0, "hold off in the band");
+static_assert(Kernels::bangBang(-0.4f, 0.5f, 1) == 1, "hold on in the band");
+
+void BangBangStateless::update(const BangBangInput &input, const BangBangSettings &settings, BangBangOutput &out) {
+    uint8_t on = Kernels::bangBang(input.getError(), settings.getHysteresis(), input.getOn() ? 1 : 0);
+
+    // Save the switch state
+    out.setOn(on != 0);
+
+    // Calculate and return the control signal
+    out.setControl(Kernels::bangBangOutput(on, settings.getGain(), settings.getOffOutput()));
+}
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
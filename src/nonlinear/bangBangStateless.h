@@ -0,0 +1,58 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless version of hysteretic bang-bang control. Wraps Kernels::bangBang and Kernels::bangBangOutput from
+ * nonlinearKernels.h.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_BANG_BANG_STATELESS_H
+#define CONTROLALGORITHMS_NONLINEAR_BANG_BANG_STATELESS_H
+
+#include <nonlinear/bangBangInput.h>
+#include <nonlinear/bangBangSettings.h>
+#include <nonlinear/bangBangOutput.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class BangBangStateless {
+    public:
+        /**
+         * The calculate function for the bang-bang controller
+         * @param input [in]: BangBangInput values used to calculate the control signal
+         * @param settings [in]: BangBangSettings the controller settings
+         * @param out [out]: BangBangOutput the output signal and any additional/changed data used for continued computations
+         */
+        static void update(const BangBangInput &input, const BangBangSettings &settings, BangBangOutput &out);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        BangBangStateless() {};
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_BANG_BANG_STATELESS_H
@@ -0,0 +1,95 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Header only kernels of the sliding mode and bang-bang controllers on plain floats, constexpr like the PID
+ * kernels in pidKernels.h. The stateless, stateful and batch classes are built on these.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_NONLINEAR_KERNELS_H
+#define CONTROLALGORITHMS_NONLINEAR_NONLINEAR_KERNELS_H
+
+#include <float.h>
+#include <stdint.h>
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+namespace Kernels {
+
+/**
+ * Sliding variable s = e + slope * de/dt. The loop is driven towards s = 0, on which the error decays with time
+ * constant 1 / slope.
+ * @param error [in]: float the error signal
+ * @param previous_error [in]: float the error signal of the last call
+ * @param delta_t [in]: float time since the last call
+ * @param min_time_step [in]: float the smallest time step divided by
+ * @param slope [in]: float the surface slope
+ * @return float the sliding variable
+ */
+constexpr float slidingSurface(float error, float previous_error, float delta_t, float min_time_step, float slope) {
+    return error + slope * (error - previous_error) / PID::Kernels::lowerBound(delta_t, min_time_step);
+}
+
+/**
+ * Sliding mode control signal, gain * sat(s / boundary_layer). Inside the boundary layer the switching is replaced
+ * by a linear ramp, which removes the chattering of a pure sign(s) at the cost of a small steady band. A boundary
+ * layer of zero gives sign(s), with zero for s = 0.
+ * @param surface [in]: float the sliding variable
+ * @param boundary_layer [in]: float the boundary layer half width
+ * @param gain [in]: float the switching gain
+ * @return float the control signal
+ */
+constexpr float slidingMode(float surface, float boundary_layer, float gain) {
+    return PID::Kernels::limit(surface / PID::Kernels::lowerBound(boundary_layer, FLT_MIN), -1.0f, 1.0f) * gain;
+}
+
+/**
+ * Next state of a hysteretic switch: on above +hysteresis, off below -hysteresis and unchanged in between
+ * @param error [in]: float the error signal
+ * @param hysteresis [in]: float the half width of the band in which the switch holds
+ * @param on [in]: uint8_t the current state, 0 or 1
+ * @return uint8_t the new state, 0 or 1
+ */
+constexpr uint8_t bangBang(float error, float hysteresis, uint8_t on) {
+    return (uint8_t)((error > hysteresis) | (on & (uint8_t)!(error < -hysteresis)));
+}
+
+/**
+ * Bang-bang control signal
+ * @param on [in]: uint8_t the switch state
+ * @param on_output [in]: float the control signal when on
+ * @param off_output [in]: float the control signal when off
+ * @return float the control signal
+ */
+constexpr float bangBangOutput(uint8_t on, float on_output, float off_output) {
+    return on != 0 ? on_output : off_output;
+}
+
+}  // namespace Kernels
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_NONLINEAR_KERNELS_H
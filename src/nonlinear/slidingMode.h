@@ -0,0 +1,121 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A sliding mode controller with boundary layer smoothing, for loops that need robustness to plant uncertainty
+ * rather than linear behaviour.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_H
+#define CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_H
+
+#include <nonlinear/slidingModeInput.h>
+#include <nonlinear/slidingModeSettings.h>
+#include <nonlinear/slidingModeOutput.h>
+#include <nonlinear/slidingModeStateless.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class SlidingMode {
+    public:
+        SlidingMode() {};
+        virtual ~SlidingMode() {};
+
+        /**
+         * Set the controller settings
+         * @param settings [in]: SlidingModeSettings controller settings
+         */
+        virtual void setSettings(const SlidingModeSettings &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the controller settings
+         * @param settings [out]: SlidingModeSettings controller settings
+         */
+        virtual void getSettings(SlidingModeSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: SlidingModeOutput the internal state
+         */
+        virtual void getState(SlidingModeOutput &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: SlidingModeOutput the internal state
+         */
+        virtual void setState(const SlidingModeOutput &state) {
+            state_.copy(state);
+        }
+
+        /**
+         * The calculate function for the sliding mode controller
+         * @param input [in]: Base::ControlInput values used to calculate the control signal
+         * @param out [out]: Base::ControlOutput the output signal and any additional/changed data used for continued computations
+         */
+        virtual void update(const Base::ControlInput &input, Base::ControlOutput &out) {
+            // Fill the input with state in place; the new sample and state are written directly to the members
+            input_with_state_.setError(input.getError());
+            input_with_state_.setDeltaT(input.getDeltaT());
+            input_with_state_.setPreviousError(state_.getPreviousError());
+
+            // Run the update
+            SlidingModeStateless::update(input_with_state_, settings_, state_);
+
+            // Copy to output
+            out.copy(state_);
+        }
+
+        /**
+         * Reset the internal state
+         */
+        virtual void reset() {
+            state_.setPreviousError(0.0);
+            state_.setSurface(0.0);
+        }
+
+        virtual bool isStateful() { return true; }
+
+    private:
+        // The stored settings
+        SlidingModeSettings settings_;
+
+        // Contains all required state info
+        SlidingModeOutput state_;
+
+        // Used for the internal call with state
+        SlidingModeInput input_with_state_;
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_H
@@ -0,0 +1,157 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A fixed capacity bank of sliding mode controllers stored as structure of arrays and updated with SlidingModeBatch.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_BANK_H
+#define CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_BANK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <nonlinear/slidingModeSettings.h>
+#include <nonlinear/slidingModeBatch.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+template<size_t Capacity>
+class SlidingModeBank {
+    public:
+        SlidingModeBank() {
+            SlidingModeSettings defaults;
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                setSettings(loop, defaults);
+            }
+            resetAll();
+        };
+        virtual ~SlidingModeBank() {};
+
+        /**
+         * Set the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [in]: SlidingModeSettings controller settings
+         */
+        void setSettings(size_t loop, const SlidingModeSettings &settings) {
+            gain_[loop] = settings.getGain();
+            slope_[loop] = settings.getSlope();
+            boundary_layer_[loop] = settings.getBoundaryLayer();
+            min_time_step_[loop] = settings.getMinTimeStep();
+        }
+
+        /**
+         * Get the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [out]: SlidingModeSettings controller settings
+         */
+        void getSettings(size_t loop, SlidingModeSettings &settings) const {
+            settings.setGain(gain_[loop]);
+            settings.setSlope(slope_[loop]);
+            settings.setBoundaryLayer(boundary_layer_[loop]);
+            settings.setMinTimeStep(min_time_step_[loop]);
+        }
+
+        /**
+         * Update loops [0, count) with one sample each
+         * @param error [in]: float[count] current error signals
+         * @param delta_t [in]: float[count] time since the last call
+         * @param count [in]: size_t number of loops, at most Capacity
+         */
+        void update(const float *error, const float *delta_t, size_t count) {
+            SlidingModeBatch::update(error, delta_t, gain_, slope_, boundary_layer_, min_time_step_, previous_error_,
+                                     surface_, control_, count);
+        }
+
+        /**
+         * Update a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param delta_t [in]: float[count] time step of each sample
+         * @param count [in]: size_t number of samples
+         */
+        void updateIndexed(const uint32_t *loops, const float *error, const float *delta_t, size_t count) {
+            SlidingModeBatch::updateIndexed(loops, error, delta_t, gain_, slope_, boundary_layer_, min_time_step_,
+                                            previous_error_, surface_, control_, count);
+        }
+
+        /**
+         * Reset the internal state of one loop
+         */
+        void reset(size_t loop) {
+            previous_error_[loop] = 0.0;
+            surface_[loop] = 0.0;
+            control_[loop] = 0.0;
+        }
+
+        /**
+         * Reset the internal state of all loops
+         */
+        void resetAll() {
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                reset(loop);
+            }
+        }
+
+        float getControl(size_t loop) const { return control_[loop]; }
+        float getSurface(size_t loop) const { return surface_[loop]; }
+        void setPreviousError(size_t loop, float previous_error) { previous_error_[loop] = previous_error; }
+        float getPreviousError(size_t loop) const { return previous_error_[loop]; }
+        size_t capacity() const { return Capacity; }
+
+        // Raw per loop arrays, for bulk copies
+        float *getGainArray() { return gain_; }
+        const float *getGainArray() const { return gain_; }
+        float *getSlopeArray() { return slope_; }
+        const float *getSlopeArray() const { return slope_; }
+        float *getBoundaryLayerArray() { return boundary_layer_; }
+        const float *getBoundaryLayerArray() const { return boundary_layer_; }
+        float *getMinTimeStepArray() { return min_time_step_; }
+        const float *getMinTimeStepArray() const { return min_time_step_; }
+        float *getPreviousErrorArray() { return previous_error_; }
+        const float *getPreviousErrorArray() const { return previous_error_; }
+        float *getControlArray() { return control_; }
+        const float *getControlArray() const { return control_; }
+        const float *getSurfaceArray() const { return surface_; }
+
+    private:
+        // Settings, one entry per loop
+        float gain_[Capacity];
+        float slope_[Capacity];
+        float boundary_layer_[Capacity];
+        float min_time_step_[Capacity];
+
+        // State, one entry per loop
+        float previous_error_[Capacity];
+
+        // Last sliding variable and control signal, one entry per loop
+        float surface_[Capacity];
+        float control_[Capacity];
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_BANK_H
@@ -0,0 +1,74 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of sliding mode control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "slidingModeBatch.h"
+#include <float.h>
+#include <base/branchless.h>
+#include <nonlinear/nonlinearKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Nonlinear {
+
+// The arrays of one call must not overlap. __restrict lets the loops vectorize without runtime alias checks.
+void SlidingModeBatch::update(const float *__restrict error, const float *__restrict delta_t,
+                              const float *__restrict gain, const float *__restrict slope,
+                              const float *__restrict boundary_layer, const float *__restrict min_time_step,
+                              float *__restrict previous_error, float *__restrict surface, float *__restrict control,
+                              size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        float current = Kernels::slidingSurface(error[i], previous_error[i], delta_t[i], min_time_step[i], slope[i]);
+
+        // Calculate the control signal. Kernels::slidingMode saturates with ternaries, into which gcc sinks the
+        // multiply by the gain and then cannot if-convert it; masks keep the loop branch free with identical results.
+        float ratio = current / PID::Kernels::lowerBound(boundary_layer[i], FLT_MIN);
+        float lower = Base::Branchless::select(Base::Branchless::mask(-1.0f < ratio), ratio, -1.0f);
+        float saturated = Base::Branchless::select(Base::Branchless::mask(lower < 1.0f), lower, 1.0f);
+        control[i] = saturated * gain[i];
+        surface[i] = current;
+
+        // Save the previous error
+        previous_error[i] = error[i];
+    }
+}
+
+void SlidingModeBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict error,
+                                     const float *__restrict delta_t, const float *__restrict gain,
+                                     const float *__restrict slope, const float *__restrict boundary_layer,
+                                     const float *__restrict min_time_step, float *__restrict previous_error,
+                                     float *__restrict surface, float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        update(&error[i], &delta_t[i], &gain[loop], &slope[loop], &boundary_layer[loop], &min_time_step[loop],
+               &previous_error[loop], &surface[loop], &control[loop], 1);
+    }
+}
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
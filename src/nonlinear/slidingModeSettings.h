@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for a sliding mode controller. The base gain is the switching gain.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_SETTINGS_H
+#define CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_SETTINGS_H
+
+#include <base/controlSettings.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class SlidingModeSettings : public Base::ControlSettings {
+    public:
+        SlidingModeSettings () {};
+        virtual ~SlidingModeSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: SlidingModeSettings input control settings
+         */
+        void copy(const SlidingModeSettings &right) {
+            // Call super class
+            Base::ControlSettings::copy(right);
+
+            setSlope(right.getSlope());
+            setBoundaryLayer(right.getBoundaryLayer());
+            setMinTimeStep(right.getMinTimeStep());
+        }
+
+        void setSlope(float slope) { slope_ = slope; }
+        float getSlope() const { return slope_; }
+        void setBoundaryLayer(float boundary_layer) { boundary_layer_ = boundary_layer; }
+        float getBoundaryLayer() const { return boundary_layer_; }
+        void setMinTimeStep(float min_time_step) { min_time_step_ = min_time_step; }
+        float getMinTimeStep() const { return min_time_step_; }
+
+    private:
+        // Weight of the error rate in the sliding variable; on the surface the error decays with time constant 1/slope
+        float slope_{0.0};
+
+        // Half width of the boundary layer in which the output ramps linearly instead of switching
+        float boundary_layer_{1.0};
+
+        // The minimum time step allowed
+        float min_time_step_{0.0000001};
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_SETTINGS_H
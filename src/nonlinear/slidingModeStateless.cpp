@@ -0,0 +1,58 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of sliding mode control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "slidingModeStateless.h"
+#include <nonlinear/nonlinearKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace Nonlinear {
+
+// Compile time checks of the kernels: the surface, the linear ramp inside the boundary layer, saturation outside it
+// and the pure switch of a zero boundary layer
+static_assert(Kernels::slidingSurface(1.0f, 0.5f, 0.5f, 0.0000001f, 2.0f) == 3.0f, "sliding surface");
+static_assert(Kernels::slidingMode(0.5f, 2.0f, 4.0f) == 1.0f, "inside the boundary layer");
+static_assert(Kernels::slidingMode(-3.0f, 2.0f, 4.0f) == -4.0f, "outside the boundary layer");
+static_assert(Kernels::slidingMode(0.001f, 0.0f, 4.0f) == 4.0f, "zero boundary layer");
+static_assert(Kernels::slidingMode(0.0f, 0.0f, 4.0f) == 0.0f, "zero boundary layer on the surface");
+
+void SlidingModeStateless::update(const SlidingModeInput &input, const SlidingModeSettings &settings, SlidingModeOutput &out) {
+    float surface = Kernels::slidingSurface(input.getError(), input.getPreviousError(), input.getDeltaT(),
+                                            settings.getMinTimeStep(), settings.getSlope());
+
+    // Save the previous error and the sliding variable
+    out.setPreviousError(input.getError());
+    out.setSurface(surface);
+
+    // Calculate and return the control signal
+    out.setControl(Kernels::slidingMode(surface, settings.getBoundaryLayer(), settings.getGain()));
+}
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
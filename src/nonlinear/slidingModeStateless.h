@@ -0,0 +1,58 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless version of sliding mode control with a boundary layer. Wraps Kernels::slidingSurface and
+ * Kernels::slidingMode from nonlinearKernels.h.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_STATELESS_H
+#define CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_STATELESS_H
+
+#include <nonlinear/slidingModeInput.h>
+#include <nonlinear/slidingModeSettings.h>
+#include <nonlinear/slidingModeOutput.h>
+
+namespace ControlAlgorithms {
+namespace Nonlinear {
+
+class SlidingModeStateless {
+    public:
+        /**
+         * The calculate function for the sliding mode controller
+         * @param input [in]: SlidingModeInput values used to calculate the control signal
+         * @param settings [in]: SlidingModeSettings the controller settings
+         * @param out [out]: SlidingModeOutput the output signal and any additional/changed data used for continued computations
+         */
+        static void update(const SlidingModeInput &input, const SlidingModeSettings &settings, SlidingModeOutput &out);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        SlidingModeStateless() {};
+};
+
+}  // namespace Nonlinear
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_NONLINEAR_SLIDING_MODE_STATELESS_H
@@ -0,0 +1,186 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Binary controller configuration
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "config.h"
+
+namespace ControlAlgorithms {
+
+namespace Persist {
+
+namespace {
+
+// Every block and section starts on this boundary
+const size_t SECTION_ALIGNMENT = 16;
+
+size_t alignUp(size_t value) {
+    return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+size_t elementSize(uint16_t kind, uint32_t section) {
+    return (kind == SNAPSHOT_INTEGRAL && section == CONFIG_INTEGRAL_HAS_LIMITS) ? sizeof(uint8_t) : sizeof(float);
+}
+
+}  // namespace
+
+const void *ConfigBlock::getSection(uint32_t section) const {
+    return reinterpret_cast<const uint8_t *>(header_) + Config::sectionOffset(header_->kind, header_->count, section);
+}
+
+bool ConfigView::open(const void *image, size_t size, bool verify_checksum) {
+    header_ = nullptr;
+    if(image == nullptr || size < sizeof(ConfigHeader)) {
+        return false;
+    }
+    const ConfigHeader *header = static_cast<const ConfigHeader *>(image);
+    if(header->magic != CONFIG_MAGIC || header->byte_order != SNAPSHOT_BYTE_ORDER ||
+       header->version != CONFIG_VERSION || header->image_size > size || header->image_size < sizeof(ConfigHeader)) {
+        return false;
+    }
+
+    // Every block must be a known kind of the size its count implies, and the blocks must fill the image
+    size_t offset = alignUp(sizeof(ConfigHeader));
+    for(uint16_t index = 0; index < header->block_count; ++index) {
+        if(offset + sizeof(ConfigBlockHeader) > header->image_size) {
+            return false;
+        }
+        const ConfigBlockHeader *block =
+            reinterpret_cast<const ConfigBlockHeader *>(static_cast<const uint8_t *>(image) + offset);
+        // Every kind has a float section, so a count the rest of the image cannot hold is rejected before sizing
+        if(block->count > (header->image_size - offset) / sizeof(float)) {
+            return false;
+        }
+        size_t block_size = Config::blockSize(block->kind, block->count);
+        if(block_size == 0 || block->block_size != block_size || offset + block_size > header->image_size) {
+            return false;
+        }
+        offset += block_size;
+    }
+    if(offset != header->image_size) {
+        return false;
+    }
+    if(verify_checksum &&
+       header->checksum != Snapshot::checksum(header + 1, header->image_size - sizeof(ConfigHeader))) {
+        return false;
+    }
+    header_ = header;
+    return true;
+}
+
+ConfigBlock ConfigView::getBlock(uint16_t index) const {
+    if(header_ == nullptr || index >= header_->block_count) {
+        return ConfigBlock();
+    }
+    const uint8_t *position = reinterpret_cast<const uint8_t *>(header_) + alignUp(sizeof(ConfigHeader));
+    for(uint16_t block = 0; block < index; ++block) {
+        position += reinterpret_cast<const ConfigBlockHeader *>(position)->block_size;
+    }
+    return ConfigBlock(reinterpret_cast<const ConfigBlockHeader *>(position));
+}
+
+bool ConfigWriter::begin(void *image, size_t size) {
+    image_ = nullptr;
+    block_ = nullptr;
+    size_t header_size = alignUp(sizeof(ConfigHeader));
+    if(image == nullptr || size < header_size) {
+        return false;
+    }
+    image_ = static_cast<uint8_t *>(image);
+    capacity_ = size;
+    size_ = header_size;
+    memset(image_, 0, header_size);
+    return true;
+}
+
+bool ConfigWriter::addBlock(uint16_t kind, uint32_t count) {
+    ConfigHeader *header = reinterpret_cast<ConfigHeader *>(image_);
+    size_t block_size = Config::blockSize(kind, count);
+    if(image_ == nullptr || block_size == 0 || block_size > capacity_ - size_ || size_ + block_size > UINT32_MAX ||
+       header->block_count == UINT16_MAX) {
+        return false;
+    }
+    // Padding is part of the checksum, so the whole block starts zeroed
+    memset(image_ + size_, 0, block_size);
+    block_ = reinterpret_cast<ConfigBlockHeader *>(image_ + size_);
+    block_->kind = kind;
+    block_->count = count;
+    block_->block_size = (uint32_t)block_size;
+    size_ += block_size;
+    ++header->block_count;
+    return true;
+}
+
+void *ConfigWriter::getSection(uint32_t section) {
+    return reinterpret_cast<uint8_t *>(block_) + Config::sectionOffset(block_->kind, block_->count, section);
+}
+
+size_t ConfigWriter::finish() {
+    if(image_ == nullptr) {
+        return 0;
+    }
+    ConfigHeader *header = reinterpret_cast<ConfigHeader *>(image_);
+    header->magic = CONFIG_MAGIC;
+    header->version = CONFIG_VERSION;
+    header->byte_order = SNAPSHOT_BYTE_ORDER;
+    header->image_size = (uint32_t)size_;
+    header->checksum = Snapshot::checksum(header + 1, size_ - sizeof(ConfigHeader));
+    return size_;
+}
+
+uint32_t Config::sectionCount(uint16_t kind) {
+    switch(kind) {
+        case SNAPSHOT_PROPORTIONAL:
+            return 1;
+        case SNAPSHOT_INTEGRAL:
+            return 5;
+        case SNAPSHOT_DERIVATIVE:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+size_t Config::sectionOffset(uint16_t kind, uint32_t count, uint32_t section) {
+    size_t offset = alignUp(sizeof(ConfigBlockHeader));
+    for(uint32_t index = 0; index < section; ++index) {
+        offset += alignUp(elementSize(kind, index) * count);
+    }
+    return offset;
+}
+
+size_t Config::blockSize(uint16_t kind, uint32_t count) {
+    uint32_t sections = sectionCount(kind);
+    // As Snapshot::imageSize, the count is bounded so the sections cannot wrap a 32 bit size_t
+    if(sections == 0 || count > UINT32_MAX / ((sections + 1) * sizeof(float))) {
+        return 0;
+    }
+    return sectionOffset(kind, count, sections);
+}
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
@@ -0,0 +1,306 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Binary controller configuration for provisioning many loops at start-up. Unlike a snapshot it holds settings
+ * only, and one image holds any number of banks of any kind.
+ *
+ * Image layout (native byte order, recorded in the header):
+ *     ConfigHeader (32 bytes)
+ *     blocks, one per bank, each a ConfigBlockHeader (16 bytes) followed by the settings arrays of its kind,
+ *     count elements long and starting on 16 byte boundaries
+ * Integral:     gain, min limit, max limit, max time step (float), has limits (uint8_t)
+ * Derivative:   gain, min time step, max time step (float)
+ * Proportional: gain (float)
+ *
+ * Sections match the bank settings arrays, so Config::load fills a bank with one memcpy per array straight from
+ * a mapped file. Images are written by ConfigWriter, from banks or, through ConfigText, from a text file.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PERSIST_CONFIG_H
+#define CONTROLALGORITHMS_PERSIST_CONFIG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <persist/snapshot.h>
+#include <pid/proportionalBank.h>
+#include <pid/integralBank.h>
+#include <pid/derivativeBank.h>
+
+namespace ControlAlgorithms {
+namespace Persist {
+
+// Blocks use the snapshot kinds: SNAPSHOT_PROPORTIONAL, SNAPSHOT_INTEGRAL and SNAPSHOT_DERIVATIVE
+
+// Sections of each kind, in block order
+const uint32_t CONFIG_PROPORTIONAL_GAIN = 0;
+const uint32_t CONFIG_INTEGRAL_GAIN = 0;
+const uint32_t CONFIG_INTEGRAL_MIN_LIMIT = 1;
+const uint32_t CONFIG_INTEGRAL_MAX_LIMIT = 2;
+const uint32_t CONFIG_INTEGRAL_MAX_TIME_STEP = 3;
+const uint32_t CONFIG_INTEGRAL_HAS_LIMITS = 4;
+const uint32_t CONFIG_DERIVATIVE_GAIN = 0;
+const uint32_t CONFIG_DERIVATIVE_MIN_TIME_STEP = 1;
+const uint32_t CONFIG_DERIVATIVE_MAX_TIME_STEP = 2;
+
+struct ConfigHeader {
+    // CONFIG_MAGIC
+    uint32_t magic;
+    // CONFIG_VERSION of the writer
+    uint16_t version;
+    // Number of blocks following the header
+    uint16_t block_count;
+    // SNAPSHOT_BYTE_ORDER as written; reads back differently on a host of the other endianness
+    uint32_t byte_order;
+    // Total image size in bytes, header included
+    uint32_t image_size;
+    // Snapshot::checksum of everything after the header
+    uint32_t checksum;
+    uint32_t reserved[3];
+};
+
+struct ConfigBlockHeader {
+    // Controller kind of the bank
+    uint16_t kind;
+    uint16_t reserved;
+    // Number of loops
+    uint32_t count;
+    // Block size in bytes, this header included
+    uint32_t block_size;
+    uint32_t reserved2;
+};
+
+const uint32_t CONFIG_MAGIC = 0x46434143;  // "CACF" in little endian
+const uint16_t CONFIG_VERSION = 1;
+
+class ConfigBlock {
+    public:
+        ConfigBlock () {};
+        explicit ConfigBlock (const ConfigBlockHeader *header): header_(header) {};
+
+        bool isValid() const { return header_ != nullptr; }
+        uint16_t getKind() const { return header_->kind; }
+        uint32_t getCount() const { return header_->count; }
+
+        /**
+         * Pointer to a section in place
+         * @param section [in]: uint32_t section index for the block kind
+         * @return const void* the section
+         */
+        const void *getSection(uint32_t section) const;
+        const float *getFloatSection(uint32_t section) const { return static_cast<const float *>(getSection(section)); }
+
+    private:
+        // The block in the image, nullptr if there is none
+        const ConfigBlockHeader *header_{nullptr};
+};
+
+class ConfigView {
+    public:
+        ConfigView () {};
+        virtual ~ConfigView() {};
+
+        /**
+         * Validate an image, including every block, and point the view at it. Nothing is copied; the image must
+         * outlive the view.
+         * @param image [in]: const void* start of the image, e.g. a mapped file
+         * @param size [in]: size_t bytes available
+         * @param verify_checksum [in]: bool whether to check the payload checksum
+         * @return bool true if the image is valid
+         */
+        bool open(const void *image, size_t size, bool verify_checksum = true);
+
+        bool isOpen() const { return header_ != nullptr; }
+        uint16_t getBlockCount() const { return header_ != nullptr ? header_->block_count : 0; }
+
+        /**
+         * A block, in image order
+         * @param index [in]: uint16_t block index
+         * @return ConfigBlock the block, invalid if index is out of range
+         */
+        ConfigBlock getBlock(uint16_t index) const;
+
+    private:
+        // The validated header, nullptr until open succeeds
+        const ConfigHeader *header_{nullptr};
+};
+
+class ConfigWriter {
+    public:
+        ConfigWriter () {};
+        virtual ~ConfigWriter() {};
+
+        /**
+         * Start an image
+         * @param image [out]: void* destination, 16 byte aligned
+         * @param size [in]: size_t bytes available
+         * @return bool false if not even the header fits
+         */
+        bool begin(void *image, size_t size);
+
+        /**
+         * Append a block of zeroed settings arrays, to be filled through getSection
+         * @param kind [in]: uint16_t controller kind
+         * @param count [in]: uint32_t number of loops
+         * @return bool false if the kind is unknown or the block does not fit
+         */
+        bool addBlock(uint16_t kind, uint32_t count);
+
+        /**
+         * Section of the last block added
+         * @param section [in]: uint32_t section index for the block kind
+         * @return void* the section
+         */
+        void *getSection(uint32_t section);
+
+        /**
+         * Append the settings of the first count loops of a bank
+         * @param bank [in]: bank to write
+         * @param count [in]: uint32_t number of loops, at most the bank capacity
+         * @return bool false if the block does not fit
+         */
+        template<size_t Capacity>
+        bool add(const PID::IntegralBank<Capacity> &bank, uint32_t count) {
+            if(count > Capacity || !addBlock(SNAPSHOT_INTEGRAL, count)) {
+                return false;
+            }
+            memcpy(getSection(CONFIG_INTEGRAL_GAIN), bank.getGainArray(), count * sizeof(float));
+            memcpy(getSection(CONFIG_INTEGRAL_MIN_LIMIT), bank.getMinLimitArray(), count * sizeof(float));
+            memcpy(getSection(CONFIG_INTEGRAL_MAX_LIMIT), bank.getMaxLimitArray(), count * sizeof(float));
+            memcpy(getSection(CONFIG_INTEGRAL_MAX_TIME_STEP), bank.getMaxTimeStepArray(), count * sizeof(float));
+            memcpy(getSection(CONFIG_INTEGRAL_HAS_LIMITS), bank.getHasLimitsArray(), count * sizeof(uint8_t));
+            return true;
+        }
+        template<size_t Capacity>
+        bool add(const PID::DerivativeBank<Capacity> &bank, uint32_t count) {
+            if(count > Capacity || !addBlock(SNAPSHOT_DERIVATIVE, count)) {
+                return false;
+            }
+            memcpy(getSection(CONFIG_DERIVATIVE_GAIN), bank.getGainArray(), count * sizeof(float));
+            memcpy(getSection(CONFIG_DERIVATIVE_MIN_TIME_STEP), bank.getMinTimeStepArray(), count * sizeof(float));
+            memcpy(getSection(CONFIG_DERIVATIVE_MAX_TIME_STEP), bank.getMaxTimeStepArray(), count * sizeof(float));
+            return true;
+        }
+        template<size_t Capacity>
+        bool add(const PID::ProportionalBank<Capacity> &bank, uint32_t count) {
+            if(count > Capacity || !addBlock(SNAPSHOT_PROPORTIONAL, count)) {
+                return false;
+            }
+            memcpy(getSection(CONFIG_PROPORTIONAL_GAIN), bank.getGainArray(), count * sizeof(float));
+            return true;
+        }
+
+        /**
+         * Compute the checksum and close the image
+         * @return size_t bytes written, 0 if begin failed
+         */
+        size_t finish();
+
+    private:
+        // The image being written, nullptr until begin succeeds
+        uint8_t *image_{nullptr};
+        size_t capacity_{0};
+
+        // Bytes used so far and the start of the last block
+        size_t size_{0};
+        ConfigBlockHeader *block_{nullptr};
+};
+
+class Config {
+    public:
+        /**
+         * Number of sections for a kind
+         * @return uint32_t sections, 0 for an unknown kind
+         */
+        static uint32_t sectionCount(uint16_t kind);
+
+        /**
+         * Offset of a section from the start of its block
+         * @return size_t offset in bytes
+         */
+        static size_t sectionOffset(uint16_t kind, uint32_t count, uint32_t section);
+
+        /**
+         * Size of a block for a kind and loop count
+         * @return size_t bytes, header included; 0 for an unknown kind or a count whose block would not fit in
+         * 32 bits
+         */
+        static size_t blockSize(uint16_t kind, uint32_t count);
+
+        /**
+         * Provision a bank from a block. Loops beyond the block count are left untouched, as is all state.
+         * @param block [in]: ConfigBlock a block of an open view
+         * @param bank [out]: bank to provision
+         * @return bool false if the kind does not match or the block holds more loops than the bank
+         */
+        template<size_t Capacity>
+        static bool load(const ConfigBlock &block, PID::IntegralBank<Capacity> &bank) {
+            if(!matches(block, SNAPSHOT_INTEGRAL, Capacity)) {
+                return false;
+            }
+            copyIn(block, CONFIG_INTEGRAL_GAIN, bank.getGainArray(), sizeof(float));
+            copyIn(block, CONFIG_INTEGRAL_MIN_LIMIT, bank.getMinLimitArray(), sizeof(float));
+            copyIn(block, CONFIG_INTEGRAL_MAX_LIMIT, bank.getMaxLimitArray(), sizeof(float));
+            copyIn(block, CONFIG_INTEGRAL_MAX_TIME_STEP, bank.getMaxTimeStepArray(), sizeof(float));
+            copyIn(block, CONFIG_INTEGRAL_HAS_LIMITS, bank.getHasLimitsArray(), sizeof(uint8_t));
+            return true;
+        }
+        template<size_t Capacity>
+        static bool load(const ConfigBlock &block, PID::DerivativeBank<Capacity> &bank) {
+            if(!matches(block, SNAPSHOT_DERIVATIVE, Capacity)) {
+                return false;
+            }
+            copyIn(block, CONFIG_DERIVATIVE_GAIN, bank.getGainArray(), sizeof(float));
+            copyIn(block, CONFIG_DERIVATIVE_MIN_TIME_STEP, bank.getMinTimeStepArray(), sizeof(float));
+            copyIn(block, CONFIG_DERIVATIVE_MAX_TIME_STEP, bank.getMaxTimeStepArray(), sizeof(float));
+            return true;
+        }
+        template<size_t Capacity>
+        static bool load(const ConfigBlock &block, PID::ProportionalBank<Capacity> &bank) {
+            if(!matches(block, SNAPSHOT_PROPORTIONAL, Capacity)) {
+                return false;
+            }
+            copyIn(block, CONFIG_PROPORTIONAL_GAIN, bank.getGainArray(), sizeof(float));
+            return true;
+        }
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Config() {};
+
+        // Check a block against the kind and capacity being provisioned
+        static bool matches(const ConfigBlock &block, uint16_t kind, size_t capacity) {
+            return block.isValid() && block.getKind() == kind && block.getCount() <= capacity;
+        }
+        static void copyIn(const ConfigBlock &block, uint32_t index, void *destination, size_t element_size) {
+            memcpy(destination, block.getSection(index), element_size * block.getCount());
+        }
+};
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PERSIST_CONFIG_H
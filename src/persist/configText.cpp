@@ -0,0 +1,217 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Conversion of the text configuration to the binary image
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "configText.h"
+#include <stdlib.h>
+#include <string.h>
+#include <persist/config.h>
+#include <pid/derivativeSettings.h>
+#include <pid/integralSettings.h>
+
+namespace ControlAlgorithms {
+
+namespace Persist {
+
+namespace {
+
+// Most settings on one loop line
+const uint32_t MAX_FIELDS = 5;
+
+struct Bank {
+    uint16_t kind;
+    uint32_t count;
+};
+
+bool isSpace(char character) {
+    return character == ' ' || character == '\t' || character == '\r';
+}
+
+/**
+ * Parse the text. Without a writer the banks are only counted; with one, the blocks are added and filled.
+ * @return bool false on an error, with its line in error_line
+ */
+bool parse(const char *text, size_t length, Bank *banks, uint16_t &bank_count, ConfigWriter *writer,
+           uint32_t &error_line) {
+    PID::IntegralSettings integral_defaults;
+    PID::DerivativeSettings derivative_defaults;
+    char line[CONFIG_TEXT_MAX_LINE + 1];
+    uint32_t line_number = 0;
+    uint16_t bank = 0;
+    bool in_bank = false;
+    uint32_t loop = 0;
+    size_t position = 0;
+    bank_count = writer != nullptr ? bank_count : 0;
+    error_line = 0;
+
+    while(position < length) {
+        // Copy one line out, so it can be terminated for strtof
+        size_t end = position;
+        while(end < length && text[end] != '\n') {
+            ++end;
+        }
+        ++line_number;
+        size_t line_length = end - position;
+        if(line_length > CONFIG_TEXT_MAX_LINE) {
+            error_line = line_number;
+            return false;
+        }
+        memcpy(line, text + position, line_length);
+        line[line_length] = '\0';
+        position = end + 1;
+        char *comment = strchr(line, '#');
+        if(comment != nullptr) {
+            *comment = '\0';
+        }
+        char *cursor = line;
+        while(isSpace(*cursor)) {
+            ++cursor;
+        }
+        if(*cursor == '\0') {
+            continue;
+        }
+
+        if(strncmp(cursor, "bank", 4) == 0 && isSpace(cursor[4])) {
+            cursor += 4;
+            while(isSpace(*cursor)) {
+                ++cursor;
+            }
+            size_t word = 0;
+            while(cursor[word] != '\0' && !isSpace(cursor[word])) {
+                ++word;
+            }
+            uint16_t kind = 0;
+            if(word == 12 && strncmp(cursor, "proportional", word) == 0) {
+                kind = SNAPSHOT_PROPORTIONAL;
+            } else if(word == 8 && strncmp(cursor, "integral", word) == 0) {
+                kind = SNAPSHOT_INTEGRAL;
+            } else if(word == 10 && strncmp(cursor, "derivative", word) == 0) {
+                kind = SNAPSHOT_DERIVATIVE;
+            }
+            cursor += word;
+            while(isSpace(*cursor)) {
+                ++cursor;
+            }
+            uint16_t next = in_bank ? bank + 1 : 0;
+            if(kind == 0 || *cursor != '\0' || next >= CONFIG_TEXT_MAX_BANKS) {
+                error_line = line_number;
+                return false;
+            }
+            bank = next;
+            in_bank = true;
+            loop = 0;
+            if(writer == nullptr) {
+                banks[bank].kind = kind;
+                banks[bank].count = 0;
+                bank_count = bank + 1;
+            } else if(!writer->addBlock(banks[bank].kind, banks[bank].count)) {
+                error_line = line_number;
+                return false;
+            }
+            continue;
+        }
+
+        // A loop line: up to MAX_FIELDS numbers
+        float fields[MAX_FIELDS];
+        uint32_t field_count = 0;
+        while(*cursor != '\0') {
+            char *number_end = cursor;
+            float value = strtof(cursor, &number_end);
+            if(number_end == cursor || field_count == MAX_FIELDS || (*number_end != '\0' && !isSpace(*number_end))) {
+                error_line = line_number;
+                return false;
+            }
+            fields[field_count++] = value;
+            cursor = number_end;
+            while(isSpace(*cursor)) {
+                ++cursor;
+            }
+        }
+        if(!in_bank || field_count > Config::sectionCount(banks[bank].kind)) {
+            error_line = line_number;
+            return false;
+        }
+        if(writer == nullptr) {
+            ++banks[bank].count;
+            continue;
+        }
+
+        switch(banks[bank].kind) {
+            case SNAPSHOT_PROPORTIONAL:
+                static_cast<float *>(writer->getSection(CONFIG_PROPORTIONAL_GAIN))[loop] = fields[0];
+                break;
+            case SNAPSHOT_INTEGRAL:
+                static_cast<float *>(writer->getSection(CONFIG_INTEGRAL_GAIN))[loop] = fields[0];
+                static_cast<uint8_t *>(writer->getSection(CONFIG_INTEGRAL_HAS_LIMITS))[loop] =
+                    field_count > 1 ? (fields[1] != 0.0f ? 1 : 0) : (integral_defaults.getHasLimits() ? 1 : 0);
+                static_cast<float *>(writer->getSection(CONFIG_INTEGRAL_MIN_LIMIT))[loop] =
+                    field_count > 2 ? fields[2] : integral_defaults.getMinLimit();
+                static_cast<float *>(writer->getSection(CONFIG_INTEGRAL_MAX_LIMIT))[loop] =
+                    field_count > 3 ? fields[3] : integral_defaults.getMaxLimit();
+                static_cast<float *>(writer->getSection(CONFIG_INTEGRAL_MAX_TIME_STEP))[loop] =
+                    field_count > 4 ? fields[4] : integral_defaults.getMaxTimeStep();
+                break;
+            case SNAPSHOT_DERIVATIVE:
+                static_cast<float *>(writer->getSection(CONFIG_DERIVATIVE_GAIN))[loop] = fields[0];
+                static_cast<float *>(writer->getSection(CONFIG_DERIVATIVE_MIN_TIME_STEP))[loop] =
+                    field_count > 1 ? fields[1] : derivative_defaults.getMinTimeStep();
+                static_cast<float *>(writer->getSection(CONFIG_DERIVATIVE_MAX_TIME_STEP))[loop] =
+                    field_count > 2 ? fields[2] : derivative_defaults.getMaxTimeStep();
+                break;
+        }
+        ++loop;
+    }
+    return true;
+}
+
+}  // namespace
+
+size_t ConfigText::convert(const char *text, size_t length, void *image, size_t size, uint32_t &error_line) {
+    Bank banks[CONFIG_TEXT_MAX_BANKS];
+    uint16_t bank_count = 0;
+    if(!parse(text, length, banks, bank_count, nullptr, error_line)) {
+        return 0;
+    }
+
+    size_t required = sizeof(ConfigHeader);
+    for(uint16_t bank = 0; bank < bank_count; ++bank) {
+        required += Config::blockSize(banks[bank].kind, banks[bank].count);
+    }
+    if(image == nullptr) {
+        return required;
+    }
+
+    ConfigWriter writer;
+    if(required > size || !writer.begin(image, size) || !parse(text, length, banks, bank_count, &writer, error_line)) {
+        return 0;
+    }
+    return writer.finish();
+}
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
@@ -0,0 +1,78 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Text form of the binary controller configuration, for writing and reviewing configurations by hand. Each
+ * "bank <kind>" line, with kind proportional, integral or derivative, starts a block; every following line is
+ * one loop of that kind, with the settings in section order and trailing ones left at their defaults:
+ *
+ *     # gain has_limits min_limit max_limit max_time_step
+ *     bank integral
+ *     0.5 1 -10 10
+ *     0.8
+ *     # gain
+ *     bank proportional
+ *     2.0
+ *
+ * Blank lines and everything after '#' are ignored.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PERSIST_CONFIG_TEXT_H
+#define CONTROLALGORITHMS_PERSIST_CONFIG_TEXT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Persist {
+
+// Most banks one text file may declare
+const uint16_t CONFIG_TEXT_MAX_BANKS = 64;
+
+// Longest line accepted, in characters
+const size_t CONFIG_TEXT_MAX_LINE = 255;
+
+class ConfigText {
+    public:
+        /**
+         * Convert text to a binary image
+         * @param text [in]: const char* the text, not necessarily terminated
+         * @param length [in]: size_t characters of text
+         * @param image [out]: void* destination, 16 byte aligned, or nullptr to only compute the size
+         * @param size [in]: size_t bytes available
+         * @param error_line [out]: uint32_t line of the first error, 0 if the text is valid
+         * @return size_t bytes written, or required if image is nullptr; 0 on an error or if the image does not fit
+         */
+        static size_t convert(const char *text, size_t length, void *image, size_t size, uint32_t &error_line);
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        ConfigText() {};
+};
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PERSIST_CONFIG_TEXT_H
@@ -0,0 +1,93 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * POSIX implementation of the mapped file
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "mappedFile.h"
+
+#if defined(__unix__) && !defined(ARDUINO)
+#define CONTROLALGORITHMS_HAS_POSIX_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ControlAlgorithms {
+
+namespace Persist {
+
+#if defined(CONTROLALGORITHMS_HAS_POSIX_MMAP)
+
+bool MappedFile::open(const char *path) {
+    close();
+    int fd = ::open(path, O_RDONLY);
+    if(fd < 0) {
+        return false;
+    }
+    void *data = MAP_FAILED;
+    struct stat info;
+    if(fstat(fd, &info) == 0 && info.st_size > 0) {
+        int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+        flags |= MAP_POPULATE;
+#endif
+        data = mmap(nullptr, (size_t)info.st_size, PROT_READ, flags, fd, 0);
+    }
+    // The mapping keeps the file open
+    ::close(fd);
+    if(data == MAP_FAILED) {
+        return false;
+    }
+    data_ = data;
+    size_ = (size_t)info.st_size;
+    return true;
+}
+
+void MappedFile::close() {
+    if(data_ != nullptr) {
+        munmap(data_, size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#else
+
+bool MappedFile::open(const char *) {
+    return false;
+}
+
+void MappedFile::close() {
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
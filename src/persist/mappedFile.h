@@ -0,0 +1,74 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A file mapped read only (open/mmap). On targets without POSIX mappings, e.g. Arduino, open fails and the
+ * file stays closed; images there are linked in or read into a buffer instead.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PERSIST_MAPPED_FILE_H
+#define CONTROLALGORITHMS_PERSIST_MAPPED_FILE_H
+
+#include <stddef.h>
+
+namespace ControlAlgorithms {
+namespace Persist {
+
+class MappedFile {
+    public:
+        MappedFile() {};
+        virtual ~MappedFile() { close(); };
+
+        /**
+         * Map a whole file read only. The pages are faulted in up front where the platform allows, so reading
+         * the mapping afterwards does not stall on the disk.
+         * @param path [in]: const char* file path
+         * @return bool false if the file does not exist, is empty or could not be mapped
+         */
+        bool open(const char *path);
+
+        /**
+         * Unmap the file
+         */
+        void close();
+
+        const void *getData() const { return data_; }
+        size_t getSize() const { return size_; }
+        bool isOpen() const { return data_ != nullptr; }
+
+    private:
+        // Not copyable, the mapping is owned
+        MappedFile(const MappedFile &);
+        MappedFile &operator=(const MappedFile &);
+
+        // The mapping
+        void *data_{nullptr};
+        size_t size_{0};
+};
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PERSIST_MAPPED_FILE_H
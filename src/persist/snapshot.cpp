@@ -0,0 +1,302 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Checkpoint and restore of controller settings and state
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "snapshot.h"
+
+namespace ControlAlgorithms {
+
+namespace Persist {
+
+namespace {
+
+// Every section starts on this boundary
+const size_t SECTION_ALIGNMENT = 16;
+
+size_t alignUp(size_t value) {
+    return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+size_t elementSize(uint16_t kind, uint32_t section) {
+    return (kind == SNAPSHOT_INTEGRAL && section == INTEGRAL_HAS_LIMITS) ? sizeof(uint8_t) : sizeof(float);
+}
+
+}  // namespace
+
+bool SnapshotView::open(const void *image, size_t size, bool verify_checksum) {
+    header_ = nullptr;
+    if(image == nullptr || size < sizeof(SnapshotHeader)) {
+        return false;
+    }
+    const SnapshotHeader *header = static_cast<const SnapshotHeader *>(image);
+    // An unknown kind has no sections and a zero image size, which the size checks alone would let through
+    if(header->magic != SNAPSHOT_MAGIC || header->byte_order != SNAPSHOT_BYTE_ORDER ||
+       header->version != SNAPSHOT_VERSION || Snapshot::sectionCount(header->kind) == 0 ||
+       header->image_size < sizeof(SnapshotHeader) || header->section_count != Snapshot::sectionCount(header->kind) ||
+       header->image_size != Snapshot::imageSize(header->kind, header->count) || header->image_size > size) {
+        return false;
+    }
+    if(verify_checksum &&
+       header->checksum != Snapshot::checksum(header + 1, header->image_size - sizeof(SnapshotHeader))) {
+        return false;
+    }
+    header_ = header;
+    return true;
+}
+
+const void *SnapshotView::getSection(uint32_t section) const {
+    return reinterpret_cast<const uint8_t *>(header_) + Snapshot::sectionOffset(header_->kind, header_->count, section);
+}
+
+uint32_t Snapshot::sectionCount(uint16_t kind) {
+    switch(kind) {
+        case SNAPSHOT_PROPORTIONAL:
+            return 2;
+        case SNAPSHOT_INTEGRAL:
+            return 7;
+        case SNAPSHOT_DERIVATIVE:
+            return 5;
+        default:
+            return 0;
+    }
+}
+
+size_t Snapshot::sectionOffset(uint16_t kind, uint32_t count, uint32_t section) {
+    size_t offset = alignUp(sizeof(SnapshotHeader));
+    for(uint32_t index = 0; index < section; ++index) {
+        offset += alignUp(elementSize(kind, index) * count);
+    }
+    return offset;
+}
+
+size_t Snapshot::imageSize(uint16_t kind, uint32_t count) {
+    uint32_t sections = sectionCount(kind);
+    // Bounding the count keeps the sum of the sections within 32 bits, which a 32 bit size_t would otherwise wrap
+    if(sections == 0 || count > UINT32_MAX / ((sections + 1) * sizeof(float))) {
+        return 0;
+    }
+    return sectionOffset(kind, count, sections);
+}
+
+uint32_t Snapshot::checksum(const void *data, size_t size) {
+    // Fletcher style sums over 32 bit words
+    const uint32_t *words = static_cast<const uint32_t *>(data);
+    uint32_t sum_a = 1;
+    uint32_t sum_b = 0;
+    for(size_t i = 0; i < size / sizeof(uint32_t); ++i) {
+        sum_a += words[i];
+        sum_b += sum_a;
+    }
+    return sum_a ^ (sum_b << 1);
+}
+
+bool Snapshot::begin(uint16_t kind, uint32_t count, void *image, size_t size) {
+    size_t required = imageSize(kind, count);
+    if(image == nullptr || required == 0 || required > size || required > UINT32_MAX) {
+        return false;
+    }
+    SnapshotHeader *header = static_cast<SnapshotHeader *>(image);
+    memset(header, 0, alignUp(sizeof(SnapshotHeader)));
+    header->magic = SNAPSHOT_MAGIC;
+    header->version = SNAPSHOT_VERSION;
+    header->kind = kind;
+    header->byte_order = SNAPSHOT_BYTE_ORDER;
+    header->count = count;
+    header->section_count = sectionCount(kind);
+    header->image_size = (uint32_t)required;
+    return true;
+}
+
+size_t Snapshot::finish(void *image) {
+    SnapshotHeader *header = static_cast<SnapshotHeader *>(image);
+    header->checksum = checksum(header + 1, header->image_size - sizeof(SnapshotHeader));
+    return header->image_size;
+}
+
+void Snapshot::clear(void *image) {
+    SnapshotHeader *header = static_cast<SnapshotHeader *>(image);
+    size_t payload = alignUp(sizeof(SnapshotHeader));
+    memset(static_cast<uint8_t *>(image) + payload, 0, header->image_size - payload);
+}
+
+void *Snapshot::section(void *image, uint16_t kind, uint32_t count, uint32_t index) {
+    return static_cast<uint8_t *>(image) + sectionOffset(kind, count, index);
+}
+
+bool Snapshot::matches(const SnapshotView &view, uint16_t kind, size_t capacity) {
+    return view.isOpen() && view.getKind() == kind && view.getCount() <= capacity;
+}
+
+void Snapshot::copyOut(void *image, uint16_t kind, uint32_t count, uint32_t index, const void *source, size_t element_size) {
+    uint8_t *destination = static_cast<uint8_t *>(image) + sectionOffset(kind, count, index);
+    size_t bytes = element_size * count;
+    memcpy(destination, source, bytes);
+    // Padding is part of the checksum, so keep it deterministic
+    memset(destination + bytes, 0, alignUp(bytes) - bytes);
+}
+
+size_t Snapshot::write(const PID::Integral *controllers, uint32_t count, void *image, size_t size) {
+    if(!begin(SNAPSHOT_INTEGRAL, count, image, size)) {
+        return 0;
+    }
+    clear(image);
+    float *gain = static_cast<float *>(section(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_GAIN));
+    float *min_limit = static_cast<float *>(section(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_MIN_LIMIT));
+    float *max_limit = static_cast<float *>(section(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_MAX_LIMIT));
+    float *integrated_error = static_cast<float *>(section(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_INTEGRATED_ERROR));
+    float *control = static_cast<float *>(section(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_CONTROL));
+    uint8_t *has_limits = static_cast<uint8_t *>(section(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_HAS_LIMITS));
+    float *max_time_step = static_cast<float *>(section(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_MAX_TIME_STEP));
+
+    PID::IntegralSettings settings;
+    PID::IntegralOutput state;
+    for(uint32_t i = 0; i < count; ++i) {
+        controllers[i].getSettings(settings);
+        controllers[i].getState(state);
+        gain[i] = settings.getGain();
+        min_limit[i] = settings.getMinLimit();
+        max_limit[i] = settings.getMaxLimit();
+        has_limits[i] = settings.getHasLimits() ? 1 : 0;
+        max_time_step[i] = settings.getMaxTimeStep();
+        integrated_error[i] = state.getIntegratedError();
+        control[i] = state.getControl();
+    }
+    return finish(image);
+}
+
+size_t Snapshot::write(const PID::Derivative *controllers, uint32_t count, void *image, size_t size) {
+    if(!begin(SNAPSHOT_DERIVATIVE, count, image, size)) {
+        return 0;
+    }
+    clear(image);
+    float *gain = static_cast<float *>(section(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_GAIN));
+    float *min_time_step = static_cast<float *>(section(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_MIN_TIME_STEP));
+    float *previous_error = static_cast<float *>(section(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_PREVIOUS_ERROR));
+    float *control = static_cast<float *>(section(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_CONTROL));
+    float *max_time_step = static_cast<float *>(section(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_MAX_TIME_STEP));
+
+    PID::DerivativeSettings settings;
+    PID::DerivativeOutput state;
+    for(uint32_t i = 0; i < count; ++i) {
+        controllers[i].getSettings(settings);
+        controllers[i].getState(state);
+        gain[i] = settings.getGain();
+        min_time_step[i] = settings.getMinTimeStep();
+        max_time_step[i] = settings.getMaxTimeStep();
+        previous_error[i] = state.getPreviousError();
+        control[i] = state.getControl();
+    }
+    return finish(image);
+}
+
+size_t Snapshot::write(const PID::Proportional *controllers, uint32_t count, void *image, size_t size) {
+    if(!begin(SNAPSHOT_PROPORTIONAL, count, image, size)) {
+        return 0;
+    }
+    clear(image);
+    float *gain = static_cast<float *>(section(image, SNAPSHOT_PROPORTIONAL, count, PROPORTIONAL_GAIN));
+    float *control = static_cast<float *>(section(image, SNAPSHOT_PROPORTIONAL, count, PROPORTIONAL_CONTROL));
+
+    Base::ControlSettings settings;
+    for(uint32_t i = 0; i < count; ++i) {
+        controllers[i].getSettings(settings);
+        gain[i] = settings.getGain();
+        // Proportional control keeps no output between calls
+        control[i] = 0.0;
+    }
+    return finish(image);
+}
+
+bool Snapshot::restore(const SnapshotView &view, PID::Integral *controllers, uint32_t count) {
+    if(!matches(view, SNAPSHOT_INTEGRAL, count)) {
+        return false;
+    }
+    const float *gain = view.getFloatSection(INTEGRAL_GAIN);
+    const float *min_limit = view.getFloatSection(INTEGRAL_MIN_LIMIT);
+    const float *max_limit = view.getFloatSection(INTEGRAL_MAX_LIMIT);
+    const float *integrated_error = view.getFloatSection(INTEGRAL_INTEGRATED_ERROR);
+    const float *control = view.getFloatSection(INTEGRAL_CONTROL);
+    const uint8_t *has_limits = static_cast<const uint8_t *>(view.getSection(INTEGRAL_HAS_LIMITS));
+    const float *max_time_step = view.getFloatSection(INTEGRAL_MAX_TIME_STEP);
+
+    PID::IntegralSettings settings;
+    PID::IntegralOutput state;
+    for(uint32_t i = 0; i < view.getCount(); ++i) {
+        settings.setGain(gain[i]);
+        settings.setHasLimits(has_limits[i] != 0);
+        settings.setMinLimit(min_limit[i]);
+        settings.setMaxLimit(max_limit[i]);
+        settings.setMaxTimeStep(max_time_step[i]);
+        state.setIntegratedError(integrated_error[i]);
+        state.setControl(control[i]);
+        controllers[i].setSettings(settings);
+        controllers[i].setState(state);
+    }
+    return true;
+}
+
+bool Snapshot::restore(const SnapshotView &view, PID::Derivative *controllers, uint32_t count) {
+    if(!matches(view, SNAPSHOT_DERIVATIVE, count)) {
+        return false;
+    }
+    const float *gain = view.getFloatSection(DERIVATIVE_GAIN);
+    const float *min_time_step = view.getFloatSection(DERIVATIVE_MIN_TIME_STEP);
+    const float *previous_error = view.getFloatSection(DERIVATIVE_PREVIOUS_ERROR);
+    const float *control = view.getFloatSection(DERIVATIVE_CONTROL);
+    const float *max_time_step = view.getFloatSection(DERIVATIVE_MAX_TIME_STEP);
+
+    PID::DerivativeSettings settings;
+    PID::DerivativeOutput state;
+    for(uint32_t i = 0; i < view.getCount(); ++i) {
+        settings.setGain(gain[i]);
+        settings.setMinTimeStep(min_time_step[i]);
+        settings.setMaxTimeStep(max_time_step[i]);
+        state.setPreviousError(previous_error[i]);
+        state.setControl(control[i]);
+        controllers[i].setSettings(settings);
+        controllers[i].setState(state);
+    }
+    return true;
+}
+
+bool Snapshot::restore(const SnapshotView &view, PID::Proportional *controllers, uint32_t count) {
+    if(!matches(view, SNAPSHOT_PROPORTIONAL, count)) {
+        return false;
+    }
+    const float *gain = view.getFloatSection(PROPORTIONAL_GAIN);
+
+    Base::ControlSettings settings;
+    for(uint32_t i = 0; i < view.getCount(); ++i) {
+        settings.setGain(gain[i]);
+        controllers[i].setSettings(settings);
+    }
+    return true;
+}
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
@@ -0,0 +1,297 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Checkpoint and restore of controller settings and state in a compact binary image.
+ *
+ * Image layout (native byte order, recorded in the header):
+ *     SnapshotHeader (32 bytes)
+ *     one section per array of the controller kind, each count elements long and starting on a 16 byte boundary
+ * Integral:     gain, min limit, max limit, integrated error, control (float), has limits (uint8_t), max time step (float)
+ * Derivative:   gain, min time step, previous error, control, max time step (float)
+ * Proportional: gain, control (float)
+ *
+ * Sections match the bank arrays, so banks are written and restored with one memcpy per array and a
+ * SnapshotView over a mapped file reads the values in place. Single controllers and pools of stateful
+ * controllers use the same layout.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PERSIST_SNAPSHOT_H
+#define CONTROLALGORITHMS_PERSIST_SNAPSHOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <pid/proportional.h>
+#include <pid/integral.h>
+#include <pid/derivative.h>
+#include <pid/proportionalBank.h>
+#include <pid/integralBank.h>
+#include <pid/derivativeBank.h>
+
+namespace ControlAlgorithms {
+namespace Persist {
+
+// Kinds of controller stored in an image
+const uint16_t SNAPSHOT_PROPORTIONAL = 1;
+const uint16_t SNAPSHOT_INTEGRAL = 2;
+const uint16_t SNAPSHOT_DERIVATIVE = 3;
+
+// Sections of each kind, in image order
+const uint32_t PROPORTIONAL_GAIN = 0;
+const uint32_t PROPORTIONAL_CONTROL = 1;
+const uint32_t INTEGRAL_GAIN = 0;
+const uint32_t INTEGRAL_MIN_LIMIT = 1;
+const uint32_t INTEGRAL_MAX_LIMIT = 2;
+const uint32_t INTEGRAL_INTEGRATED_ERROR = 3;
+const uint32_t INTEGRAL_CONTROL = 4;
+const uint32_t INTEGRAL_HAS_LIMITS = 5;
+const uint32_t INTEGRAL_MAX_TIME_STEP = 6;
+const uint32_t DERIVATIVE_GAIN = 0;
+const uint32_t DERIVATIVE_MIN_TIME_STEP = 1;
+const uint32_t DERIVATIVE_PREVIOUS_ERROR = 2;
+const uint32_t DERIVATIVE_CONTROL = 3;
+const uint32_t DERIVATIVE_MAX_TIME_STEP = 4;
+
+struct SnapshotHeader {
+    // SNAPSHOT_MAGIC
+    uint32_t magic;
+    // SNAPSHOT_VERSION of the writer
+    uint16_t version;
+    // SNAPSHOT_PROPORTIONAL, SNAPSHOT_INTEGRAL or SNAPSHOT_DERIVATIVE
+    uint16_t kind;
+    // SNAPSHOT_BYTE_ORDER as written; reads back differently on a host of the other endianness
+    uint32_t byte_order;
+    // Number of loops
+    uint32_t count;
+    // Number of sections following the header
+    uint32_t section_count;
+    // Total image size in bytes, header included
+    uint32_t image_size;
+    // Snapshot::checksum of everything after the header
+    uint32_t checksum;
+    uint32_t reserved;
+};
+
+const uint32_t SNAPSHOT_MAGIC = 0x4E534143;  // "CASN" in little endian
+const uint16_t SNAPSHOT_VERSION = 2;
+const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+
+class SnapshotView {
+    public:
+        SnapshotView () {};
+        virtual ~SnapshotView() {};
+
+        /**
+         * Validate an image and point the view at it. Nothing is copied; the image must outlive the view.
+         * @param image [in]: const void* start of the image, e.g. a mapped file
+         * @param size [in]: size_t bytes available
+         * @param verify_checksum [in]: bool whether to check the payload checksum
+         * @return bool true if the image is valid
+         */
+        bool open(const void *image, size_t size, bool verify_checksum = true);
+
+        bool isOpen() const { return header_ != nullptr; }
+        uint16_t getKind() const { return header_->kind; }
+        uint32_t getCount() const { return header_->count; }
+
+        /**
+         * Pointer to a section in place
+         * @param section [in]: uint32_t section index for the image kind
+         * @return const void* the section
+         */
+        const void *getSection(uint32_t section) const;
+        const float *getFloatSection(uint32_t section) const { return static_cast<const float *>(getSection(section)); }
+
+    private:
+        // The validated header, nullptr until open succeeds
+        const SnapshotHeader *header_{nullptr};
+};
+
+class Snapshot {
+    public:
+        /**
+         * Size of the image for a kind and loop count
+         * @param kind [in]: uint16_t controller kind
+         * @param count [in]: uint32_t number of loops
+         * @return size_t bytes required, 0 for an unknown kind or a count whose image would not fit in 32 bits
+         */
+        static size_t imageSize(uint16_t kind, uint32_t count);
+
+        /**
+         * Number of sections for a kind
+         * @return uint32_t sections, 0 for an unknown kind
+         */
+        static uint32_t sectionCount(uint16_t kind);
+
+        /**
+         * Offset of a section from the start of the image
+         * @return size_t offset in bytes
+         */
+        static size_t sectionOffset(uint16_t kind, uint32_t count, uint32_t section);
+
+        /**
+         * Checksum over a byte range. Word based so it keeps up with memcpy on large images.
+         * @param data [in]: const void* start, 4 byte aligned
+         * @param size [in]: size_t bytes, a multiple of 4
+         * @return uint32_t checksum
+         */
+        static uint32_t checksum(const void *data, size_t size);
+
+        /**
+         * Write the first count loops of a bank
+         * @param bank [in]: bank to checkpoint
+         * @param count [in]: uint32_t number of loops, at most the bank capacity
+         * @param image [out]: void* destination, 4 byte aligned
+         * @param size [in]: size_t bytes available
+         * @return size_t bytes written, 0 if the image does not fit
+         */
+        template<size_t Capacity>
+        static size_t write(const PID::IntegralBank<Capacity> &bank, uint32_t count, void *image, size_t size) {
+            if(count > Capacity || !begin(SNAPSHOT_INTEGRAL, count, image, size)) {
+                return 0;
+            }
+            copyOut(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_GAIN, bank.getGainArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_MIN_LIMIT, bank.getMinLimitArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_MAX_LIMIT, bank.getMaxLimitArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_INTEGRATED_ERROR, bank.getIntegratedErrorArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_CONTROL, bank.getControlArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_HAS_LIMITS, bank.getHasLimitsArray(), sizeof(uint8_t));
+            copyOut(image, SNAPSHOT_INTEGRAL, count, INTEGRAL_MAX_TIME_STEP, bank.getMaxTimeStepArray(), sizeof(float));
+            return finish(image);
+        }
+        template<size_t Capacity>
+        static size_t write(const PID::DerivativeBank<Capacity> &bank, uint32_t count, void *image, size_t size) {
+            if(count > Capacity || !begin(SNAPSHOT_DERIVATIVE, count, image, size)) {
+                return 0;
+            }
+            copyOut(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_GAIN, bank.getGainArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_MIN_TIME_STEP, bank.getMinTimeStepArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_PREVIOUS_ERROR, bank.getPreviousErrorArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_CONTROL, bank.getControlArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_DERIVATIVE, count, DERIVATIVE_MAX_TIME_STEP, bank.getMaxTimeStepArray(), sizeof(float));
+            return finish(image);
+        }
+        template<size_t Capacity>
+        static size_t write(const PID::ProportionalBank<Capacity> &bank, uint32_t count, void *image, size_t size) {
+            if(count > Capacity || !begin(SNAPSHOT_PROPORTIONAL, count, image, size)) {
+                return 0;
+            }
+            copyOut(image, SNAPSHOT_PROPORTIONAL, count, PROPORTIONAL_GAIN, bank.getGainArray(), sizeof(float));
+            copyOut(image, SNAPSHOT_PROPORTIONAL, count, PROPORTIONAL_CONTROL, bank.getControlArray(), sizeof(float));
+            return finish(image);
+        }
+
+        /**
+         * Write stateful controllers, e.g. a single controller or the live range of a Bank::ControllerPool
+         * @param controllers [in]: controllers[count]
+         * @param count [in]: uint32_t number of controllers
+         * @param image [out]: void* destination, 4 byte aligned
+         * @param size [in]: size_t bytes available
+         * @return size_t bytes written, 0 if the image does not fit
+         */
+        static size_t write(const PID::Integral *controllers, uint32_t count, void *image, size_t size);
+        static size_t write(const PID::Derivative *controllers, uint32_t count, void *image, size_t size);
+        static size_t write(const PID::Proportional *controllers, uint32_t count, void *image, size_t size);
+
+        /**
+         * Restore a bank. Loops beyond the image count are left untouched.
+         * @param view [in]: SnapshotView an open view of the image
+         * @param bank [out]: bank to restore
+         * @return bool false if the kind does not match or the image holds more loops than the bank
+         */
+        template<size_t Capacity>
+        static bool restore(const SnapshotView &view, PID::IntegralBank<Capacity> &bank) {
+            if(!matches(view, SNAPSHOT_INTEGRAL, Capacity)) {
+                return false;
+            }
+            copyIn(view, INTEGRAL_GAIN, bank.getGainArray(), sizeof(float));
+            copyIn(view, INTEGRAL_MIN_LIMIT, bank.getMinLimitArray(), sizeof(float));
+            copyIn(view, INTEGRAL_MAX_LIMIT, bank.getMaxLimitArray(), sizeof(float));
+            copyIn(view, INTEGRAL_INTEGRATED_ERROR, bank.getIntegratedErrorArray(), sizeof(float));
+            copyIn(view, INTEGRAL_CONTROL, bank.getControlArray(), sizeof(float));
+            copyIn(view, INTEGRAL_HAS_LIMITS, bank.getHasLimitsArray(), sizeof(uint8_t));
+            copyIn(view, INTEGRAL_MAX_TIME_STEP, bank.getMaxTimeStepArray(), sizeof(float));
+            return true;
+        }
+        template<size_t Capacity>
+        static bool restore(const SnapshotView &view, PID::DerivativeBank<Capacity> &bank) {
+            if(!matches(view, SNAPSHOT_DERIVATIVE, Capacity)) {
+                return false;
+            }
+            copyIn(view, DERIVATIVE_GAIN, bank.getGainArray(), sizeof(float));
+            copyIn(view, DERIVATIVE_MIN_TIME_STEP, bank.getMinTimeStepArray(), sizeof(float));
+            copyIn(view, DERIVATIVE_PREVIOUS_ERROR, bank.getPreviousErrorArray(), sizeof(float));
+            copyIn(view, DERIVATIVE_CONTROL, bank.getControlArray(), sizeof(float));
+            copyIn(view, DERIVATIVE_MAX_TIME_STEP, bank.getMaxTimeStepArray(), sizeof(float));
+            return true;
+        }
+        template<size_t Capacity>
+        static bool restore(const SnapshotView &view, PID::ProportionalBank<Capacity> &bank) {
+            if(!matches(view, SNAPSHOT_PROPORTIONAL, Capacity)) {
+                return false;
+            }
+            copyIn(view, PROPORTIONAL_GAIN, bank.getGainArray(), sizeof(float));
+            copyIn(view, PROPORTIONAL_CONTROL, bank.getControlArray(), sizeof(float));
+            return true;
+        }
+
+        /**
+         * Restore stateful controllers
+         * @param view [in]: SnapshotView an open view of the image
+         * @param controllers [out]: controllers[count]
+         * @param count [in]: uint32_t number of controllers available
+         * @return bool false if the kind does not match or the image holds more loops than count
+         */
+        static bool restore(const SnapshotView &view, PID::Integral *controllers, uint32_t count);
+        static bool restore(const SnapshotView &view, PID::Derivative *controllers, uint32_t count);
+        static bool restore(const SnapshotView &view, PID::Proportional *controllers, uint32_t count);
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Snapshot() {};
+
+        // Fill in the header and check the image fits
+        static bool begin(uint16_t kind, uint32_t count, void *image, size_t size);
+        // Compute the checksum and return the image size
+        static size_t finish(void *image);
+        // Check a view against the kind and capacity being restored
+        static bool matches(const SnapshotView &view, uint16_t kind, size_t capacity);
+
+        // Zero the payload, for writers that fill sections element by element
+        static void clear(void *image);
+        // Start of a section
+        static void *section(void *image, uint16_t kind, uint32_t count, uint32_t index);
+        // Copy an array into a section and zero the padding after it
+        static void copyOut(void *image, uint16_t kind, uint32_t count, uint32_t index, const void *source, size_t element_size);
+        static void copyIn(const SnapshotView &view, uint32_t index, void *destination, size_t element_size) {
+            memcpy(destination, view.getSection(index), element_size * view.getCount());
+        }
+};
+
+}  // namespace Persist
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PERSIST_SNAPSHOT_H
@@ -30,6 +30,7 @@
 #ifndef CONTROLALGORITHMS_DERIVATIVE_H
 #define CONTROLALGORITHMS_DERIVATIVE_H
 
+#include <base/controlFaults.h>
 #include <pid/derivativeInput.h>
 #include <pid/derivativeSettings.h>
 #include <pid/derivativeOutput.h>
@@ -51,21 +52,50 @@ class Derivative {
             settings_.copy(settings);
         }
 
+        /**
+         * Get the controller settings
+         * @param settings [out]: DerivativeSettings controller settings
+         */
+        virtual void getSettings(DerivativeSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: DerivativeOutput the internal state
+         */
+        virtual void getState(DerivativeOutput &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: DerivativeOutput the internal state
+         */
+        virtual void setState(const DerivativeOutput &state) {
+            state_.copy(state);
+        }
+
         /**
          * The calculate function for the derivative controller
          * @param input [in]: Base::ControlInput values used to calculate the control signal
          * @param out [out]: Base::ControlOutput the output signal and any additional/changed data used for continued computations
          */
-        virtual void update(const Base::ControlInput input, Base::ControlOutput &out) {
-            // Set the input using the state
-            static_cast<Base::ControlInput>(input_with_state_).copy(input);
+        virtual void update(const Base::ControlInput &input, Base::ControlOutput &out) {
+            // Fill the input with state in place; the new sample and state are written directly to the members
+            input_with_state_.setError(input.getError());
+            input_with_state_.setDeltaT(input.getDeltaT());
             input_with_state_.setPreviousError(state_.getPreviousError());
 
             // Run the update
-            DerivativeStateless::update(input_with_state_, settings_, state_);
+            if(hardened_) {
+                DerivativeStateless::updateHardened(input_with_state_, settings_, state_);
+            } else {
+                DerivativeStateless::update(input_with_state_, settings_, state_);
+            }
 
             // Copy to output
-            out.copy(static_cast<Base::ControlOutput>(state_));
+            out.copy(state_);
         }
 
         /**
@@ -77,6 +107,18 @@ class Derivative {
 
         virtual bool isStateful() { return true; }
 
+        /**
+         * Select the hardened update, which ignores non-finite errors and out of range time steps and reports them
+         * through the state's fault flags
+         * @param hardened [in]: bool whether to use the hardened update
+         */
+        virtual void setHardened(bool hardened) {
+            hardened_ = hardened;
+            // Only the hardened update reports faults, so none may be left over from it
+            state_.setFaults(Base::FAULT_NONE);
+        }
+        virtual bool getHardened() const { return hardened_; }
+
     private:
         // The stored settings
         DerivativeSettings settings_;
@@ -86,6 +128,9 @@ class Derivative {
 
         // Used for the internal call with state
         DerivativeInput input_with_state_;
+
+        // Whether the hardened update is used
+        bool hardened_{false};
 };
 
 }  // namespace PID
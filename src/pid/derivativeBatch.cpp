@@ -0,0 +1,96 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of derivative control
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "derivativeBatch.h"
+#include <base/branchless.h>
+#include <base/controlFaults.h>
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// The arrays of one call must not overlap. __restrict lets the loops vectorize without runtime alias checks.
+void DerivativeBatch::update(const float *__restrict error, const float *__restrict delta_t,
+                             const float *__restrict gain, const float *__restrict min_time_step,
+                             float *__restrict previous_error, float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        // Calculate the control signal
+        control[i] = Kernels::derivative(error[i], previous_error[i], delta_t[i], min_time_step[i], gain[i]);
+
+        // Save the previous error
+        previous_error[i] = error[i];
+    }
+}
+
+void DerivativeBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict error,
+                                    const float *__restrict delta_t, const float *__restrict gain,
+                                    const float *__restrict min_time_step, float *__restrict previous_error,
+                                    float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        update(&error[i], &delta_t[i], &gain[loop], &min_time_step[loop], &previous_error[loop], &control[loop], 1);
+    }
+}
+
+void DerivativeBatch::updateHardened(const float *__restrict error, const float *__restrict delta_t,
+                                     const float *__restrict gain, const float *__restrict min_time_step,
+                                     const float *__restrict max_time_step, float *__restrict previous_error,
+                                     float *__restrict control, uint8_t *__restrict faults, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t error_valid = Base::Branchless::finiteMask(error[i]);
+        uint32_t delta_t_valid = Base::Branchless::rangeMask(delta_t[i], 0.0f, max_time_step[i]);
+        uint32_t valid = error_valid & delta_t_valid;
+
+        // An invalid sample keeps the previous error and outputs zero; its step is never used, since the minimum
+        // time step may be 0
+        float current = Base::Branchless::select(valid, error[i], previous_error[i]);
+        float derivative = Kernels::derivative(current, previous_error[i], delta_t[i], min_time_step[i], gain[i]);
+        control[i] = Base::Branchless::select(valid, derivative, 0.0f);
+
+        previous_error[i] = current;
+        faults[i] = Base::Branchless::flagIfClear(error_valid, Base::FAULT_ERROR_NOT_FINITE) |
+                    Base::Branchless::flagIfClear(delta_t_valid, Base::FAULT_DELTA_T_OUT_OF_RANGE);
+    }
+}
+
+void DerivativeBatch::updateIndexedHardened(const uint32_t *__restrict loops, const float *__restrict error,
+                                            const float *__restrict delta_t, const float *__restrict gain,
+                                            const float *__restrict min_time_step,
+                                            const float *__restrict max_time_step, float *__restrict previous_error,
+                                            float *__restrict control, uint8_t *__restrict faults, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        updateHardened(&error[i], &delta_t[i], &gain[loop], &min_time_step[loop], &max_time_step[loop],
+                       &previous_error[loop], &control[loop], &faults[loop], 1);
+    }
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
@@ -30,6 +30,7 @@
 #ifndef CONTROLALGORITHMS_PID_DERIVATIVE_OUTPUT_H
 #define CONTROLALGORITHMS_PID_DERIVATIVE_OUTPUT_H
 
+#include <stdint.h>
 #include <base/controlOutput.h>
 
 namespace ControlAlgorithms {
@@ -49,14 +50,20 @@ class DerivativeOutput: public Base::ControlOutput {
             Base::ControlOutput::copy(right);
 
             setPreviousError(right.getPreviousError());
+            setFaults(right.getFaults());
         }
 
         void setPreviousError(float previous_error) { previous_error_ = previous_error; }
         float getPreviousError() const { return previous_error_; }
+        void setFaults(uint8_t faults) { faults_ = faults; }
+        uint8_t getFaults() const { return faults_; }
 
     private:
         // The previous error
         float previous_error_{0.0};
+
+        // Base fault flags from the last hardened update
+        uint8_t faults_{0};
 };
 
 }  // namespace PID
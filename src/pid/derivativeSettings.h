@@ -30,6 +30,7 @@
 #ifndef CONTROLALGORITHMS_PID_DERIVATIVE_SETTINGS_H
 #define CONTROLALGORITHMS_PID_DERIVATIVE_SETTINGS_H
 
+#include <float.h>
 #include <base/controlSettings.h>
 
 namespace ControlAlgorithms {
@@ -49,14 +50,20 @@ class DerivativeSettings : public Base::ControlSettings {
             Base::ControlSettings::copy(right);
             
             setMinTimeStep(right.getMinTimeStep());
+            setMaxTimeStep(right.getMaxTimeStep());
         }
         
-        void setMinTimeStep(bool min_time_step) { min_time_step_ = min_time_step; }
+        void setMinTimeStep(float min_time_step) { min_time_step_ = min_time_step; }
         float getMinTimeStep() const { return min_time_step_; }
+        void setMaxTimeStep(float max_time_step) { max_time_step_ = max_time_step; }
+        float getMaxTimeStep() const { return max_time_step_; }
 
     private:
         // The minimum time step allowed
         float min_time_step_{0.0000001};
+
+        // The largest time step accepted by the hardened update
+        float max_time_step_{FLT_MAX};
 };
 
 }  // namespace PID
@@ -28,21 +28,45 @@
  */
 
 #include "derivativeStateless.h"
-#include <algorithm>
+#include <base/branchless.h>
+#include <base/controlFaults.h>
+#include <pid/pidKernels.h>
 
 namespace ControlAlgorithms {
 
 namespace PID {
 
-void DerivativeStateless::update(const DerivativeInput input, const DerivativeSettings settings, DerivativeOutput &out) {
-    // Update the derivative calculation
-    float error_derivative = (input.getError() - input.getPreviousError()) / std::max(input.getDeltaT(), settings.getMinTimeStep());
+// Compile time checks of the kernel: a unit step in error over a 0.5 time step, and the minimum time step guard
+static_assert(Kernels::derivative(1.0f, 0.0f, 0.5f, 0.0000001f, 0.25f) == 0.5f, "derivative of a step");
+static_assert(Kernels::derivative(1.0f, 1.0f, 0.5f, 0.0000001f, 0.25f) == 0.0f, "derivative of a constant");
+static_assert(Kernels::derivative(1.0f, 0.0f, 0.0f, 0.5f, 1.0f) == 2.0f, "minimum time step guard");
 
+void DerivativeStateless::update(const DerivativeInput &input, const DerivativeSettings &settings, DerivativeOutput &out) {
     // Save the previous error
     out.setPreviousError(input.getError());
 
     // Calculate and return the control signal
-    out.setControl(error_derivative * settings.getGain());
+    out.setControl(Kernels::derivative(input.getError(), input.getPreviousError(), input.getDeltaT(),
+                                       settings.getMinTimeStep(), settings.getGain()));
+}
+
+void DerivativeStateless::updateHardened(const DerivativeInput &input, const DerivativeSettings &settings, DerivativeOutput &out) {
+    uint32_t error_valid = Base::Branchless::finiteMask(input.getError());
+    uint32_t delta_t_valid = Base::Branchless::rangeMask(input.getDeltaT(), 0.0f, settings.getMaxTimeStep());
+    uint32_t valid = error_valid & delta_t_valid;
+
+    // An invalid sample keeps the previous error and outputs zero; its step is never used, since the minimum time step may be 0
+    float error = Base::Branchless::select(valid, input.getError(), input.getPreviousError());
+
+    // Save the previous error
+    out.setPreviousError(error);
+    out.setFaults(Base::Branchless::flagIfClear(error_valid, Base::FAULT_ERROR_NOT_FINITE) |
+                  Base::Branchless::flagIfClear(delta_t_valid, Base::FAULT_DELTA_T_OUT_OF_RANGE));
+
+    // Calculate and return the control signal
+    float control = Kernels::derivative(error, input.getPreviousError(), input.getDeltaT(), settings.getMinTimeStep(),
+                                        settings.getGain());
+    out.setControl(Base::Branchless::select(valid, control, 0.0f));
 }
 
 }  // namespace PID
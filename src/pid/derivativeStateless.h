@@ -21,7 +21,8 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  * 
- * Stateless version of derivative control algorithm
+ * Stateless version of derivative control algorithm. Wraps Kernels::derivative from pidKernels.h, which can be
+ * called directly where the update should inline.
  *
  * @author Joel Dunham <joel.ph.dunham@gmail.com>
  * @date 2022/03/08
@@ -45,7 +46,17 @@ class DerivativeStateless {
          * @param settings [in]: DerivativeSettings the controller settings
          * @param out [out]: DerivativeOutput the output signal and any additional/changed data used for continued computations
          */
-        static void update(const DerivativeInput input, const DerivativeSettings settings, DerivativeOutput &out);
+        static void update(const DerivativeInput &input, const DerivativeSettings &settings, DerivativeOutput &out);
+
+        /**
+         * As update, but a non-finite error or a time step outside (0, max time step] is ignored: the previous
+         * error is held, the control signal is zero and the reason is reported through the output fault flags.
+         * Uses masks rather than branches.
+         * @param input [in]: DerivativeInput values used to calculate the control signal
+         * @param settings [in]: DerivativeSettings the controller settings
+         * @param out [out]: DerivativeOutput the output signal, fault flags and any additional/changed data used for continued computations
+         */
+        static void updateHardened(const DerivativeInput &input, const DerivativeSettings &settings, DerivativeOutput &out);
     private:
         // Private constructor to ensure only the static/stateless functions are used.
         DerivativeStateless() {};
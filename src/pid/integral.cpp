@@ -0,0 +1,48 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Anti-windup feedback of the integral controller and its compiled policies.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "integral.h"
+#include <pid/outputConditionerStateless.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+template<typename Policy>
+void IntegralT<Policy>::antiWindup(const OutputConditionerOutput &conditioned, const OutputConditionerSettings &settings) {
+    OutputConditionerStateless::antiWindup(conditioned, settings, input_with_state_, settings_, state_);
+}
+
+// antiWindup is only defined here, so every numeric policy is compiled here
+template class IntegralT<Base::FloatPolicy>;
+template class IntegralT<Base::DoublePolicy>;
+template class IntegralT<Base::KahanPolicy>;
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
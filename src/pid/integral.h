@@ -21,7 +21,8 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  * 
- * A simple integral controller using only float calculations (no doubles).
+ * A simple integral controller using only float calculations (no doubles) by default. IntegralT selects a Base numeric
+ * policy for the integrated error, e.g. IntegralT<Base::KahanPolicy> for loops that integrate for days.
  * 
  * @author Joel Dunham <joel.ph.dunham@gmail.com>
  * @date 2022/03/08
@@ -38,10 +39,15 @@
 namespace ControlAlgorithms {
 namespace PID {
 
-class Integral {
+// The conditioner feeds back through antiWindup, which is compiled in integral.cpp so this header does not depend on it
+class OutputConditionerOutput;
+class OutputConditionerSettings;
+
+template<typename Policy>
+class IntegralT {
     public:
-        Integral() {};
-        virtual ~Integral() {};
+        IntegralT() {};
+        virtual ~IntegralT() {};
         
         /**
          * Set the controller settings
@@ -51,23 +57,60 @@ class Integral {
             settings_.copy(settings);
         }
 
+        /**
+         * Get the controller settings
+         * @param settings [out]: IntegralSettings controller settings
+         */
+        virtual void getSettings(IntegralSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: IntegralOutputT the internal state
+         */
+        virtual void getState(IntegralOutputT<Policy> &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: IntegralOutputT the internal state
+         */
+        virtual void setState(const IntegralOutputT<Policy> &state) {
+            state_.copy(state);
+        }
+
         /**
          * The calculate function for the integral controller
          * @param input [in]: Base::ControlInput values used to calculate the control signal
          * @param out [out]: Base::ControlOutput the output signal and any additional/changed data used for continued computations
          */
-        virtual void update(const Base::ControlInput input, Base::ControlOutput &out) {
-            // Set the input using the state
-            static_cast<Base::ControlInput>(input_with_state_).copy(input);
-            input_with_state_.setIntegratedError(state_.getIntegratedError());
+        virtual void update(const Base::ControlInput &input, Base::ControlOutput &out) {
+            // Fill the input with state in place; the new sample and state are written directly to the members
+            input_with_state_.setError(input.getError());
+            input_with_state_.setDeltaT(input.getDeltaT());
+            input_with_state_.setAccumulator(state_.getAccumulator());
 
             // Run the update
-            IntegralStateless::update(input_with_state_, settings_, state_);
+            if(hardened_) {
+                IntegralStatelessT<Policy>::updateHardened(input_with_state_, settings_, state_);
+            } else {
+                IntegralStatelessT<Policy>::update(input_with_state_, settings_, state_);
+            }
 
             // Copy to output
-            out.copy(static_cast<Base::ControlOutput>(state_));
+            out.copy(state_);
         }
 
+        /**
+         * Correct the last update for limiting of the summed output it fed, see OutputConditionerStateless. A sample
+         * the hardened update rejected was not integrated and is not corrected either.
+         * @param conditioned [in]: OutputConditionerOutput the conditioner output of the same step
+         * @param settings [in]: OutputConditionerSettings the conditioner settings
+         */
+        virtual void antiWindup(const OutputConditionerOutput &conditioned, const OutputConditionerSettings &settings);
+
         /**
          * Reset the internal state
          */
@@ -77,17 +120,38 @@ class Integral {
 
         virtual bool isStateful() { return true; }
 
+        /**
+         * Select the hardened update, which ignores non-finite errors and out of range time steps and reports them
+         * through the state's fault flags
+         * @param hardened [in]: bool whether to use the hardened update
+         */
+        virtual void setHardened(bool hardened) {
+            hardened_ = hardened;
+            // Only the hardened update reports faults, so none may be left over for antiWindup to act on
+            state_.setFaults(Base::FAULT_NONE);
+        }
+        virtual bool getHardened() const { return hardened_; }
+
     private:
         // The stored settings
         IntegralSettings settings_;
 
         // Contains all required state info
-        IntegralOutput state_;
+        IntegralOutputT<Policy> state_;
 
         // Used for the internal call with state
-        IntegralInput input_with_state_;
+        IntegralInputT<Policy> input_with_state_;
+
+        // Whether the hardened update is used
+        bool hardened_{false};
 };
 
+// The float version used throughout the library
+typedef IntegralT<Base::FloatPolicy> Integral;
+extern template class IntegralT<Base::FloatPolicy>;
+extern template class IntegralT<Base::DoublePolicy>;
+extern template class IntegralT<Base::KahanPolicy>;
+
 }  // namespace PID
 }  // namespace ControlAlgorithms
 
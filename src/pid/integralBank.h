@@ -0,0 +1,190 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A fixed capacity bank of integral controllers stored as structure of arrays and updated with IntegralBatch.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_INTEGRAL_BANK_H
+#define CONTROLALGORITHMS_PID_INTEGRAL_BANK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pid/integralSettings.h>
+#include <pid/integralBatch.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+template<size_t Capacity>
+class IntegralBank {
+    public:
+        IntegralBank() {
+            IntegralSettings defaults;
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                setSettings(loop, defaults);
+            }
+            resetAll();
+        };
+        virtual ~IntegralBank() {};
+
+        /**
+         * Set the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [in]: IntegralSettings controller settings
+         */
+        void setSettings(size_t loop, const IntegralSettings &settings) {
+            gain_[loop] = settings.getGain();
+            has_limits_[loop] = settings.getHasLimits() ? 1 : 0;
+            min_limit_[loop] = settings.getMinLimit();
+            max_limit_[loop] = settings.getMaxLimit();
+            max_time_step_[loop] = settings.getMaxTimeStep();
+        }
+
+        /**
+         * Get the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [out]: IntegralSettings controller settings
+         */
+        void getSettings(size_t loop, IntegralSettings &settings) const {
+            settings.setGain(gain_[loop]);
+            settings.setHasLimits(has_limits_[loop] != 0);
+            settings.setMinLimit(min_limit_[loop]);
+            settings.setMaxLimit(max_limit_[loop]);
+            settings.setMaxTimeStep(max_time_step_[loop]);
+        }
+
+        /**
+         * Update loops [0, count) with one sample each
+         * @param error [in]: float[count] current error signals
+         * @param delta_t [in]: float[count] time since the last call
+         * @param count [in]: size_t number of loops, at most Capacity
+         */
+        void update(const float *error, const float *delta_t, size_t count) {
+            if(hardened_) {
+                IntegralBatch::updateHardened(error, delta_t, gain_, has_limits_, min_limit_, max_limit_, max_time_step_,
+                                              integrated_error_, control_, faults_, count);
+                return;
+            }
+            IntegralBatch::update(error, delta_t, gain_, has_limits_, min_limit_, max_limit_, integrated_error_, control_, count);
+        }
+
+        /**
+         * Update a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param delta_t [in]: float[count] time step of each sample
+         * @param count [in]: size_t number of samples
+         */
+        void updateIndexed(const uint32_t *loops, const float *error, const float *delta_t, size_t count) {
+            if(hardened_) {
+                IntegralBatch::updateIndexedHardened(loops, error, delta_t, gain_, has_limits_, min_limit_, max_limit_,
+                                                     max_time_step_, integrated_error_, control_, faults_, count);
+                return;
+            }
+            IntegralBatch::updateIndexed(loops, error, delta_t, gain_, has_limits_, min_limit_, max_limit_,
+                                         integrated_error_, control_, count);
+        }
+
+        /**
+         * Reset the internal state of one loop
+         */
+        void reset(size_t loop) {
+            integrated_error_[loop] = 0.0;
+            control_[loop] = 0.0;
+            faults_[loop] = 0;
+        }
+
+        /**
+         * Reset the internal state of all loops
+         */
+        void resetAll() {
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                reset(loop);
+            }
+        }
+
+        /**
+         * Select the hardened batch kernels, which ignore non-finite errors and out of range time steps per loop and
+         * report them through the fault flags
+         * @param hardened [in]: bool whether to use the hardened kernels
+         */
+        void setHardened(bool hardened) {
+            hardened_ = hardened;
+            // Only the hardened update reports faults, so none may be left over for antiWindup to act on
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                faults_[loop] = 0;
+            }
+        }
+        bool getHardened() const { return hardened_; }
+
+        float getControl(size_t loop) const { return control_[loop]; }
+        uint8_t getFaults(size_t loop) const { return faults_[loop]; }
+        void setIntegratedError(size_t loop, float int_error) { integrated_error_[loop] = int_error; }
+        float getIntegratedError(size_t loop) const { return integrated_error_[loop]; }
+        size_t capacity() const { return Capacity; }
+
+        // Raw per loop arrays, for bulk copies such as snapshots
+        float *getGainArray() { return gain_; }
+        const float *getGainArray() const { return gain_; }
+        uint8_t *getHasLimitsArray() { return has_limits_; }
+        const uint8_t *getHasLimitsArray() const { return has_limits_; }
+        float *getMinLimitArray() { return min_limit_; }
+        const float *getMinLimitArray() const { return min_limit_; }
+        float *getMaxLimitArray() { return max_limit_; }
+        const float *getMaxLimitArray() const { return max_limit_; }
+        float *getMaxTimeStepArray() { return max_time_step_; }
+        const float *getMaxTimeStepArray() const { return max_time_step_; }
+        float *getIntegratedErrorArray() { return integrated_error_; }
+        const float *getIntegratedErrorArray() const { return integrated_error_; }
+        float *getControlArray() { return control_; }
+        const float *getControlArray() const { return control_; }
+        const uint8_t *getFaultsArray() const { return faults_; }
+
+    private:
+        // Settings, one entry per loop
+        float gain_[Capacity];
+        uint8_t has_limits_[Capacity];
+        float min_limit_[Capacity];
+        float max_limit_[Capacity];
+        float max_time_step_[Capacity];
+
+        // State, one entry per loop
+        float integrated_error_[Capacity];
+
+        // Last control signal, one entry per loop
+        float control_[Capacity];
+
+        // Fault flags from the last hardened update, one entry per loop
+        uint8_t faults_[Capacity];
+
+        // Whether the hardened kernels are used
+        bool hardened_{false};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_INTEGRAL_BANK_H
@@ -0,0 +1,103 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of integral control
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "integralBatch.h"
+#include <base/branchless.h>
+#include <base/controlFaults.h>
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// The arrays of one call must not overlap. __restrict lets the loops vectorize without runtime alias checks.
+void IntegralBatch::update(const float *__restrict error, const float *__restrict delta_t, const float *__restrict gain,
+                           const uint8_t *__restrict has_limits, const float *__restrict min_limit,
+                           const float *__restrict max_limit, float *__restrict integrated_error,
+                           float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        // Update the integral state, handling windup limits
+        float integrated = Kernels::integrate(integrated_error[i], error[i], delta_t[i], has_limits[i] != 0,
+                                              min_limit[i], max_limit[i]);
+
+        // Calculate the control signal
+        integrated_error[i] = integrated;
+        control[i] = Kernels::integral(integrated, gain[i]);
+    }
+}
+
+void IntegralBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict error,
+                                  const float *__restrict delta_t, const float *__restrict gain,
+                                  const uint8_t *__restrict has_limits, const float *__restrict min_limit,
+                                  const float *__restrict max_limit, float *__restrict integrated_error,
+                                  float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        update(&error[i], &delta_t[i], &gain[loop], &has_limits[loop], &min_limit[loop], &max_limit[loop],
+               &integrated_error[loop], &control[loop], 1);
+    }
+}
+
+void IntegralBatch::updateHardened(const float *__restrict error, const float *__restrict delta_t,
+                                   const float *__restrict gain, const uint8_t *__restrict has_limits,
+                                   const float *__restrict min_limit, const float *__restrict max_limit,
+                                   const float *__restrict max_time_step, float *__restrict integrated_error,
+                                   float *__restrict control, uint8_t *__restrict faults, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t error_valid = Base::Branchless::finiteMask(error[i]);
+        uint32_t delta_t_valid = Base::Branchless::rangeMask(delta_t[i], 0.0f, max_time_step[i]);
+        uint32_t valid = error_valid & delta_t_valid;
+
+        // An invalid sample adds nothing
+        float integrated = Kernels::integrate(integrated_error[i], Base::Branchless::select(valid, error[i], 0.0f),
+                                              Base::Branchless::select(valid, delta_t[i], 0.0f), has_limits[i] != 0,
+                                              min_limit[i], max_limit[i]);
+
+        integrated_error[i] = integrated;
+        faults[i] = Base::Branchless::flagIfClear(error_valid, Base::FAULT_ERROR_NOT_FINITE) |
+                    Base::Branchless::flagIfClear(delta_t_valid, Base::FAULT_DELTA_T_OUT_OF_RANGE);
+        control[i] = Kernels::integral(integrated, gain[i]);
+    }
+}
+
+void IntegralBatch::updateIndexedHardened(const uint32_t *__restrict loops, const float *__restrict error,
+                                          const float *__restrict delta_t, const float *__restrict gain,
+                                          const uint8_t *__restrict has_limits, const float *__restrict min_limit,
+                                          const float *__restrict max_limit, const float *__restrict max_time_step,
+                                          float *__restrict integrated_error, float *__restrict control,
+                                          uint8_t *__restrict faults, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        updateHardened(&error[i], &delta_t[i], &gain[loop], &has_limits[loop], &min_limit[loop], &max_limit[loop],
+                       &max_time_step[loop], &integrated_error[loop], &control[loop], &faults[loop], 1);
+    }
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
@@ -0,0 +1,95 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) version of integral control algorithm
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_INTEGRAL_BATCH_H
+#define CONTROLALGORITHMS_PID_INTEGRAL_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class IntegralBatch {
+    public:
+        /**
+         * The calculate function for many independent integral controllers. Element i of every array belongs to loop i.
+         * @param error [in]: float[count] current error signals
+         * @param delta_t [in]: float[count] time since the last call
+         * @param gain [in]: float[count] controller gains
+         * @param has_limits [in]: uint8_t[count] non-zero where the integrated error is limited
+         * @param min_limit [in]: float[count] minimum integrated error, if limited
+         * @param max_limit [in]: float[count] maximum integrated error, if limited
+         * @param integrated_error [in/out]: float[count] integrated error state
+         * @param control [out]: float[count] control signals
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *error, const float *delta_t, const float *gain, const uint8_t *has_limits,
+                           const float *min_limit, const float *max_limit, float *integrated_error, float *control,
+                           size_t count);
+
+        /**
+         * The calculate function for a scattered subset of loops. Samples are applied in order, so a loop may appear more than once.
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param delta_t [in]: float[count] time step of each sample
+         * Remaining parameters are indexed by loop, as in update.
+         */
+        static void updateIndexed(const uint32_t *loops, const float *error, const float *delta_t, const float *gain,
+                                  const uint8_t *has_limits, const float *min_limit, const float *max_limit,
+                                  float *integrated_error, float *control, size_t count);
+
+        /**
+         * As update, but non-finite errors and time steps outside (0, max_time_step] are ignored per loop: the
+         * integrated error is held and Base fault flags are written. Uses masks rather than branches.
+         * @param max_time_step [in]: float[count] largest accepted time step
+         * @param faults [out]: uint8_t[count] Base fault flags
+         * Remaining parameters as in update.
+         */
+        static void updateHardened(const float *error, const float *delta_t, const float *gain, const uint8_t *has_limits,
+                                   const float *min_limit, const float *max_limit, const float *max_time_step,
+                                   float *integrated_error, float *control, uint8_t *faults, size_t count);
+
+        /**
+         * The hardened calculate function for a scattered subset of loops
+         * Parameters as in updateIndexed and updateHardened.
+         */
+        static void updateIndexedHardened(const uint32_t *loops, const float *error, const float *delta_t, const float *gain,
+                                          const uint8_t *has_limits, const float *min_limit, const float *max_limit,
+                                          const float *max_time_step, float *integrated_error, float *control,
+                                          uint8_t *faults, size_t count);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        IntegralBatch() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_INTEGRAL_BATCH_H
@@ -31,34 +31,41 @@
 #define CONTROLALGORITHMS_PID_INTEGRAL_INPUT_H
 
 #include <base/controlInput.h>
+#include <base/numericPolicy.h>
 
 namespace ControlAlgorithms {
 namespace PID {
 
-class IntegralInput: public Base::ControlInput {
+template<typename Policy>
+class IntegralInputT: public Base::ControlInput {
     public:
-        IntegralInput () {};
-        virtual ~IntegralInput() {};
+        IntegralInputT () {};
+        virtual ~IntegralInputT() {};
 
         /**
          * Copy in
-         * @param right [in]: IntegralInput input
+         * @param right [in]: IntegralInputT input
          */
-        void copy(const IntegralInput &right) {
+        void copy(const IntegralInputT &right) {
             // Super call
             Base::ControlInput::copy(right);
 
-            setIntegratedError(right.getIntegratedError());
+            setAccumulator(right.getAccumulator());
         }
 
-        void setIntegratedError(float int_error) { integrated_error_ = int_error; }
-        float getIntegratedError() const { return integrated_error_; }
+        void setIntegratedError(float int_error) { integrated_error_.setValue(int_error); }
+        float getIntegratedError() const { return integrated_error_.getValue(); }
+        void setAccumulator(const typename Policy::Accumulator &accumulator) { integrated_error_ = accumulator; }
+        const typename Policy::Accumulator &getAccumulator() const { return integrated_error_; }
 
     private:
         // The current integrated error
-        float integrated_error_{0.0};
+        typename Policy::Accumulator integrated_error_;
 };
 
+// The float version used throughout the library
+typedef IntegralInputT<Base::FloatPolicy> IntegralInput;
+
 }  // namespace PID
 }  // namespace ControlAlgorithms
 
@@ -30,35 +30,49 @@
 #ifndef CONTROLALGORITHMS_PID_INTEGRAL_OUTPUT_H
 #define CONTROLALGORITHMS_PID_INTEGRAL_OUTPUT_H
 
+#include <stdint.h>
 #include <base/controlOutput.h>
+#include <base/numericPolicy.h>
 
 namespace ControlAlgorithms {
 namespace PID {
 
-class IntegralOutput: public Base::ControlOutput {
+template<typename Policy>
+class IntegralOutputT: public Base::ControlOutput {
     public:
-        IntegralOutput () {};
-        virtual ~IntegralOutput() {};
+        IntegralOutputT () {};
+        virtual ~IntegralOutputT() {};
 
         /**
          * Copy in
-         * @param right [in]: IntegralOutput input
+         * @param right [in]: IntegralOutputT input
          */
-        void copy(const IntegralOutput &right) {
+        void copy(const IntegralOutputT &right) {
             // Super call
             Base::ControlOutput::copy(right);
 
-            setIntegratedError(right.getIntegratedError());
+            setAccumulator(right.getAccumulator());
+            setFaults(right.getFaults());
         }
 
-        void setIntegratedError(float int_error) { integrated_error_ = int_error; }
-        float getIntegratedError() const { return integrated_error_; }
+        void setIntegratedError(float int_error) { integrated_error_.setValue(int_error); }
+        float getIntegratedError() const { return integrated_error_.getValue(); }
+        void setAccumulator(const typename Policy::Accumulator &accumulator) { integrated_error_ = accumulator; }
+        const typename Policy::Accumulator &getAccumulator() const { return integrated_error_; }
+        void setFaults(uint8_t faults) { faults_ = faults; }
+        uint8_t getFaults() const { return faults_; }
 
     private:
         // The current integrated error
-        float integrated_error_{0.0};
+        typename Policy::Accumulator integrated_error_;
+
+        // Base fault flags from the last hardened update
+        uint8_t faults_{0};
 };
 
+// The float version used throughout the library
+typedef IntegralOutputT<Base::FloatPolicy> IntegralOutput;
+
 }  // namespace PID
 }  // namespace ControlAlgorithms
 
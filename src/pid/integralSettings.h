@@ -30,6 +30,7 @@
 #ifndef CONTROLALGORITHMS_PID_INTEGRAL_SETTINGS_H
 #define CONTROLALGORITHMS_PID_INTEGRAL_SETTINGS_H
 
+#include <float.h>
 #include <base/controlSettings.h>
 
 namespace ControlAlgorithms {
@@ -51,6 +52,7 @@ class IntegralSettings : public Base::ControlSettings {
             setHasLimits(right.getHasLimits());
             setMinLimit(right.getMinLimit());
             setMaxLimit(right.getMaxLimit());
+            setMaxTimeStep(right.getMaxTimeStep());
         }
         
         void setHasLimits(bool limits) { has_limits_ = limits; }
@@ -59,6 +61,8 @@ class IntegralSettings : public Base::ControlSettings {
         float getMinLimit() const { return min_limit_; }
         void setMaxLimit(float max_limit) { max_limit_ = max_limit; }
         float getMaxLimit() const { return max_limit_; }
+        void setMaxTimeStep(float max_time_step) { max_time_step_ = max_time_step; }
+        float getMaxTimeStep() const { return max_time_step_; }
 
     private:
         // Whether the integral state has windup limits
@@ -69,6 +73,9 @@ class IntegralSettings : public Base::ControlSettings {
 
         // The maximum limit, if it exists
         float max_limit_{0.0};
+
+        // The largest time step accepted by the hardened update
+        float max_time_step_{FLT_MAX};
 };
 
 }  // namespace PID
@@ -28,24 +28,20 @@
  */
 
 #include "integralStateless.h"
-#include <algorithm>
 
 namespace ControlAlgorithms {
 
 namespace PID {
 
-void IntegralStateless::update(const IntegralInput input, const IntegralSettings settings, IntegralOutput &out) {
-    // Update the integral state
-    out.setIntegratedError(input.getIntegratedError() + input.getError() * input.getDeltaT());
+// Compile time checks of the kernel: a unit error integrating at 0.25 per step, with and without windup limits
+static_assert(Kernels::integrateSteps(4, 0.0f, 1.0f, 0.25f, false, 0.0f, 0.0f) == 1.0f, "integral of a step");
+static_assert(Kernels::integrateSteps(8, 0.0f, 1.0f, 0.25f, true, -1.5f, 1.5f) == 1.5f, "windup limit");
+static_assert(Kernels::integrateSteps(8, 0.0f, -1.0f, 0.25f, true, -1.5f, 1.5f) == -1.5f, "windup limit");
+static_assert(Kernels::integral(Kernels::integrateSteps(2, 0.0f, 1.0f, 0.25f, false, 0.0f, 0.0f), -2.0f) == -1.0f,
+              "integral control");
 
-    // Handle windup limits
-    if(settings.getHasLimits()) {
-        out.setIntegratedError(std::min(settings.getMaxLimit(), std::max(settings.getMinLimit(), out.getIntegratedError())));
-    }
-
-    // Calculate and return the control signal
-    out.setControl(out.getIntegratedError() * settings.getGain());
-}
+// The float kernel is compiled once here rather than in every user of the header
+template class IntegralStatelessT<Base::FloatPolicy>;
 
 }  // namespace PID
 }  // namespace ControlAlgorithms
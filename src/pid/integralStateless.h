@@ -21,7 +21,10 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  * 
- * Stateless version of integral control algorithm
+ * Stateless version of integral control algorithm. Templated on a Base numeric policy for the integrated error;
+ * IntegralStateless is the float version and is instantiated in integralStateless.cpp. Kernels::integrate and
+ * Kernels::integral in pidKernels.h are the constexpr float kernels, which can be called directly where the update
+ * should inline.
  *
  * @author Joel Dunham <joel.ph.dunham@gmail.com>
  * @date 2022/03/08
@@ -33,24 +36,74 @@
 #include <pid/integralInput.h>
 #include <pid/integralSettings.h>
 #include <pid/integralOutput.h>
+#include <base/branchless.h>
+#include <base/controlFaults.h>
+#include <pid/pidKernels.h>
 
 namespace ControlAlgorithms {
 namespace PID {
 
-class IntegralStateless {
+template<typename Policy>
+class IntegralStatelessT {
     public:
         /**
-         * The calculate function for the proportional controller
-         * @param input [in]: IntegralInput values used to calculate the control signal
+         * The calculate function for the integral controller
+         * @param input [in]: IntegralInputT values used to calculate the control signal
          * @param settings [in]: IntegralSettings the controller settings
-         * @param out [out]: IntegralOutput the output signal and any additional/changed data used for continued computations
+         * @param out [out]: IntegralOutputT the output signal and any additional/changed data used for continued computations
          */
-        static void update(const IntegralInput input, const IntegralSettings settings, IntegralOutput &out);
+        static void update(const IntegralInputT<Policy> &input, const IntegralSettings &settings, IntegralOutputT<Policy> &out) {
+            // Update the integral state
+            typename Policy::Accumulator integrated_error = input.getAccumulator();
+            integrated_error.accumulate(input.getError(), input.getDeltaT());
+
+            // Handle windup limits
+            if(settings.getHasLimits()) {
+                integrated_error.limit(settings.getMinLimit(), settings.getMaxLimit());
+            }
+            out.setAccumulator(integrated_error);
+
+            // Calculate and return the control signal
+            out.setControl(Kernels::integral(out.getIntegratedError(), settings.getGain()));
+        }
+
+        /**
+         * As update, but a non-finite error or a time step outside (0, max time step] is ignored: the integrated
+         * error is held and the reason is reported through the output fault flags. Uses masks rather than branches.
+         * @param input [in]: IntegralInputT values used to calculate the control signal
+         * @param settings [in]: IntegralSettings the controller settings
+         * @param out [out]: IntegralOutputT the output signal, fault flags and any additional/changed data used for continued computations
+         */
+        static void updateHardened(const IntegralInputT<Policy> &input, const IntegralSettings &settings, IntegralOutputT<Policy> &out) {
+            uint32_t error_valid = Base::Branchless::finiteMask(input.getError());
+            uint32_t delta_t_valid = Base::Branchless::rangeMask(input.getDeltaT(), 0.0f, settings.getMaxTimeStep());
+            uint32_t valid = error_valid & delta_t_valid;
+
+            // An invalid sample adds nothing
+            typename Policy::Accumulator integrated_error = input.getAccumulator();
+            integrated_error.accumulate(Base::Branchless::select(valid, input.getError(), 0.0f),
+                                        Base::Branchless::select(valid, input.getDeltaT(), 0.0f));
+
+            // Handle windup limits
+            if(settings.getHasLimits()) {
+                integrated_error.limit(settings.getMinLimit(), settings.getMaxLimit());
+            }
+            out.setAccumulator(integrated_error);
+            out.setFaults(Base::Branchless::flagIfClear(error_valid, Base::FAULT_ERROR_NOT_FINITE) |
+                          Base::Branchless::flagIfClear(delta_t_valid, Base::FAULT_DELTA_T_OUT_OF_RANGE));
+
+            // Calculate and return the control signal
+            out.setControl(Kernels::integral(out.getIntegratedError(), settings.getGain()));
+        }
     private:
         // Private constructor to ensure only the static/stateless functions are used.
-        IntegralStateless() {};
+        IntegralStatelessT() {};
 };
 
+// The float version used throughout the library
+typedef IntegralStatelessT<Base::FloatPolicy> IntegralStateless;
+extern template class IntegralStatelessT<Base::FloatPolicy>;
+
 }  // namespace PID
 }  // namespace ControlAlgorithms
 
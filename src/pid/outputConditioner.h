@@ -0,0 +1,139 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Output conditioner for the summed controller output: deadband, magnitude saturation and slew rate limit, with
+ * the limiting fed back to an integral controller so it does not wind up.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_H
+#define CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_H
+
+#include <base/controlOutput.h>
+#include <pid/integral.h>
+#include <pid/outputConditionerInput.h>
+#include <pid/outputConditionerOutput.h>
+#include <pid/outputConditionerSettings.h>
+#include <pid/outputConditionerStateless.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class OutputConditioner {
+    public:
+        OutputConditioner() {};
+        virtual ~OutputConditioner() {};
+
+        /**
+         * Set the conditioner settings
+         * @param settings [in]: OutputConditionerSettings conditioner settings
+         */
+        virtual void setSettings(const OutputConditionerSettings &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the conditioner settings
+         * @param settings [out]: OutputConditionerSettings conditioner settings
+         */
+        virtual void getSettings(OutputConditionerSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: OutputConditionerOutput the internal state
+         */
+        virtual void getState(OutputConditionerOutput &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: OutputConditionerOutput the internal state
+         */
+        virtual void setState(const OutputConditionerOutput &state) {
+            state_.copy(state);
+        }
+
+        /**
+         * Condition the summed control signal
+         * @param control [in]: float the requested control signal
+         * @param delta_t [in]: float time since the last call
+         * @param out [out]: Base::ControlOutput the conditioned control signal
+         */
+        virtual void update(float control, float delta_t, Base::ControlOutput &out) {
+            // Fill the input with state in place
+            input_with_state_.setControl(control);
+            input_with_state_.setDeltaT(delta_t);
+            input_with_state_.setPreviousControl(state_.getControl());
+
+            // Run the update
+            OutputConditionerStateless::update(input_with_state_, settings_, state_);
+
+            // Copy to output
+            out.copy(state_);
+        }
+
+        /**
+         * Condition the summed control signal and feed the limiting back to the integral controller updated in
+         * the same step
+         * @param control [in]: float the requested control signal
+         * @param delta_t [in]: float time since the last call
+         * @param out [out]: Base::ControlOutput the conditioned control signal
+         * @param integral [in/out]: IntegralT the integral controller
+         */
+        template<typename Policy>
+        void update(float control, float delta_t, Base::ControlOutput &out, IntegralT<Policy> &integral) {
+            update(control, delta_t, out);
+            integral.antiWindup(state_, settings_);
+        }
+
+        /**
+         * Reset the internal state; the slew rate limit starts again from zero
+         */
+        virtual void reset() {
+            state_.copy(OutputConditionerOutput());
+        }
+
+        virtual bool isStateful() { return true; }
+
+        virtual int8_t getSaturation() const { return state_.getSaturation(); }
+
+    private:
+        // The stored settings
+        OutputConditionerSettings settings_;
+
+        // Contains all required state info
+        OutputConditionerOutput state_;
+
+        // Used for the internal call with state
+        OutputConditionerInput input_with_state_;
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_H
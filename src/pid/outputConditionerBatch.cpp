@@ -0,0 +1,98 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of output conditioning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "outputConditionerBatch.h"
+#include <base/branchless.h>
+#include <base/controlFaults.h>
+#include <pid/outputConditionerSettings.h>
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// The arrays of one call must not overlap. __restrict lets the loops vectorize without runtime alias checks.
+void OutputConditionerBatch::update(const float *__restrict control, const float *__restrict delta_t,
+                                    const uint8_t *__restrict has_limits, const float *__restrict min_limit,
+                                    const float *__restrict max_limit, const uint8_t *__restrict has_rate_limit,
+                                    const float *__restrict max_rate, const float *__restrict deadband,
+                                    float *__restrict conditioned, float *__restrict excess, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        // Every stage is computed and selected, so the loop has no data dependent branches
+        float banded = Kernels::deadband(control[i], deadband[i]);
+        float saturated = Kernels::limit(banded, min_limit[i], max_limit[i]);
+        saturated = has_limits[i] != 0 ? saturated : banded;
+        float slewed = Kernels::slew(saturated, conditioned[i], max_rate[i], delta_t[i]);
+        float output = has_rate_limit[i] != 0 ? slewed : saturated;
+        excess[i] = output - banded;
+        conditioned[i] = output;
+    }
+}
+
+void OutputConditionerBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict control,
+                                           const float *__restrict delta_t, const uint8_t *__restrict has_limits,
+                                           const float *__restrict min_limit, const float *__restrict max_limit,
+                                           const uint8_t *__restrict has_rate_limit, const float *__restrict max_rate,
+                                           const float *__restrict deadband, float *__restrict conditioned,
+                                           float *__restrict excess, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        update(&control[i], &delta_t[i], &has_limits[loop], &min_limit[loop], &max_limit[loop], &has_rate_limit[loop],
+               &max_rate[loop], &deadband[loop], &conditioned[loop], &excess[loop], 1);
+    }
+}
+
+void OutputConditionerBatch::antiWindup(const float *__restrict error, const float *__restrict delta_t,
+                                        const uint8_t *__restrict faults, const float *__restrict excess,
+                                        const uint8_t *__restrict anti_windup,
+                                        const float *__restrict tracking_gain, const float *__restrict gain,
+                                        const uint8_t *__restrict has_limits, const float *__restrict min_limit,
+                                        const float *__restrict max_limit, float *__restrict integrated_error,
+                                        size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        // Both corrections are computed and one selected, so the loop has no data dependent branches. Conditional
+        // integration takes back the step that pushed further into the limit.
+        float integrated = integrated_error[i];
+        float clamped = Base::Branchless::select(Base::Branchless::mask(excess[i] * gain[i] * error[i] < 0.0f),
+                                                 integrated - error[i] * delta_t[i], integrated);
+        float tracked = Kernels::backCalculate(integrated, excess[i], delta_t[i], gain[i], tracking_gain[i]);
+        uint32_t back_calculate = Base::Branchless::mask(anti_windup[i] == ANTI_WINDUP_BACK_CALCULATION);
+        uint32_t clamp = Base::Branchless::mask(anti_windup[i] == ANTI_WINDUP_CLAMP);
+        float corrected = Base::Branchless::select(back_calculate, tracked, integrated);
+        corrected = Base::Branchless::select(clamp, clamped, corrected);
+        float limited = Kernels::limit(corrected, min_limit[i], max_limit[i]);
+        corrected = has_limits[i] != 0 ? limited : corrected;
+        // A rejected sample's error and time step may be NaN or out of range, so its lane keeps its state
+        integrated_error[i] = Base::Branchless::select(Base::Branchless::mask(faults[i] == Base::FAULT_NONE), corrected,
+                                                       integrated);
+    }
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
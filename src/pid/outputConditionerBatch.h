@@ -0,0 +1,100 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) version of output conditioning and its anti-windup feedback. The integral arrays
+ * can be those of an IntegralBank.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_BATCH_H
+#define CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class OutputConditionerBatch {
+    public:
+        /**
+         * The calculate function for many independent output conditioners. Element i of every array belongs to loop i.
+         * @param control [in]: float[count] requested control signals
+         * @param delta_t [in]: float[count] time since the last call
+         * @param has_limits [in]: uint8_t[count] non-zero where the output is saturated
+         * @param min_limit [in]: float[count] minimum outputs, if saturated
+         * @param max_limit [in]: float[count] maximum outputs, if saturated
+         * @param has_rate_limit [in]: uint8_t[count] non-zero where the output is slew rate limited
+         * @param max_rate [in]: float[count] largest changes per unit time, if rate limited
+         * @param deadband [in]: float[count] deadband half widths
+         * @param conditioned [in/out]: float[count] conditioned outputs, holding the last call's on entry
+         * @param excess [out]: float[count] conditioned minus requested control signals after the deadband
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *control, const float *delta_t, const uint8_t *has_limits, const float *min_limit,
+                           const float *max_limit, const uint8_t *has_rate_limit, const float *max_rate,
+                           const float *deadband, float *conditioned, float *excess, size_t count);
+
+        /**
+         * The calculate function for a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param control [in]: float[count] requested control signal of each sample
+         * @param delta_t [in]: float[count] time step of each sample
+         * Remaining parameters are indexed by loop, as in update.
+         */
+        static void updateIndexed(const uint32_t *loops, const float *control, const float *delta_t,
+                                  const uint8_t *has_limits, const float *min_limit, const float *max_limit,
+                                  const uint8_t *has_rate_limit, const float *max_rate, const float *deadband,
+                                  float *conditioned, float *excess, size_t count);
+
+        /**
+         * Feed the limiting back to the integrators updated in the same step
+         * @param error [in]: float[count] error signals the integrators were updated with
+         * @param delta_t [in]: float[count] time steps the integrators were updated with
+         * @param faults [in]: uint8_t[count] fault flags of the integrators' update; a sample the hardened update
+         * rejected is not corrected
+         * @param excess [in]: float[count] excess from update
+         * @param anti_windup [in]: uint8_t[count] ANTI_WINDUP_NONE, ANTI_WINDUP_CLAMP or ANTI_WINDUP_BACK_CALCULATION
+         * @param tracking_gain [in]: float[count] tracking rates for back calculation
+         * @param gain [in]: float[count] integral gains
+         * @param has_limits [in]: uint8_t[count] non-zero where the integrated error is limited
+         * @param min_limit [in]: float[count] minimum integrated error, if limited
+         * @param max_limit [in]: float[count] maximum integrated error, if limited
+         * @param integrated_error [in/out]: float[count] integrated error state
+         * @param count [in]: size_t number of loops
+         */
+        static void antiWindup(const float *error, const float *delta_t, const uint8_t *faults, const float *excess,
+                               const uint8_t *anti_windup, const float *tracking_gain, const float *gain,
+                               const uint8_t *has_limits, const float *min_limit, const float *max_limit,
+                               float *integrated_error, size_t count);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        OutputConditionerBatch() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_BATCH_H
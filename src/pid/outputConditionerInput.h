@@ -0,0 +1,72 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Input for output conditioning: the summed control signal requested by the controllers and the conditioned
+ * output of the last call
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_INPUT_H
+#define CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_INPUT_H
+
+#include <base/controlInput.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class OutputConditionerInput: public Base::ControlInput {
+    public:
+        OutputConditionerInput () {};
+        virtual ~OutputConditionerInput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: OutputConditionerInput input
+         */
+        void copy(const OutputConditionerInput &right) {
+            // Super call
+            Base::ControlInput::copy(right);
+
+            setControl(right.getControl());
+            setPreviousControl(right.getPreviousControl());
+        }
+
+        void setControl(float control) { control_ = control; }
+        float getControl() const { return control_; }
+        void setPreviousControl(float previous_control) { previous_control_ = previous_control; }
+        float getPreviousControl() const { return previous_control_; }
+
+    private:
+        // The requested control signal, e.g. the sum of the proportional, integral and derivative outputs
+        float control_{0.0};
+
+        // The conditioned output of the last call, the start of the slew rate limit
+        float previous_control_{0.0};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_INPUT_H
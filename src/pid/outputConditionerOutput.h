@@ -0,0 +1,72 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Output of output conditioning: the conditioned control signal and how far it was limited
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_OUTPUT_H
+#define CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_OUTPUT_H
+
+#include <stdint.h>
+#include <base/controlOutput.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class OutputConditionerOutput: public Base::ControlOutput {
+    public:
+        OutputConditionerOutput () {};
+        virtual ~OutputConditionerOutput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: OutputConditionerOutput input
+         */
+        void copy(const OutputConditionerOutput &right) {
+            // Super call
+            Base::ControlOutput::copy(right);
+
+            setExcess(right.getExcess());
+        }
+
+        void setExcess(float excess) { excess_ = excess; }
+        float getExcess() const { return excess_; }
+
+        /**
+         * Direction the output is limited in
+         * @return int8_t 1 if held below the request, -1 if held above it, 0 if not limited
+         */
+        int8_t getSaturation() const { return excess_ < 0.0f ? 1 : (excess_ > 0.0f ? -1 : 0); }
+
+    private:
+        // Conditioned minus requested control signal after the deadband; zero when not limited
+        float excess_{0.0};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_OUTPUT_H
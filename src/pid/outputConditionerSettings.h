@@ -0,0 +1,109 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for conditioning the summed controller output
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_SETTINGS_H
+#define CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_SETTINGS_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+// How limiting of the output is fed back to the integrator
+const uint8_t ANTI_WINDUP_NONE = 0;
+const uint8_t ANTI_WINDUP_CLAMP = 1;
+const uint8_t ANTI_WINDUP_BACK_CALCULATION = 2;
+
+class OutputConditionerSettings {
+    public:
+        OutputConditionerSettings () {};
+        virtual ~OutputConditionerSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: OutputConditionerSettings input settings
+         */
+        void copy(const OutputConditionerSettings &right) {
+            setHasLimits(right.getHasLimits());
+            setMinLimit(right.getMinLimit());
+            setMaxLimit(right.getMaxLimit());
+            setHasRateLimit(right.getHasRateLimit());
+            setMaxRate(right.getMaxRate());
+            setDeadband(right.getDeadband());
+            setAntiWindup(right.getAntiWindup());
+            setTrackingGain(right.getTrackingGain());
+        }
+
+        void setHasLimits(bool limits) { has_limits_ = limits; }
+        bool getHasLimits() const { return has_limits_; }
+        void setMinLimit(float min_limit) { min_limit_ = min_limit; }
+        float getMinLimit() const { return min_limit_; }
+        void setMaxLimit(float max_limit) { max_limit_ = max_limit; }
+        float getMaxLimit() const { return max_limit_; }
+        void setHasRateLimit(bool rate_limit) { has_rate_limit_ = rate_limit; }
+        bool getHasRateLimit() const { return has_rate_limit_; }
+        void setMaxRate(float max_rate) { max_rate_ = max_rate; }
+        float getMaxRate() const { return max_rate_; }
+        void setDeadband(float deadband) { deadband_ = deadband; }
+        float getDeadband() const { return deadband_; }
+        void setAntiWindup(uint8_t anti_windup) { anti_windup_ = anti_windup; }
+        uint8_t getAntiWindup() const { return anti_windup_; }
+        void setTrackingGain(float tracking_gain) { tracking_gain_ = tracking_gain; }
+        float getTrackingGain() const { return tracking_gain_; }
+
+    private:
+        // Whether the output is saturated
+        bool has_limits_{false};
+
+        // The minimum output, if saturated
+        float min_limit_{0.0};
+
+        // The maximum output, if saturated
+        float max_limit_{0.0};
+
+        // Whether the output is slew rate limited
+        bool has_rate_limit_{false};
+
+        // The largest change of the output per unit time, if rate limited
+        float max_rate_{0.0};
+
+        // Half width of the deadband around zero; zero for none
+        float deadband_{0.0};
+
+        // ANTI_WINDUP_NONE, ANTI_WINDUP_CLAMP or ANTI_WINDUP_BACK_CALCULATION
+        uint8_t anti_windup_{ANTI_WINDUP_CLAMP};
+
+        // Tracking rate 1 / Tt for back calculation
+        float tracking_gain_{1.0};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_SETTINGS_H
@@ -0,0 +1,54 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of output conditioning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "outputConditionerStateless.h"
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// Compile time checks of the kernels
+static_assert(Kernels::deadband(0.05f, 0.1f) == 0.0f && Kernels::deadband(-0.5f, 0.1f) == -0.5f, "deadband");
+static_assert(Kernels::slew(10.0f, 1.0f, 2.0f, 0.5f) == 2.0f && Kernels::slew(-10.0f, 1.0f, 2.0f, 0.5f) == 0.0f,
+              "slew rate limit");
+static_assert(Kernels::condition(5.0f, 0.0f, 1.0f, 0.0f, true, -1.0f, 1.0f, false, 0.0f) == 1.0f, "saturation");
+static_assert(Kernels::backCalculate(2.0f, -1.0f, 0.5f, 2.0f, 1.0f) == 1.75f, "back calculation");
+
+void OutputConditionerStateless::update(const OutputConditionerInput &input, const OutputConditionerSettings &settings,
+                                        OutputConditionerOutput &out) {
+    float control = Kernels::condition(input.getControl(), input.getPreviousControl(), input.getDeltaT(),
+                                       settings.getDeadband(), settings.getHasLimits(), settings.getMinLimit(),
+                                       settings.getMaxLimit(), settings.getHasRateLimit(), settings.getMaxRate());
+    out.setExcess(control - Kernels::deadband(input.getControl(), settings.getDeadband()));
+    out.setControl(control);
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
@@ -0,0 +1,103 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless conditioning of the summed controller output: deadband, magnitude saturation and slew rate limit.
+ * How far the output was limited is fed back to the integrator with antiWindup, so the integrated error stops
+ * growing while the actuator cannot follow.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_STATELESS_H
+#define CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_STATELESS_H
+
+#include <base/controlFaults.h>
+#include <base/controlInput.h>
+#include <pid/integralOutput.h>
+#include <pid/integralSettings.h>
+#include <pid/outputConditionerInput.h>
+#include <pid/outputConditionerOutput.h>
+#include <pid/outputConditionerSettings.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class OutputConditionerStateless {
+    public:
+        /**
+         * The calculate function for the output conditioner
+         * @param input [in]: OutputConditionerInput requested control signal, time step and the last output
+         * @param settings [in]: OutputConditionerSettings the conditioner settings
+         * @param out [out]: OutputConditionerOutput the conditioned control signal and excess
+         */
+        static void update(const OutputConditionerInput &input, const OutputConditionerSettings &settings,
+                           OutputConditionerOutput &out);
+
+        /**
+         * Feed the limiting of an output back to the integrator that contributed to it. Call after update with
+         * the integrator's input and output of the same step. An integrator output with fault flags set comes from a
+         * sample the hardened update rejected, whose error and time step are not used.
+         * @param conditioned [in]: OutputConditionerOutput output of update
+         * @param settings [in]: OutputConditionerSettings the conditioner settings
+         * @param input [in]: Base::ControlInput the error and time step the integrator was updated with
+         * @param integral_settings [in]: IntegralSettings the integrator settings
+         * @param integral [in/out]: IntegralOutputT the integrator output, whose integrated error is corrected
+         */
+        template<typename Policy>
+        static void antiWindup(const OutputConditionerOutput &conditioned, const OutputConditionerSettings &settings,
+                               const Base::ControlInput &input, const IntegralSettings &integral_settings,
+                               IntegralOutputT<Policy> &integral) {
+            if(integral.getFaults() != Base::FAULT_NONE) {
+                return;
+            }
+            float excess = conditioned.getExcess();
+            float gain = integral_settings.getGain();
+            typename Policy::Accumulator integrated_error = integral.getAccumulator();
+            if(settings.getAntiWindup() == ANTI_WINDUP_CLAMP) {
+                // Take back the step that pushed further into the limit
+                if(excess * gain * input.getError() < 0.0f) {
+                    integrated_error.accumulate(-input.getError(), input.getDeltaT());
+                }
+            } else if(settings.getAntiWindup() == ANTI_WINDUP_BACK_CALCULATION) {
+                if(gain != 0.0f) {
+                    integrated_error.accumulate(settings.getTrackingGain() * excess / gain, input.getDeltaT());
+                }
+            } else {
+                return;
+            }
+            if(integral_settings.getHasLimits()) {
+                integrated_error.limit(integral_settings.getMinLimit(), integral_settings.getMaxLimit());
+            }
+            integral.setAccumulator(integrated_error);
+        }
+
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        OutputConditionerStateless() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_OUTPUT_CONDITIONER_STATELESS_H
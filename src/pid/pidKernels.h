@@ -0,0 +1,215 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Header only kernels of the proportional, integral and derivative controllers on plain floats. They are
+ * constexpr, so they inline into user loops without link time optimization and whole step responses can be
+ * checked with static_assert. The stateless, stateful and batch classes are built on these.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_PID_KERNELS_H
+#define CONTROLALGORITHMS_PID_PID_KERNELS_H
+
+#include <stdint.h>
+#include <math.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+namespace Kernels {
+
+/**
+ * Proportional control signal
+ * @param error [in]: float the error signal
+ * @param gain [in]: float the controller gain
+ * @return float the control signal
+ */
+constexpr float proportional(float error, float gain) {
+    return error * gain;
+}
+
+/**
+ * Larger of two values, matching std::max(value, lower): a NaN value propagates
+ */
+constexpr float lowerBound(float value, float lower) {
+    return value < lower ? lower : value;
+}
+
+/**
+ * Smaller of two values, matching std::min(upper, value): a NaN value gives upper
+ */
+constexpr float upperBound(float value, float upper) {
+    return value < upper ? value : upper;
+}
+
+/**
+ * Clamp to [min_limit, max_limit], matching std::min(max_limit, std::max(min_limit, value)): a NaN value gives
+ * min_limit
+ */
+constexpr float limit(float value, float min_limit, float max_limit) {
+    return upperBound(min_limit < value ? value : min_limit, max_limit);
+}
+
+/**
+ * Next integrated error
+ * @param integrated_error [in]: float the current integrated error
+ * @param error [in]: float the error signal
+ * @param delta_t [in]: float time since the last call
+ * @param has_limits [in]: bool whether the integrated error is limited
+ * @param min_limit [in]: float the minimum integrated error, if limited
+ * @param max_limit [in]: float the maximum integrated error, if limited
+ * @return float the new integrated error
+ */
+constexpr float integrate(float integrated_error, float error, float delta_t, bool has_limits, float min_limit,
+                          float max_limit) {
+    return has_limits ? limit(integrated_error + error * delta_t, min_limit, max_limit)
+                      : integrated_error + error * delta_t;
+}
+
+/**
+ * Integral control signal
+ * @param integrated_error [in]: float the integrated error after the update
+ * @param gain [in]: float the controller gain
+ * @return float the control signal
+ */
+constexpr float integral(float integrated_error, float gain) {
+    return integrated_error * gain;
+}
+
+/**
+ * Derivative control signal
+ * @param error [in]: float the error signal
+ * @param previous_error [in]: float the error signal of the last call
+ * @param delta_t [in]: float time since the last call
+ * @param min_time_step [in]: float the smallest time step divided by
+ * @param gain [in]: float the controller gain
+ * @return float the control signal
+ */
+constexpr float derivative(float error, float previous_error, float delta_t, float min_time_step, float gain) {
+    return (error - previous_error) / lowerBound(delta_t, min_time_step) * gain;
+}
+
+/**
+ * Setpoint weighted error of a 2-DOF controller. A weight of one gives the plain error; a weight of zero acts on
+ * the measurement alone, so setpoint steps do not reach the term.
+ * @param setpoint [in]: float the setpoint
+ * @param measurement [in]: float the measured value
+ * @param weight [in]: float the setpoint weight (b for proportional, c for derivative)
+ * @return float the weighted error
+ */
+constexpr float weightedError(float setpoint, float measurement, float weight) {
+    return weight * setpoint - measurement;
+}
+
+/**
+ * 2-DOF proportional control signal, including the feed-forward term
+ * @param setpoint [in]: float the setpoint
+ * @param measurement [in]: float the measured value
+ * @param weight [in]: float the setpoint weight b
+ * @param gain [in]: float the controller gain
+ * @param feed_forward [in]: float the precomputed feed-forward term
+ * @return float the control signal
+ */
+constexpr float weightedProportional(float setpoint, float measurement, float weight, float gain, float feed_forward) {
+    return proportional(weightedError(setpoint, measurement, weight), gain) + feed_forward;
+}
+
+/**
+ * Output deadband: commands smaller in magnitude than the width are zeroed, larger ones pass unchanged
+ * @param value [in]: float the control signal
+ * @param width [in]: float the deadband half width, zero for none
+ * @return float the control signal after the deadband
+ */
+constexpr float deadband(float value, float width) {
+    return ((value < width) & (value > -width)) ? 0.0f : value;
+}
+
+/**
+ * Slew rate limit: the step from the previous output is kept within max_rate * delta_t
+ * @param value [in]: float the requested control signal
+ * @param previous [in]: float the output of the last call
+ * @param max_rate [in]: float the largest change per unit time
+ * @param delta_t [in]: float time since the last call
+ * @return float the rate limited control signal
+ */
+constexpr float slew(float value, float previous, float max_rate, float delta_t) {
+    return limit(value, previous - max_rate * delta_t, previous + max_rate * delta_t);
+}
+
+/**
+ * Conditioned output: deadband, then magnitude saturation, then slew rate limit. The excess for anti-windup is
+ * the result minus deadband(value, deadband_width), so the deadband itself does not count as limiting.
+ * @param value [in]: float the requested control signal
+ * @param previous [in]: float the conditioned output of the last call
+ * @param delta_t [in]: float time since the last call
+ * @param deadband_width [in]: float the deadband half width, zero for none
+ * @param has_limits [in]: bool whether the output is saturated
+ * @param min_limit [in]: float the minimum output, if saturated
+ * @param max_limit [in]: float the maximum output, if saturated
+ * @param has_rate_limit [in]: bool whether the output is slew rate limited
+ * @param max_rate [in]: float the largest change per unit time, if rate limited
+ * @return float the conditioned control signal
+ */
+constexpr float condition(float value, float previous, float delta_t, float deadband_width, bool has_limits,
+                          float min_limit, float max_limit, bool has_rate_limit, float max_rate) {
+    return has_rate_limit ? slew(has_limits ? limit(deadband(value, deadband_width), min_limit, max_limit)
+                                            : deadband(value, deadband_width),
+                                 previous, max_rate, delta_t)
+                          : (has_limits ? limit(deadband(value, deadband_width), min_limit, max_limit)
+                                        : deadband(value, deadband_width));
+}
+
+/**
+ * Back calculation anti-windup: the integral control signal is pulled towards the limited output at the
+ * tracking rate
+ * @param integrated_error [in]: float the integrated error after the update
+ * @param excess [in]: float conditioned minus requested control signal, zero when not limited
+ * @param delta_t [in]: float time step of the update
+ * @param gain [in]: float the integral gain
+ * @param tracking_gain [in]: float the tracking rate, 1 / Tt
+ * @return float the corrected integrated error
+ */
+constexpr float backCalculate(float integrated_error, float excess, float delta_t, float gain, float tracking_gain) {
+    // Same order as the stateless accumulate, so the paths agree bit for bit. Dividing by infinity rather than
+    // branching on a zero gain keeps the kernel a straight line.
+    return integrated_error + tracking_gain * excess / (gain != 0.0f ? gain : INFINITY) * delta_t;
+}
+
+/**
+ * Integrated error after a constant error has been applied for a number of steps, for compile time checks
+ * @param steps [in]: uint32_t number of updates
+ * Remaining parameters as in integrate.
+ */
+constexpr float integrateSteps(uint32_t steps, float integrated_error, float error, float delta_t, bool has_limits,
+                               float min_limit, float max_limit) {
+    return steps == 0 ? integrated_error
+                      : integrateSteps(steps - 1, integrate(integrated_error, error, delta_t, has_limits, min_limit, max_limit),
+                                       error, delta_t, has_limits, min_limit, max_limit);
+}
+
+}  // namespace Kernels
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_PID_KERNELS_H
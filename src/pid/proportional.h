@@ -51,12 +51,20 @@ class Proportional {
             settings_.copy(settings);
         }
 
+        /**
+         * Get the controller settings
+         * @param settings [out]: Base::ControlSettings controller settings
+         */
+        virtual void getSettings(Base::ControlSettings &settings) const {
+            settings.copy(settings_);
+        }
+
         /**
          * The calculate function for the proportional controller
          * @param input [in]: Base::ControlInput values used to calculate the control signal
          * @param out [out]: Base::ControlOutput the output signal and any additional/changed data used for continued computations
          */
-        virtual void update(const Base::ControlInput input, Base::ControlOutput &out) {
+        virtual void update(const Base::ControlInput &input, Base::ControlOutput &out) {
             ProportionalStateless::update(input, settings_, out);
         }
 
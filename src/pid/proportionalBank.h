@@ -0,0 +1,130 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * A fixed capacity bank of proportional controllers stored as structure of arrays and updated with ProportionalBatch.
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_PROPORTIONAL_BANK_H
+#define CONTROLALGORITHMS_PID_PROPORTIONAL_BANK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <base/controlSettings.h>
+#include <pid/proportionalBatch.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+template<size_t Capacity>
+class ProportionalBank {
+    public:
+        ProportionalBank() {
+            Base::ControlSettings defaults;
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                setSettings(loop, defaults);
+            }
+            resetAll();
+        };
+        virtual ~ProportionalBank() {};
+
+        /**
+         * Set the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [in]: Base::ControlSettings controller settings
+         */
+        void setSettings(size_t loop, const Base::ControlSettings &settings) {
+            gain_[loop] = settings.getGain();
+        }
+
+        /**
+         * Get the settings of one loop
+         * @param loop [in]: size_t loop index
+         * @param settings [out]: Base::ControlSettings controller settings
+         */
+        void getSettings(size_t loop, Base::ControlSettings &settings) const {
+            settings.setGain(gain_[loop]);
+        }
+
+        /**
+         * Update loops [0, count) with one sample each
+         * @param error [in]: float[count] current error signals
+         * @param delta_t [in]: float[count] unused, kept so all banks share one update signature
+         * @param count [in]: size_t number of loops, at most Capacity
+         */
+        void update(const float *error, const float *delta_t, size_t count) {
+            (void)delta_t;
+            ProportionalBatch::update(error, gain_, control_, count);
+        }
+
+        /**
+         * Update a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param delta_t [in]: float[count] unused, kept so all banks share one update signature
+         * @param count [in]: size_t number of samples
+         */
+        void updateIndexed(const uint32_t *loops, const float *error, const float *delta_t, size_t count) {
+            (void)delta_t;
+            ProportionalBatch::updateIndexed(loops, error, gain_, control_, count);
+        }
+
+        /**
+         * Reset the last control signal of one loop (proportional control has no state)
+         */
+        void reset(size_t loop) {
+            control_[loop] = 0.0;
+        }
+
+        /**
+         * Reset all loops
+         */
+        void resetAll() {
+            for(size_t loop = 0; loop < Capacity; ++loop) {
+                reset(loop);
+            }
+        }
+
+        float getControl(size_t loop) const { return control_[loop]; }
+        size_t capacity() const { return Capacity; }
+
+        // Raw per loop arrays, for bulk copies such as snapshots
+        float *getGainArray() { return gain_; }
+        const float *getGainArray() const { return gain_; }
+        float *getControlArray() { return control_; }
+        const float *getControlArray() const { return control_; }
+
+    private:
+        // Settings, one entry per loop
+        float gain_[Capacity];
+
+        // Last control signal, one entry per loop
+        float control_[Capacity];
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_PROPORTIONAL_BANK_H
@@ -0,0 +1,53 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of proportional control
+ * 
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "proportionalBatch.h"
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// The arrays of one call must not overlap. __restrict lets the loops vectorize without runtime alias checks.
+void ProportionalBatch::update(const float *__restrict error, const float *__restrict gain, float *__restrict control,
+                               size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        control[i] = Kernels::proportional(error[i], gain[i]);
+    }
+}
+
+void ProportionalBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict error,
+                                      const float *__restrict gain, float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        control[loops[i]] = Kernels::proportional(error[i], gain[loops[i]]);
+    }
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
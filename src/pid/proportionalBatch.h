@@ -0,0 +1,67 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) version of proportional control algorithm
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_PROPORTIONAL_BATCH_H
+#define CONTROLALGORITHMS_PID_PROPORTIONAL_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class ProportionalBatch {
+    public:
+        /**
+         * The calculate function for many independent proportional controllers. Element i of every array belongs to loop i.
+         * @param error [in]: float[count] current error signals
+         * @param gain [in]: float[count] controller gains
+         * @param control [out]: float[count] control signals
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *error, const float *gain, float *control, size_t count);
+
+        /**
+         * The calculate function for a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param error [in]: float[count] error signal of each sample
+         * @param gain [in]: float[] controller gains, indexed by loop
+         * @param control [out]: float[] control signals, indexed by loop
+         * @param count [in]: size_t number of samples
+         */
+        static void updateIndexed(const uint32_t *loops, const float *error, const float *gain, float *control, size_t count);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        ProportionalBatch() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_PROPORTIONAL_BATCH_H
@@ -28,7 +28,7 @@
  */
 
 #include "proportionalStateless.h"
-#include <algorithm>
+#include <pid/pidKernels.h>
 
 namespace ControlAlgorithms {
 
@@ -36,8 +36,11 @@ using namespace Base;
 
 namespace PID {
 
-void ProportionalStateless::update(const ControlInput input, const ControlSettings settings, ControlOutput &out) {
-    out.setControl(input.getError() * settings.getGain());
+// Compile time check of the kernel
+static_assert(Kernels::proportional(2.0f, -0.5f) == -1.0f, "proportional control");
+
+void ProportionalStateless::update(const ControlInput &input, const ControlSettings &settings, ControlOutput &out) {
+    out.setControl(Kernels::proportional(input.getError(), settings.getGain()));
 }
 
 }  // namespace PID
@@ -21,7 +21,8 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  * 
- * Stateless version of proportional control algorithm
+ * Stateless version of proportional control algorithm. Wraps Kernels::proportional from pidKernels.h, which can be
+ * called directly where the update should inline.
  *
  * @author Joel Dunham <joel.ph.dunham@gmail.com>
  * @date 2022/03/08
@@ -45,7 +46,7 @@ class ProportionalStateless {
          * @param settings [in]: Base::ControlSettings the controller settings
          * @param out [out]: Base::ControlOutput the output signal and any additional/changed data used for continued computations
          */
-        static void update(const Base::ControlInput input, const Base::ControlSettings settings, Base::ControlOutput &out);
+        static void update(const Base::ControlInput &input, const Base::ControlSettings &settings, Base::ControlOutput &out);
     private:
         // Private constructor to ensure only the static/stateless functions are used.
         ProportionalStateless() {};
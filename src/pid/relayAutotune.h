@@ -0,0 +1,153 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Online relay feedback autotuning. Run in place of the controller until isComplete(), then apply the tuned
+ * settings. Memory use is fixed and each update is a handful of float operations, so it fits in the normal tick.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_H
+#define CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_H
+
+#include <pid/relayAutotuneInput.h>
+#include <pid/relayAutotuneSettings.h>
+#include <pid/relayAutotuneOutput.h>
+#include <pid/relayAutotuneStateless.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class RelayAutotune {
+    public:
+        RelayAutotune() {};
+        virtual ~RelayAutotune() {};
+
+        /**
+         * Set the relay settings
+         * @param settings [in]: RelayAutotuneSettings relay settings
+         */
+        virtual void setSettings(const RelayAutotuneSettings &settings) {
+            settings_.copy(settings);
+        }
+
+        /**
+         * Get the relay settings
+         * @param settings [out]: RelayAutotuneSettings relay settings
+         */
+        virtual void getSettings(RelayAutotuneSettings &settings) const {
+            settings.copy(settings_);
+        }
+
+        /**
+         * Get the internal state, e.g. to checkpoint it
+         * @param state [out]: RelayAutotuneOutput the internal state
+         */
+        virtual void getState(RelayAutotuneOutput &state) const {
+            state.copy(state_);
+        }
+
+        /**
+         * Restore the internal state, e.g. from a checkpoint
+         * @param state [in]: RelayAutotuneOutput the internal state
+         */
+        virtual void setState(const RelayAutotuneOutput &state) {
+            state_.copy(state);
+        }
+
+        /**
+         * The calculate function for the relay
+         * @param input [in]: Base::ControlInput values used to calculate the control signal
+         * @param out [out]: Base::ControlOutput the relay output
+         */
+        virtual void update(const Base::ControlInput &input, Base::ControlOutput &out) {
+            // Fill the input with state in place
+            input_with_state_.setError(input.getError());
+            input_with_state_.setDeltaT(input.getDeltaT());
+            input_with_state_.setState(state_.getState());
+
+            // Run the update
+            RelayAutotuneStateless::update(input_with_state_, settings_, state_);
+
+            // Copy to output
+            out.copy(state_);
+        }
+
+        /**
+         * Restart tuning
+         */
+        virtual void reset() {
+            state_.copy(RelayAutotuneOutput());
+        }
+
+        virtual bool isStateful() { return true; }
+
+        /**
+         * Whether enough cycles have been measured for getTunedSettings
+         * @return bool true once the measurement cycles have completed
+         */
+        virtual bool isComplete() const { return state_.getComplete(); }
+
+        /**
+         * Ultimate gain and period estimated from the limit cycle. The describing function assumes the error is a
+         * sine, but a lag plus dead time gives a waveform closer to a triangle, whose first harmonic is smaller than
+         * the half swing. The gain therefore reads low, e.g. about 0.8 of the exact value for a dead time of 0.2
+         * time constants (examples/RelayAutotune). The period is typically within a few percent. Both tuning
+         * rules leave margin for this.
+         */
+        virtual float getUltimateGain() const { return state_.getUltimateGain(); }
+        virtual float getUltimatePeriod() const { return state_.getUltimatePeriod(); }
+
+        /**
+         * Set the controller gains from the estimate
+         * @param rule [in]: uint8_t TUNING_ZIEGLER_NICHOLS or TUNING_TYREUS_LUYBEN
+         * @param proportional [in/out]: Base::ControlSettings proportional settings
+         * @param integral [in/out]: IntegralSettings integral settings
+         * @param derivative [in/out]: DerivativeSettings derivative settings
+         * @return bool false, leaving the settings untouched, if tuning is not complete
+         */
+        virtual bool getTunedSettings(uint8_t rule, Base::ControlSettings &proportional, IntegralSettings &integral,
+                                      DerivativeSettings &derivative) const {
+            if(!isComplete()) {
+                return false;
+            }
+            return RelayAutotuneStateless::computeSettings(getUltimateGain(), getUltimatePeriod(), rule,
+                                                          proportional, integral, derivative);
+        }
+
+    private:
+        // The stored settings
+        RelayAutotuneSettings settings_;
+
+        // Contains all required state info
+        RelayAutotuneOutput state_;
+
+        // Used for the internal call with state
+        RelayAutotuneInput input_with_state_;
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_H
@@ -0,0 +1,66 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Input for relay feedback autotuning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_INPUT_H
+#define CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_INPUT_H
+
+#include <base/controlInput.h>
+#include <pid/relayAutotuneState.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class RelayAutotuneInput: public Base::ControlInput {
+    public:
+        RelayAutotuneInput () {};
+        virtual ~RelayAutotuneInput() {};
+
+        /**
+         * Copy in
+         * @param right [in]: RelayAutotuneInput input
+         */
+        void copy(const RelayAutotuneInput &right) {
+            // Super call
+            Base::ControlInput::copy(right);
+
+            setState(right.getState());
+        }
+
+        void setState(const RelayAutotuneState &state) { state_.copy(state); }
+        const RelayAutotuneState &getState() const { return state_; }
+
+    private:
+        // The tuning state from the last update
+        RelayAutotuneState state_;
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_INPUT_H
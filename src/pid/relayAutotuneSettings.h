@@ -0,0 +1,96 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for relay feedback autotuning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_SETTINGS_H
+#define CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_SETTINGS_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+// Tuning rules used to turn the ultimate gain and period into controller settings
+const uint8_t TUNING_ZIEGLER_NICHOLS = 0;
+const uint8_t TUNING_TYREUS_LUYBEN = 1;
+
+class RelayAutotuneSettings {
+    public:
+        RelayAutotuneSettings () {};
+        virtual ~RelayAutotuneSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: RelayAutotuneSettings input control settings
+         */
+        void copy(const RelayAutotuneSettings &right) {
+            setAmplitude(right.getAmplitude());
+            setBias(right.getBias());
+            setHysteresis(right.getHysteresis());
+            setSettleCycles(right.getSettleCycles());
+            setMeasureCycles(right.getMeasureCycles());
+            setTolerance(right.getTolerance());
+        }
+
+        void setAmplitude(float amplitude) { amplitude_ = amplitude; }
+        float getAmplitude() const { return amplitude_; }
+        void setBias(float bias) { bias_ = bias; }
+        float getBias() const { return bias_; }
+        void setHysteresis(float hysteresis) { hysteresis_ = hysteresis; }
+        float getHysteresis() const { return hysteresis_; }
+        void setSettleCycles(uint8_t settle_cycles) { settle_cycles_ = settle_cycles; }
+        uint8_t getSettleCycles() const { return settle_cycles_; }
+        void setMeasureCycles(uint8_t measure_cycles) { measure_cycles_ = measure_cycles; }
+        uint8_t getMeasureCycles() const { return measure_cycles_; }
+        void setTolerance(float tolerance) { tolerance_ = tolerance; }
+        float getTolerance() const { return tolerance_; }
+
+    private:
+        // Relay output is bias +/- amplitude. The sign follows the loop: use the sign the loop's gains will have.
+        float amplitude_{1.0};
+
+        // Control signal the relay oscillates around
+        float bias_{0.0};
+
+        // Error band the relay ignores, to keep noise from switching it
+        float hysteresis_{0.0};
+
+        // Oscillation cycles always ignored while the loop settles into a limit cycle
+        uint8_t settle_cycles_{2};
+
+        // Consecutive settled cycles averaged into the estimate
+        uint8_t measure_cycles_{4};
+
+        // Relative change in period and amplitude from the previous cycle for a cycle to count as settled
+        float tolerance_{0.05};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_SETTINGS_H
@@ -0,0 +1,116 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * State carried between relay feedback autotuning updates. Fixed size, independent of how long tuning runs.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_STATE_H
+#define CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_STATE_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class RelayAutotuneState {
+    public:
+        RelayAutotuneState () {};
+        virtual ~RelayAutotuneState() {};
+
+        /**
+         * Copy in
+         * @param right [in]: RelayAutotuneState input
+         */
+        void copy(const RelayAutotuneState &right) {
+            setRelayHigh(right.getRelayHigh());
+            setRisen(right.getRisen());
+            setTimeSinceRise(right.getTimeSinceRise());
+            setCycleMax(right.getCycleMax());
+            setCycleMin(right.getCycleMin());
+            setCycles(right.getCycles());
+            setMeasured(right.getMeasured());
+            setPreviousHalfSwing(right.getPreviousHalfSwing());
+            setPreviousPeriod(right.getPreviousPeriod());
+            setUltimateGain(right.getUltimateGain());
+            setUltimatePeriod(right.getUltimatePeriod());
+        }
+
+        void setRelayHigh(bool relay_high) { relay_high_ = relay_high; }
+        bool getRelayHigh() const { return relay_high_; }
+        void setRisen(bool risen) { risen_ = risen; }
+        bool getRisen() const { return risen_; }
+        void setTimeSinceRise(float time_since_rise) { time_since_rise_ = time_since_rise; }
+        float getTimeSinceRise() const { return time_since_rise_; }
+        void setCycleMax(float cycle_max) { cycle_max_ = cycle_max; }
+        float getCycleMax() const { return cycle_max_; }
+        void setCycleMin(float cycle_min) { cycle_min_ = cycle_min; }
+        float getCycleMin() const { return cycle_min_; }
+        void setCycles(uint16_t cycles) { cycles_ = cycles; }
+        uint16_t getCycles() const { return cycles_; }
+        void setMeasured(uint16_t measured) { measured_ = measured; }
+        uint16_t getMeasured() const { return measured_; }
+        void setPreviousHalfSwing(float previous_half_swing) { previous_half_swing_ = previous_half_swing; }
+        float getPreviousHalfSwing() const { return previous_half_swing_; }
+        void setPreviousPeriod(float previous_period) { previous_period_ = previous_period; }
+        float getPreviousPeriod() const { return previous_period_; }
+        void setUltimateGain(float ultimate_gain) { ultimate_gain_ = ultimate_gain; }
+        float getUltimateGain() const { return ultimate_gain_; }
+        void setUltimatePeriod(float ultimate_period) { ultimate_period_ = ultimate_period; }
+        float getUltimatePeriod() const { return ultimate_period_; }
+
+    private:
+        // Whether the relay is currently at bias + amplitude
+        bool relay_high_{true};
+
+        // Whether the relay has switched to high yet, i.e. whether a cycle is being timed
+        bool risen_{false};
+
+        // Time since the last switch to high. Kept relative so precision does not degrade the longer tuning runs.
+        float time_since_rise_{0.0};
+
+        // Error extremes within the current cycle
+        float cycle_max_{0.0};
+        float cycle_min_{0.0};
+
+        // Completed oscillation cycles, settling cycles included
+        uint16_t cycles_{0};
+
+        // Consecutive settled cycles in the running means
+        uint16_t measured_{0};
+
+        // Half the peak to peak error and the period of the last cycle, to tell when the limit cycle has settled
+        float previous_half_swing_{0.0};
+        float previous_period_{0.0};
+
+        // Running means of the ultimate gain and period over the measured cycles
+        float ultimate_gain_{0.0};
+        float ultimate_period_{0.0};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_STATE_H
@@ -0,0 +1,128 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of relay feedback autotuning
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "relayAutotuneStateless.h"
+#include <math.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+void RelayAutotuneStateless::update(const RelayAutotuneInput &input, const RelayAutotuneSettings &settings, RelayAutotuneOutput &out) {
+    RelayAutotuneState &state = out.getState();
+    state.copy(input.getState());
+
+    float error = input.getError();
+    float hysteresis = settings.getHysteresis();
+    state.setTimeSinceRise(state.getTimeSinceRise() + input.getDeltaT());
+    if(error > state.getCycleMax()) {
+        state.setCycleMax(error);
+    }
+    if(error < state.getCycleMin()) {
+        state.setCycleMin(error);
+    }
+
+    if(state.getRelayHigh()) {
+        if(error < -hysteresis) {
+            state.setRelayHigh(false);
+        }
+    } else if(error > hysteresis) {
+        state.setRelayHigh(true);
+
+        // A switch to high closes the cycle started by the previous one. The estimate is frozen once complete.
+        if(state.getRisen() && state.getMeasured() < settings.getMeasureCycles()) {
+            float half_swing = 0.5f * (state.getCycleMax() - state.getCycleMin());
+            float period = state.getTimeSinceRise();
+            float tolerance = settings.getTolerance();
+            bool settled = state.getCycles() >= settings.getSettleCycles() &&
+                           fabsf(period - state.getPreviousPeriod()) <= tolerance * state.getPreviousPeriod() &&
+                           fabsf(half_swing - state.getPreviousHalfSwing()) <= tolerance * state.getPreviousHalfSwing();
+            state.setCycles(state.getCycles() + 1);
+            state.setPreviousHalfSwing(half_swing);
+            state.setPreviousPeriod(period);
+
+            // Describing function of a relay with hysteresis: Ku = 4d / (pi * sqrt(a^2 - h^2))
+            float radicand = half_swing * half_swing - hysteresis * hysteresis;
+            if(settled && radicand > 0.0f) {
+                // Running means, so no cycle history is kept
+                uint16_t measured = state.getMeasured() + 1;
+                state.setMeasured(measured);
+                float ultimate_gain = 4.0f * settings.getAmplitude() / (static_cast<float>(M_PI) * sqrtf(radicand));
+                state.setUltimateGain(state.getUltimateGain() +
+                                      (ultimate_gain - state.getUltimateGain()) / static_cast<float>(measured));
+                state.setUltimatePeriod(state.getUltimatePeriod() +
+                                        (period - state.getUltimatePeriod()) / static_cast<float>(measured));
+            } else {
+                // Still converging, so restart the means
+                state.setMeasured(0);
+                state.setUltimateGain(0.0f);
+                state.setUltimatePeriod(0.0f);
+            }
+        }
+        state.setRisen(true);
+        state.setTimeSinceRise(0.0f);
+        state.setCycleMax(error);
+        state.setCycleMin(error);
+    }
+
+    out.setComplete(settings.getMeasureCycles() > 0 && state.getMeasured() >= settings.getMeasureCycles());
+    out.setControl(settings.getBias() + (state.getRelayHigh() ? settings.getAmplitude() : -settings.getAmplitude()));
+}
+
+bool RelayAutotuneStateless::computeSettings(float ultimate_gain, float ultimate_period, uint8_t rule,
+                                             Base::ControlSettings &proportional, IntegralSettings &integral,
+                                             DerivativeSettings &derivative) {
+    if(ultimate_gain == 0.0f || !isfinite(ultimate_gain) || !(ultimate_period > 0.0f) || !isfinite(ultimate_period)) {
+        return false;
+    }
+
+    float gain;
+    float integral_time;
+    float derivative_time;
+    if(rule == TUNING_ZIEGLER_NICHOLS) {
+        gain = 0.6f * ultimate_gain;
+        integral_time = 0.5f * ultimate_period;
+        derivative_time = 0.125f * ultimate_period;
+    } else if(rule == TUNING_TYREUS_LUYBEN) {
+        gain = ultimate_gain / 2.2f;
+        integral_time = 2.2f * ultimate_period;
+        derivative_time = ultimate_period / 6.3f;
+    } else {
+        return false;
+    }
+
+    // The terms are summed in parallel, so the time constants fold into the gains
+    proportional.setGain(gain);
+    integral.setGain(gain / integral_time);
+    derivative.setGain(gain * derivative_time);
+    return true;
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
@@ -0,0 +1,80 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless relay feedback (Astrom-Hagglund) autotuning. The loop is driven by a relay, which makes most plants
+ * settle into a limit cycle; the ultimate gain and period are estimated from it one sample at a time and turned
+ * into proportional, integral and derivative settings.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_STATELESS_H
+#define CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_STATELESS_H
+
+#include <stdint.h>
+#include <base/controlSettings.h>
+#include <pid/derivativeSettings.h>
+#include <pid/integralSettings.h>
+#include <pid/relayAutotuneInput.h>
+#include <pid/relayAutotuneOutput.h>
+#include <pid/relayAutotuneSettings.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class RelayAutotuneStateless {
+    public:
+        /**
+         * Advance the relay by one sample. The control signal is the relay output; a cycle runs between successive
+         * switches to high and is averaged into the estimate once its period and peak to peak error agree with the
+         * previous cycle's, i.e. once the limit cycle has settled.
+         * @param input [in]: RelayAutotuneInput error, time step and the state from the last update
+         * @param settings [in]: RelayAutotuneSettings the relay settings
+         * @param out [out]: RelayAutotuneOutput the relay output, the updated state and whether tuning is complete
+         */
+        static void update(const RelayAutotuneInput &input, const RelayAutotuneSettings &settings, RelayAutotuneOutput &out);
+
+        /**
+         * Set the controller gains from the ultimate gain and period. Only the gains are written, so limits and
+         * time steps already in the settings are kept.
+         * @param ultimate_gain [in]: float ultimate gain, with the sign of the relay amplitude
+         * @param ultimate_period [in]: float ultimate period, in the units of the time step
+         * @param rule [in]: uint8_t TUNING_ZIEGLER_NICHOLS or TUNING_TYREUS_LUYBEN
+         * @param proportional [in/out]: Base::ControlSettings proportional settings
+         * @param integral [in/out]: IntegralSettings integral settings
+         * @param derivative [in/out]: DerivativeSettings derivative settings
+         * @return bool false, leaving the settings untouched, if the estimate or rule is invalid
+         */
+        static bool computeSettings(float ultimate_gain, float ultimate_period, uint8_t rule,
+                                    Base::ControlSettings &proportional, IntegralSettings &integral,
+                                    DerivativeSettings &derivative);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        RelayAutotuneStateless() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_RELAY_AUTOTUNE_STATELESS_H
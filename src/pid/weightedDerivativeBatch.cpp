@@ -0,0 +1,66 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched implementation of setpoint weighted derivative control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "weightedDerivativeBatch.h"
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// The arrays of one call must not overlap. __restrict lets the loops vectorize without runtime alias checks.
+void WeightedDerivativeBatch::update(const float *__restrict setpoint, const float *__restrict measurement,
+                                     const float *__restrict delta_t, const float *__restrict weight,
+                                     const float *__restrict gain, const float *__restrict min_time_step,
+                                     float *__restrict previous_error, float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        float weighted_error = Kernels::weightedError(setpoint[i], measurement[i], weight[i]);
+
+        // Calculate the control signal
+        control[i] = Kernels::derivative(weighted_error, previous_error[i], delta_t[i], min_time_step[i], gain[i]);
+
+        // Save the previous weighted error
+        previous_error[i] = weighted_error;
+    }
+}
+
+void WeightedDerivativeBatch::updateIndexed(const uint32_t *__restrict loops, const float *__restrict setpoint,
+                                            const float *__restrict measurement, const float *__restrict delta_t,
+                                            const float *__restrict weight, const float *__restrict gain,
+                                            const float *__restrict min_time_step, float *__restrict previous_error,
+                                            float *__restrict control, size_t count) {
+    for(size_t i = 0; i < count; ++i) {
+        uint32_t loop = loops[i];
+        update(&setpoint[i], &measurement[i], &delta_t[i], &weight[loop], &gain[loop], &min_time_step[loop],
+               &previous_error[loop], &control[loop], 1);
+    }
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
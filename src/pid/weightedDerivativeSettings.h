@@ -0,0 +1,65 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Settings used for a setpoint weighted (2-DOF) derivative controller
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_WEIGHTED_DERIVATIVE_SETTINGS_H
+#define CONTROLALGORITHMS_PID_WEIGHTED_DERIVATIVE_SETTINGS_H
+
+#include <pid/derivativeSettings.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class WeightedDerivativeSettings : public DerivativeSettings {
+    public:
+        WeightedDerivativeSettings () {};
+        virtual ~WeightedDerivativeSettings() {};
+
+        /**
+         * Copy in
+         * @param right [in]: WeightedDerivativeSettings input control settings
+         */
+        void copy(const WeightedDerivativeSettings &right) {
+            // Call super class
+            DerivativeSettings::copy(right);
+
+            setSetpointWeight(right.getSetpointWeight());
+        }
+
+        void setSetpointWeight(float setpoint_weight) { setpoint_weight_ = setpoint_weight; }
+        float getSetpointWeight() const { return setpoint_weight_; }
+
+    private:
+        // Setpoint weight c; zero is derivative on measurement, which avoids the kick on setpoint steps
+        float setpoint_weight_{0.0};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_WEIGHTED_DERIVATIVE_SETTINGS_H
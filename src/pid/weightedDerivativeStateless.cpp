@@ -0,0 +1,52 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of setpoint weighted derivative control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "weightedDerivativeStateless.h"
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// Compile time check of the kernel: with a zero weight a setpoint step leaves the weighted error unchanged
+static_assert(Kernels::weightedError(5.0f, 1.0f, 0.0f) == Kernels::weightedError(0.0f, 1.0f, 0.0f), "no derivative kick");
+
+void WeightedDerivativeStateless::update(const WeightedDerivativeInput &input, const WeightedDerivativeSettings &settings, DerivativeOutput &out) {
+    float weighted_error = Kernels::weightedError(input.getSetpoint(), input.getMeasurement(), settings.getSetpointWeight());
+
+    // Save the previous weighted error
+    out.setPreviousError(weighted_error);
+
+    // Calculate and return the control signal
+    out.setControl(Kernels::derivative(weighted_error, input.getPreviousError(), input.getDeltaT(),
+                                       settings.getMinTimeStep(), settings.getGain()));
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
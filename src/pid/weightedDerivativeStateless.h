@@ -0,0 +1,58 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless setpoint weighted (2-DOF) derivative control: the derivative of c * setpoint - measurement. With the
+ * default c of zero, setpoint steps cause no derivative kick. Uses Kernels::weightedError and Kernels::derivative.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_WEIGHTED_DERIVATIVE_STATELESS_H
+#define CONTROLALGORITHMS_PID_WEIGHTED_DERIVATIVE_STATELESS_H
+
+#include <pid/derivativeOutput.h>
+#include <pid/weightedDerivativeInput.h>
+#include <pid/weightedDerivativeSettings.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class WeightedDerivativeStateless {
+    public:
+        /**
+         * The calculate function for the weighted derivative controller
+         * @param input [in]: WeightedDerivativeInput setpoint, measurement, time step and previous weighted error
+         * @param settings [in]: WeightedDerivativeSettings the controller settings
+         * @param out [out]: DerivativeOutput the output signal and the weighted error for the next call
+         */
+        static void update(const WeightedDerivativeInput &input, const WeightedDerivativeSettings &settings, DerivativeOutput &out);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        WeightedDerivativeStateless() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_WEIGHTED_DERIVATIVE_STATELESS_H
@@ -0,0 +1,73 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Batched (structure of arrays) version of setpoint weighted proportional control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_WEIGHTED_PROPORTIONAL_BATCH_H
+#define CONTROLALGORITHMS_PID_WEIGHTED_PROPORTIONAL_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class WeightedProportionalBatch {
+    public:
+        /**
+         * The calculate function for many independent weighted proportional controllers. Element i of every array belongs to loop i.
+         * @param setpoint [in]: float[count] setpoints
+         * @param measurement [in]: float[count] measured values
+         * @param feed_forward [in]: float[count] precomputed feed-forward terms
+         * @param weight [in]: float[count] setpoint weights b
+         * @param gain [in]: float[count] controller gains
+         * @param control [out]: float[count] control signals
+         * @param count [in]: size_t number of loops
+         */
+        static void update(const float *setpoint, const float *measurement, const float *feed_forward, const float *weight,
+                           const float *gain, float *control, size_t count);
+
+        /**
+         * The calculate function for a scattered subset of loops
+         * @param loops [in]: uint32_t[count] loop index of each sample
+         * @param setpoint [in]: float[count] setpoint of each sample
+         * @param measurement [in]: float[count] measured value of each sample
+         * @param feed_forward [in]: float[count] feed-forward term of each sample
+         * Remaining parameters are indexed by loop, as in update.
+         */
+        static void updateIndexed(const uint32_t *loops, const float *setpoint, const float *measurement,
+                                  const float *feed_forward, const float *weight, const float *gain, float *control,
+                                  size_t count);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        WeightedProportionalBatch() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_WEIGHTED_PROPORTIONAL_BATCH_H
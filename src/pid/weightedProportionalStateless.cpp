@@ -0,0 +1,48 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless implementation of setpoint weighted proportional control
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "weightedProportionalStateless.h"
+#include <pid/pidKernels.h>
+
+namespace ControlAlgorithms {
+
+namespace PID {
+
+// Compile time checks of the kernel: a weight of one is the plain proportional term, zero ignores the setpoint
+static_assert(Kernels::weightedProportional(3.0f, 1.0f, 1.0f, 0.5f, 0.0f) == Kernels::proportional(2.0f, 0.5f),
+              "unit weight matches proportional");
+static_assert(Kernels::weightedProportional(3.0f, 1.0f, 0.0f, 0.5f, 0.25f) == -0.25f, "zero weight with feed-forward");
+
+void WeightedProportionalStateless::update(const Base::SetpointInput &input, const WeightedProportionalSettings &settings, Base::ControlOutput &out) {
+    out.setControl(Kernels::weightedProportional(input.getSetpoint(), input.getMeasurement(), settings.getSetpointWeight(),
+                                                 settings.getGain(), input.getFeedForward()));
+}
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
@@ -0,0 +1,58 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Stateless setpoint weighted (2-DOF) proportional control: gain * (b * setpoint - measurement) + feed-forward.
+ * Wraps Kernels::weightedProportional from pidKernels.h.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_PID_WEIGHTED_PROPORTIONAL_STATELESS_H
+#define CONTROLALGORITHMS_PID_WEIGHTED_PROPORTIONAL_STATELESS_H
+
+#include <base/setpointInput.h>
+#include <base/controlOutput.h>
+#include <pid/weightedProportionalSettings.h>
+
+namespace ControlAlgorithms {
+namespace PID {
+
+class WeightedProportionalStateless {
+    public:
+        /**
+         * The calculate function for the weighted proportional controller
+         * @param input [in]: Base::SetpointInput setpoint, measurement and feed-forward term
+         * @param settings [in]: WeightedProportionalSettings the controller settings
+         * @param out [out]: Base::ControlOutput the output signal
+         */
+        static void update(const Base::SetpointInput &input, const WeightedProportionalSettings &settings, Base::ControlOutput &out);
+    private:
+        // Private constructor to ensure only the static/stateless functions are used.
+        WeightedProportionalStateless() {};
+};
+
+}  // namespace PID
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_PID_WEIGHTED_PROPORTIONAL_STATELESS_H
@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Adapts a bank to a rate group task: each tick the group's time step is given to every loop and the bank is
+ * updated as one batch from the error array.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_SCHEDULE_BANK_TASK_H
+#define CONTROLALGORITHMS_SCHEDULE_BANK_TASK_H
+
+#include <stddef.h>
+
+namespace ControlAlgorithms {
+namespace Schedule {
+
+template<typename Bank, size_t Loops>
+class BankTask {
+    public:
+        /**
+         * @param bank [in]: Bank bank to update, e.g. PID::IntegralBank<Loops>
+         * @param error [in]: const float* error for each of the Loops loops, read each tick
+         */
+        BankTask(Bank &bank, const float *error): bank_(bank), error_(error) {};
+        virtual ~BankTask() {};
+
+        void setError(const float *error) { error_ = error; }
+        const float *getError() const { return error_; }
+
+        /**
+         * Task entry point; pass the BankTask as the context
+         * @param context [in]: void* the BankTask
+         * @param delta_t [in]: float the group's time step
+         */
+        static void run(void *context, float delta_t) {
+            BankTask *task = static_cast<BankTask *>(context);
+            for(size_t loop = 0; loop < Loops; ++loop) {
+                task->delta_t_[loop] = delta_t;
+            }
+            task->bank_.update(task->error_, task->delta_t_, Loops);
+        }
+
+    private:
+        // The bank and its input
+        Bank &bank_;
+        const float *error_;
+
+        // The group's time step for every loop
+        float delta_t_[Loops]{};
+};
+
+}  // namespace Schedule
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_SCHEDULE_BANK_TASK_H
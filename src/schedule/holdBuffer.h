@@ -0,0 +1,98 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Lock-free triple buffer for passing a signal from one rate group to another. The writer fills a buffer in place
+ * and publishes it; the reader always sees the latest complete value in place. Neither side copies or waits, so a
+ * slow reader never holds up a fast writer and vice versa. One writer and one reader only.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_SCHEDULE_HOLD_BUFFER_H
+#define CONTROLALGORITHMS_SCHEDULE_HOLD_BUFFER_H
+
+#include <stdint.h>
+#include <atomic>
+
+namespace ControlAlgorithms {
+namespace Schedule {
+
+template<typename T>
+class HoldBuffer {
+    public:
+        HoldBuffer() {};
+        virtual ~HoldBuffer() {};
+
+        /**
+         * Buffer for the writer to fill. It holds an older value, so every field must be written before publish.
+         * @return T& the writer's buffer
+         */
+        T &write() { return buffers_[write_]; }
+
+        /**
+         * Make the writer's buffer the latest value and take a free buffer for the next write
+         */
+        void publish() {
+            write_ = middle_.exchange(write_ | FRESH, std::memory_order_acq_rel) & INDEX;
+        }
+
+        /**
+         * Latest published value. Stays valid and unchanged until the next call to read.
+         * @return const T& the reader's buffer
+         */
+        const T &read() {
+            if(middle_.load(std::memory_order_relaxed) & FRESH) {
+                read_ = middle_.exchange(read_, std::memory_order_acq_rel) & INDEX;
+            }
+            return buffers_[read_];
+        }
+
+        /**
+         * Whether a value has been published since the last read
+         * @return bool true if read will return a new value
+         */
+        bool isFresh() const { return (middle_.load(std::memory_order_relaxed) & FRESH) != 0; }
+
+    private:
+        // Index bits of middle_, and the flag marking it as published but not yet read
+        static const uint8_t INDEX = 0x03;
+        static const uint8_t FRESH = 0x04;
+
+        // The three buffers; at any time one each belongs to the writer, the reader and the exchange
+        T buffers_[3]{};
+
+        // Owned by the writer
+        uint8_t write_{0};
+
+        // Owned by the reader
+        uint8_t read_{1};
+
+        // The buffer being handed over
+        std::atomic<uint8_t> middle_{2};
+};
+
+}  // namespace Schedule
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_SCHEDULE_HOLD_BUFFER_H
@@ -0,0 +1,175 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Runs rate groups at their own loop frequencies from a single polling thread, e.g. inner loops at 10 kHz and
+ * outer loops at 100 Hz. Due groups run in index order, so give the fastest group the lowest index. Signals
+ * between groups pass through Schedule::HoldBuffer.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_SCHEDULE_MULTI_RATE_SCHEDULER_H
+#define CONTROLALGORITHMS_SCHEDULE_MULTI_RATE_SCHEDULER_H
+
+#include <stdint.h>
+#include <ingest/monotonicClock.h>
+#include <schedule/rateGroup.h>
+
+namespace ControlAlgorithms {
+namespace Schedule {
+
+template<uint8_t Groups, uint8_t TasksPerGroup>
+class MultiRateScheduler {
+    public:
+        MultiRateScheduler() {};
+        virtual ~MultiRateScheduler() {};
+
+        /**
+         * Set a group's loop period. A started group is next released one new period from now.
+         * @param group [in]: uint8_t group index
+         * @param period_us [in]: uint32_t period in microseconds, zero disables the group
+         * @return bool false if the group is out of range
+         */
+        bool setPeriodMicros(uint8_t group, uint32_t period_us) {
+            return setPeriodMicrosAt(group, period_us, Ingest::MonotonicClock::nowMicros());
+        }
+
+        /**
+         * As setPeriodMicros, with the current time supplied by the caller
+         * @param group [in]: uint8_t group index
+         * @param period_us [in]: uint32_t period in microseconds, zero disables the group
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         * @return bool false if the group is out of range
+         */
+        bool setPeriodMicrosAt(uint8_t group, uint32_t period_us, uint32_t now_us) {
+            if(group >= Groups) {
+                return false;
+            }
+            groups_[group].setPeriodMicros(period_us, now_us);
+            return true;
+        }
+
+        /**
+         * Add a task to a group
+         * @param group [in]: uint8_t group index
+         * @param task [in]: Task function to run each tick
+         * @param context [in]: void* passed to the task
+         * @return bool false if the group is out of range or full
+         */
+        bool addTask(uint8_t group, Task task, void *context) {
+            return group < Groups && groups_[group].addTask(task, context);
+        }
+
+        /**
+         * Start all groups from the same instant
+         */
+        void start() { startAt(Ingest::MonotonicClock::nowMicros()); }
+
+        /**
+         * As start, with the current time supplied by the caller
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         */
+        void startAt(uint32_t now_us) {
+            for(uint8_t group = 0; group < Groups; ++group) {
+                groups_[group].start(now_us);
+            }
+        }
+
+        /**
+         * Run every group that is due. Call as often as possible, or sleep until getNextReleaseMicros.
+         * @return uint8_t number of groups run
+         */
+        uint8_t poll() { return pollAt(Ingest::MonotonicClock::nowMicros()); }
+
+        /**
+         * As poll, with the current time supplied by the caller, e.g. from a simulated clock
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         * @return uint8_t number of groups run
+         */
+        uint8_t pollAt(uint32_t now_us) {
+            uint8_t ran = 0;
+            for(uint8_t group = 0; group < Groups; ++group) {
+                if(groups_[group].isDue(now_us)) {
+                    groups_[group].run(now_us);
+                    ++ran;
+                }
+            }
+            return ran;
+        }
+
+        /**
+         * Earliest release over the enabled groups
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         * @return uint32_t time of the next release, now_us if nothing is scheduled
+         */
+        uint32_t getNextReleaseMicros(uint32_t now_us) const {
+            bool found = false;
+            int32_t earliest = 0;
+            for(uint8_t group = 0; group < Groups; ++group) {
+                if(!groups_[group].isStarted() || groups_[group].getPeriodMicros() == 0) {
+                    continue;
+                }
+                int32_t until = (int32_t)(groups_[group].getNextReleaseMicros() - now_us);
+                if(!found || until < earliest) {
+                    earliest = until;
+                    found = true;
+                }
+            }
+            return now_us + (uint32_t)earliest;
+        }
+
+        /**
+         * Missed deadlines over all groups
+         * @return uint32_t total releases skipped
+         */
+        uint32_t getMissedDeadlines() const {
+            uint32_t missed = 0;
+            for(uint8_t group = 0; group < Groups; ++group) {
+                missed += groups_[group].getMissedDeadlines();
+            }
+            return missed;
+        }
+
+        /**
+         * Clear the statistics counters of every group
+         */
+        void resetStatistics() {
+            for(uint8_t group = 0; group < Groups; ++group) {
+                groups_[group].resetStatistics();
+            }
+        }
+
+        // Direct access to a group, e.g. for its statistics
+        RateGroup<TasksPerGroup> &getGroup(uint8_t group) { return groups_[group]; }
+        const RateGroup<TasksPerGroup> &getGroup(uint8_t group) const { return groups_[group]; }
+        uint8_t getGroupCount() const { return Groups; }
+
+    private:
+        RateGroup<TasksPerGroup> groups_[Groups];
+};
+
+}  // namespace Schedule
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_SCHEDULE_MULTI_RATE_SCHEDULER_H
@@ -0,0 +1,181 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Controllers run at one loop rate. Each tick the group computes the time step since its last run and passes it
+ * to its tasks in order, e.g. bank updates through Schedule::BankTask. Releases that pass without the group
+ * running are counted as missed deadlines.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_SCHEDULE_RATE_GROUP_H
+#define CONTROLALGORITHMS_SCHEDULE_RATE_GROUP_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Schedule {
+
+// Work run on a group's tick. delta_t is in seconds.
+typedef void (*Task)(void *context, float delta_t);
+
+template<uint8_t MaxTasks>
+class RateGroup {
+    public:
+        RateGroup() {};
+        virtual ~RateGroup() {};
+
+        /**
+         * Set the loop period. A started group's next release moves to one new period from now, so a release
+         * scheduled under the old period is neither waited for nor counted as missed. A group that was disabled
+         * also restarts its time step from now.
+         * @param period_us [in]: uint32_t period in microseconds, zero disables the group
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         */
+        void setPeriodMicros(uint32_t period_us, uint32_t now_us) {
+            if(started_) {
+                if(period_us_ == 0) {
+                    last_run_us_ = now_us;
+                }
+                next_release_us_ = now_us + period_us;
+            }
+            period_us_ = period_us;
+        }
+        uint32_t getPeriodMicros() const { return period_us_; }
+
+        /**
+         * Add a task to the end of the group
+         * @param task [in]: Task function to run each tick
+         * @param context [in]: void* passed to the task
+         * @return bool false if the group is full or the task is null
+         */
+        bool addTask(Task task, void *context) {
+            if(task == nullptr || task_count_ >= MaxTasks) {
+                return false;
+            }
+            tasks_[task_count_] = task;
+            contexts_[task_count_] = context;
+            ++task_count_;
+            return true;
+        }
+
+        /**
+         * Remove all tasks
+         */
+        void clearTasks() { task_count_ = 0; }
+        uint8_t getTaskCount() const { return task_count_; }
+
+        /**
+         * Start the clock. The first tick is one period later.
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         */
+        void start(uint32_t now_us) {
+            last_run_us_ = now_us;
+            next_release_us_ = now_us + period_us_;
+            started_ = true;
+        }
+
+        bool isStarted() const { return started_; }
+
+        /**
+         * Whether the group should run
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         * @return bool true once the next release time has been reached
+         */
+        bool isDue(uint32_t now_us) const {
+            return started_ && period_us_ > 0 && (int32_t)(now_us - next_release_us_) >= 0;
+        }
+
+        uint32_t getNextReleaseMicros() const { return next_release_us_; }
+
+        /**
+         * Run the tasks with the time since the last run and schedule the next release. Releases that have already
+         * passed are skipped rather than run back to back, and are counted as missed. A call before the release
+         * moves the release on by one period. A disabled group has no releases, so running it directly only runs
+         * the tasks.
+         * @param now_us [in]: uint32_t current monotonic time in microseconds
+         */
+        void run(uint32_t now_us) {
+            if(period_us_ > 0) {
+                // A direct call before the release is not late
+                int32_t lateness = (int32_t)(now_us - next_release_us_);
+                uint32_t missed = 0;
+                if(lateness > 0) {
+                    missed = (uint32_t)lateness / period_us_;
+                    if((uint32_t)lateness > max_lateness_us_) {
+                        max_lateness_us_ = (uint32_t)lateness;
+                    }
+                }
+                missed_deadlines_ += missed;
+                next_release_us_ += (missed + 1) * period_us_;
+            }
+
+            float delta_t = (float)(now_us - last_run_us_) * 1.0e-6f;
+            last_run_us_ = now_us;
+            for(uint8_t task = 0; task < task_count_; ++task) {
+                tasks_[task](contexts_[task], delta_t);
+            }
+            ++runs_;
+        }
+
+        /**
+         * Clear the statistics counters
+         */
+        void resetStatistics() {
+            runs_ = 0;
+            missed_deadlines_ = 0;
+            max_lateness_us_ = 0;
+        }
+
+        // Ticks run
+        uint32_t getRuns() const { return runs_; }
+        // Releases skipped because the group ran too late
+        uint32_t getMissedDeadlines() const { return missed_deadlines_; }
+        // Longest time from a release to the group running
+        uint32_t getMaxLatenessMicros() const { return max_lateness_us_; }
+
+    private:
+        // Loop period
+        uint32_t period_us_{0};
+
+        // The tasks and their contexts, run in order
+        Task tasks_[MaxTasks]{};
+        void *contexts_[MaxTasks]{};
+        uint8_t task_count_{0};
+
+        // Clock
+        bool started_{false};
+        uint32_t last_run_us_{0};
+        uint32_t next_release_us_{0};
+
+        // Statistics
+        uint32_t runs_{0};
+        uint32_t missed_deadlines_{0};
+        uint32_t max_lateness_us_{0};
+};
+
+}  // namespace Schedule
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_SCHEDULE_RATE_GROUP_H
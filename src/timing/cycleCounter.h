@@ -0,0 +1,91 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Cycle accurate timestamps for timing measurements. Uses the CPU cycle counter where one is available
+ * (ESP32, x86, AArch64) and falls back to a microsecond or nanosecond clock elsewhere.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_TIMING_CYCLE_COUNTER_H
+#define CONTROLALGORITHMS_TIMING_CYCLE_COUNTER_H
+
+#include <stdint.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <chrono>
+#endif
+
+namespace ControlAlgorithms {
+namespace Timing {
+
+class CycleCounter {
+    public:
+        /**
+         * Current counter value. Only differences are meaningful; they wrap at 2^32.
+         * @return uint32_t cycles (or microseconds/nanoseconds on the fallback clocks)
+         */
+        static inline uint32_t now() {
+#if defined(ARDUINO_ARCH_ESP32)
+            return (uint32_t)ESP.getCycleCount();
+#elif defined(ARDUINO)
+            return (uint32_t)micros();
+#elif defined(__x86_64__) || defined(__i386__)
+            return (uint32_t)__rdtsc();
+#elif defined(__aarch64__)
+            uint64_t ticks;
+            asm volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks));
+            return (uint32_t)ticks;
+#else
+            return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+
+        /**
+         * @return const char* unit of the values returned by now()
+         */
+        static const char *unit() {
+#if defined(ARDUINO_ARCH_ESP32) || defined(__x86_64__) || defined(__i386__)
+            return "cycles";
+#elif defined(ARDUINO)
+            return "us";
+#elif defined(__aarch64__)
+            return "ticks";
+#else
+            return "ns";
+#endif
+        }
+    private:
+        // Private constructor to ensure only the static functions are used.
+        CycleCounter() {};
+};
+
+}  // namespace Timing
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_TIMING_CYCLE_COUNTER_H
@@ -0,0 +1,182 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Linux implementation of the performance counters
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "perfCounters.h"
+
+#if defined(__linux__) && !defined(ARDUINO)
+#define CONTROLALGORITHMS_HAS_PERF_EVENT 1
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ControlAlgorithms {
+
+namespace Timing {
+
+#if defined(CONTROLALGORITHMS_HAS_PERF_EVENT)
+
+namespace {
+
+// Layout of a read with PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+struct ReadFormat {
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+};
+
+int openEvent(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // This thread, any CPU, no group
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+uint64_t cacheMiss(uint64_t cache) {
+    return cache | ((uint64_t)PERF_COUNT_HW_CACHE_OP_READ << 8) | ((uint64_t)PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+}  // namespace
+
+bool PerfCounters::open(uint64_t vector_event) {
+    close();
+    fd_[PERF_CYCLES] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fd_[PERF_INSTRUCTIONS] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fd_[PERF_L1D_MISSES] = openEvent(PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D));
+    fd_[PERF_LLC_MISSES] = openEvent(PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_LL));
+    fd_[PERF_BRANCH_MISSES] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    if(vector_event != 0) {
+        fd_[PERF_VECTOR_INSTRUCTIONS] = openEvent(PERF_TYPE_RAW, vector_event);
+    }
+    for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+        // Failures come back as -1 with errno set; anything negative is unavailable
+        if(fd_[counter] < 0) {
+            fd_[counter] = -1;
+        }
+    }
+    return isOpen();
+}
+
+void PerfCounters::close() {
+    for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+        if(fd_[counter] >= 0) {
+            ::close(fd_[counter]);
+        }
+        fd_[counter] = -1;
+    }
+}
+
+void PerfCounters::start() {
+    for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+        if(fd_[counter] >= 0) {
+            ioctl(fd_[counter], PERF_EVENT_IOC_RESET, 0);
+        }
+    }
+    // Enabled last and back to back, so the counters cover the same span as closely as separate events allow
+    for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+        if(fd_[counter] >= 0) {
+            ioctl(fd_[counter], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void PerfCounters::stop() {
+    for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+        if(fd_[counter] >= 0) {
+            ioctl(fd_[counter], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+}
+
+bool PerfCounters::read(PerfSample &sample) const {
+    sample.reset();
+    for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+        ReadFormat format;
+        if(fd_[counter] < 0 || ::read(fd_[counter], &format, sizeof(format)) != (ssize_t)sizeof(format) ||
+           format.time_running == 0) {
+            continue;
+        }
+        // More events than hardware counters are multiplexed; extrapolate to the enabled time
+        uint64_t value = format.value;
+        if(format.time_running < format.time_enabled) {
+            value = (uint64_t)((double)value * (double)format.time_enabled / (double)format.time_running);
+        }
+        sample.set(counter, value);
+    }
+    return isOpen();
+}
+
+#else
+
+bool PerfCounters::open(uint64_t) {
+    return false;
+}
+
+void PerfCounters::close() {
+}
+
+void PerfCounters::start() {
+}
+
+void PerfCounters::stop() {
+}
+
+bool PerfCounters::read(PerfSample &sample) const {
+    sample.reset();
+    return false;
+}
+
+#endif
+
+bool PerfCounters::isOpen() const {
+    for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+        if(fd_[counter] >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *PerfCounters::name(uint8_t counter) {
+    static const char *const names[PERF_COUNTERS] = {
+        "cycles", "instructions", "L1D misses", "LLC misses", "branch misses", "vector instructions"};
+    return counter < PERF_COUNTERS ? names[counter] : "";
+}
+
+}  // namespace Timing
+}  // namespace ControlAlgorithms
@@ -0,0 +1,151 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Hardware performance counters for benchmarks, read through Linux perf_event_open. They explain timings the
+ * cycle counter only reports: instructions per cycle, cache and branch misses and, where the PMU has a suitable
+ * event, vector instructions. Each counter is opened on its own for the calling thread, user space only, so
+ * counters the kernel or PMU does not offer, or that perf_event_paranoid forbids, are reported as unavailable
+ * without losing the rest. Elsewhere, including Arduino, open fails and benchmarks fall back to CycleCounter.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_TIMING_PERF_COUNTERS_H
+#define CONTROLALGORITHMS_TIMING_PERF_COUNTERS_H
+
+#include <stdint.h>
+
+namespace ControlAlgorithms {
+namespace Timing {
+
+// Counters, in PerfSample order
+const uint8_t PERF_CYCLES = 0;
+const uint8_t PERF_INSTRUCTIONS = 1;
+const uint8_t PERF_L1D_MISSES = 2;
+const uint8_t PERF_LLC_MISSES = 3;
+const uint8_t PERF_BRANCH_MISSES = 4;
+const uint8_t PERF_VECTOR_INSTRUCTIONS = 5;
+const uint8_t PERF_COUNTERS = 6;
+
+// Raw event for the vector counter on Intel cores since Skylake: FP_ARITH_INST_RETIRED with every packed width
+// selected. Vector events are model specific; pass 0 to PerfCounters::open to leave the counter unavailable.
+const uint64_t PERF_VECTOR_EVENT_INTEL = 0xFCC7;
+
+class PerfSample {
+    public:
+        PerfSample() {};
+        virtual ~PerfSample() {};
+
+        void reset() {
+            for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+                values_[counter] = 0;
+                valid_[counter] = false;
+            }
+        }
+
+        void set(uint8_t counter, uint64_t value) {
+            values_[counter] = value;
+            valid_[counter] = true;
+        }
+        uint64_t get(uint8_t counter) const { return values_[counter]; }
+        bool isValid(uint8_t counter) const { return valid_[counter]; }
+
+        /**
+         * Count per unit of work, e.g. per controller update
+         * @param counter [in]: uint8_t counter index
+         * @param units [in]: uint64_t units of work measured
+         * @return double count per unit, 0 if the counter is unavailable
+         */
+        double per(uint8_t counter, uint64_t units) const {
+            return valid_[counter] && units > 0 ? (double)values_[counter] / (double)units : 0.0;
+        }
+
+    private:
+        // Counts, scaled up when the kernel multiplexed the counter
+        uint64_t values_[PERF_COUNTERS]{};
+
+        // Whether each counter was running
+        bool valid_[PERF_COUNTERS]{};
+};
+
+class PerfCounters {
+    public:
+        PerfCounters() {
+            for(uint8_t counter = 0; counter < PERF_COUNTERS; ++counter) {
+                fd_[counter] = -1;
+            }
+        };
+        virtual ~PerfCounters() { close(); };
+
+        /**
+         * Open the counters for the calling thread, stopped
+         * @param vector_event [in]: uint64_t raw PMU event for PERF_VECTOR_INSTRUCTIONS, e.g.
+         *                           PERF_VECTOR_EVENT_INTEL, or 0 to leave it unavailable
+         * @return bool true if at least one counter opened
+         */
+        bool open(uint64_t vector_event = 0);
+
+        /**
+         * Close all counters
+         */
+        void close();
+
+        /**
+         * Zero and start the open counters
+         */
+        void start();
+
+        /**
+         * Stop the open counters
+         */
+        void stop();
+
+        /**
+         * Read the counts since start
+         * @param sample [out]: PerfSample receives the counts; unavailable counters are marked invalid
+         * @return bool false if no counter is open
+         */
+        bool read(PerfSample &sample) const;
+
+        bool isAvailable(uint8_t counter) const { return counter < PERF_COUNTERS && fd_[counter] >= 0; }
+        bool isOpen() const;
+
+        /**
+         * @return const char* short name of a counter, for reports
+         */
+        static const char *name(uint8_t counter);
+
+    private:
+        // Not copyable, the descriptors are owned
+        PerfCounters(const PerfCounters &);
+        PerfCounters &operator=(const PerfCounters &);
+
+        // One perf event descriptor per counter, -1 if unavailable
+        int fd_[PERF_COUNTERS];
+};
+
+}  // namespace Timing
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_TIMING_PERF_COUNTERS_H
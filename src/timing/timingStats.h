@@ -0,0 +1,141 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Fixed memory latency statistics. Samples go into a log-linear histogram (16 sub-buckets per power of two, so
+ * percentiles are within 1/16 of the true value) alongside the exact minimum, maximum and mean.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_TIMING_TIMING_STATS_H
+#define CONTROLALGORITHMS_TIMING_TIMING_STATS_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Timing {
+
+class TimingStats {
+    public:
+        TimingStats () { reset(); };
+        virtual ~TimingStats() {};
+
+        /**
+         * Clear all samples
+         */
+        void reset() {
+            memset(buckets_, 0, sizeof(buckets_));
+            count_ = 0;
+            sum_ = 0;
+            min_ = UINT32_MAX;
+            max_ = 0;
+        }
+
+        /**
+         * Add a sample
+         * @param value [in]: uint32_t the measured duration
+         */
+        void record(uint32_t value) {
+            ++buckets_[bucket(value)];
+            ++count_;
+            sum_ += value;
+            min_ = value < min_ ? value : min_;
+            max_ = value > max_ ? value : max_;
+        }
+
+        /**
+         * Value below which a fraction of the samples fall, e.g. 0.9999 for p99.99
+         * @param fraction [in]: float in [0, 1]
+         * @return uint32_t the upper bound of the bucket holding that sample, capped at the maximum
+         */
+        uint32_t percentile(float fraction) const {
+            if(count_ == 0) {
+                return 0;
+            }
+            uint64_t target = (uint64_t)((double)fraction * (double)count_ + 0.5);
+            target = target == 0 ? 1 : target;
+            uint64_t seen = 0;
+            for(uint32_t index = 0; index < BUCKETS; ++index) {
+                seen += buckets_[index];
+                if(seen >= target) {
+                    uint32_t upper = upperBound(index);
+                    return upper < max_ ? upper : max_;
+                }
+            }
+            return max_;
+        }
+
+        uint64_t getCount() const { return count_; }
+        uint32_t getMin() const { return count_ == 0 ? 0 : min_; }
+        uint32_t getMax() const { return max_; }
+        uint32_t getMean() const { return count_ == 0 ? 0 : (uint32_t)(sum_ / count_); }
+        // Spread between the fastest and slowest sample
+        uint32_t getJitter() const { return count_ == 0 ? 0 : max_ - min_; }
+
+    private:
+        // Values below 2^SUB_BITS get one bucket each; above, each power of two splits into 2^SUB_BITS buckets
+        static const uint32_t SUB_BITS = 4;
+        static const uint32_t SUB_BUCKETS = 1u << SUB_BITS;
+        static const uint32_t BUCKETS = (32 - SUB_BITS + 1) * SUB_BUCKETS;
+
+        static uint32_t highestBit(uint32_t value) {
+            uint32_t bit = 0;
+            while(value >>= 1) {
+                ++bit;
+            }
+            return bit;
+        }
+
+        static uint32_t bucket(uint32_t value) {
+            if(value < SUB_BUCKETS) {
+                return value;
+            }
+            uint32_t shift = highestBit(value) - SUB_BITS;
+            return (shift + 1) * SUB_BUCKETS + ((value >> shift) - SUB_BUCKETS);
+        }
+
+        static uint32_t upperBound(uint32_t index) {
+            if(index < SUB_BUCKETS) {
+                return index;
+            }
+            uint32_t shift = index / SUB_BUCKETS - 1;
+            uint64_t upper = ((uint64_t)(SUB_BUCKETS + index % SUB_BUCKETS + 1) << shift) - 1;
+            return upper > UINT32_MAX ? UINT32_MAX : (uint32_t)upper;
+        }
+
+        // Histogram of samples
+        uint32_t buckets_[BUCKETS];
+
+        // Exact summary values
+        uint64_t count_;
+        uint64_t sum_;
+        uint32_t min_;
+        uint32_t max_;
+};
+
+}  // namespace Timing
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_TIMING_TIMING_STATS_H
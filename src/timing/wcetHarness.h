@@ -0,0 +1,158 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Harness for worst case execution time measurements. Runs a callable repeatedly, optionally evicting the
+ * caches before each call, and records the duration of each call in TimingStats with the counter overhead
+ * removed. isDataDependent compares the timing of two input classes to flag kernels whose timing depends on
+ * the data, which matters when an update has to fit a hard deadline. count runs a callable under the hardware
+ * performance counters instead, to see why a kernel takes the time it does.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_TIMING_WCET_HARNESS_H
+#define CONTROLALGORITHMS_TIMING_WCET_HARNESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <timing/cycleCounter.h>
+#include <timing/perfCounters.h>
+#include <timing/timingStats.h>
+
+namespace ControlAlgorithms {
+namespace Timing {
+
+class WcetHarness {
+    public:
+        /**
+         * Smallest measured duration of an empty timed region, subtracted from every sample
+         * @return uint32_t counter overhead
+         */
+        static uint32_t calibrate() {
+            uint32_t overhead = UINT32_MAX;
+            for(uint32_t i = 0; i < CALIBRATION_RUNS; ++i) {
+                uint32_t start = CycleCounter::now();
+                barrier();
+                uint32_t elapsed = CycleCounter::now() - start;
+                overhead = elapsed < overhead ? elapsed : overhead;
+            }
+            return overhead;
+        }
+
+        /**
+         * Time a callable
+         * @param function [in]: callable taking the iteration index, e.g. a lambda running one controller update
+         * @param iterations [in]: uint32_t number of timed calls
+         * @param stats [out]: TimingStats receives one sample per call
+         * @param eviction_buffer [in]: uint8_t* buffer larger than the caches, written before each call for cold
+         *                              cache runs; nullptr for warm cache runs
+         * @param eviction_size [in]: size_t size of eviction_buffer
+         */
+        template<typename Function>
+        static void measure(Function &function, uint32_t iterations, TimingStats &stats,
+                            uint8_t *eviction_buffer = nullptr, size_t eviction_size = 0) {
+            uint32_t overhead = calibrate();
+            for(uint32_t i = 0; i < iterations; ++i) {
+                if(eviction_buffer != nullptr) {
+                    evict(eviction_buffer, eviction_size);
+                }
+                barrier();
+                uint32_t start = CycleCounter::now();
+                barrier();
+                function(i);
+                barrier();
+                uint32_t elapsed = CycleCounter::now() - start;
+                stats.record(elapsed > overhead ? elapsed - overhead : 0);
+            }
+        }
+
+        /**
+         * Run a callable under the performance counters. The counters cover all calls together, as they are too
+         * costly to read per call.
+         * @param function [in]: callable taking the iteration index
+         * @param iterations [in]: uint32_t number of calls
+         * @param counters [in]: PerfCounters opened counters
+         * @param sample [out]: PerfSample totals over all calls
+         * @return bool false if no counter is open
+         */
+        template<typename Function>
+        static bool count(Function &function, uint32_t iterations, PerfCounters &counters, PerfSample &sample) {
+            // One untimed call to fault in the data and warm the caches
+            function(0);
+            barrier();
+            counters.start();
+            barrier();
+            for(uint32_t i = 0; i < iterations; ++i) {
+                function(i);
+            }
+            barrier();
+            counters.stop();
+            return counters.read(sample);
+        }
+
+        /**
+         * Flag timing that depends on the input class. The median and p99 of the candidate are compared with
+         * the reference; either moving by more than the tolerance counts.
+         * @param reference [in]: TimingStats of nominal inputs
+         * @param candidate [in]: TimingStats of another input class, e.g. limit hits or non-finite values
+         * @param tolerance [in]: float allowed relative difference, e.g. 0.1 for 10%
+         * @param slack [in]: uint32_t absolute difference always allowed, covering counter resolution
+         * @return bool true if the timing differs
+         */
+        static bool isDataDependent(const TimingStats &reference, const TimingStats &candidate, float tolerance,
+                                    uint32_t slack) {
+            return differs(reference.percentile(0.5f), candidate.percentile(0.5f), tolerance, slack) ||
+                   differs(reference.percentile(0.99f), candidate.percentile(0.99f), tolerance, slack);
+        }
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        WcetHarness() {};
+
+        static const uint32_t CALIBRATION_RUNS = 1000;
+        static const size_t CACHE_LINE = 32;
+
+        // Keep the compiler from moving work across the counter reads
+        static inline void barrier() {
+#if defined(__GNUC__)
+            asm volatile("" ::: "memory");
+#endif
+        }
+
+        static void evict(uint8_t *buffer, size_t size) {
+            for(size_t offset = 0; offset < size; offset += CACHE_LINE) {
+                buffer[offset] = (uint8_t)(buffer[offset] + 1);
+            }
+        }
+
+        static bool differs(uint32_t reference, uint32_t candidate, float tolerance, uint32_t slack) {
+            uint32_t difference = candidate > reference ? candidate - reference : reference - candidate;
+            return difference > slack && (float)difference > tolerance * (float)reference;
+        }
+};
+
+}  // namespace Timing
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_TIMING_WCET_HARNESS_H
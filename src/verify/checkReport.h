@@ -0,0 +1,103 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Tally of verification checks. Keeps counts and the first failure only, so it needs no allocation.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_VERIFY_CHECK_REPORT_H
+#define CONTROLALGORITHMS_VERIFY_CHECK_REPORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace ControlAlgorithms {
+namespace Verify {
+
+class CheckReport {
+    public:
+        CheckReport() {};
+        virtual ~CheckReport() {};
+
+        /**
+         * Record the outcome of one check
+         * @param passed [in]: bool whether the check passed
+         * @param check [in]: const char* name of the check, a string literal
+         * @param step [in]: size_t step of the sequence being checked
+         * @return bool passed
+         */
+        bool record(bool passed, const char *check, size_t step) {
+            ++checks_;
+            if(!passed) {
+                if(failures_ == 0) {
+                    first_failure_ = check;
+                    first_failure_step_ = step;
+                }
+                ++failures_;
+            }
+            return passed;
+        }
+
+        /**
+         * Record the distance between two implementations
+         * @param ulp [in]: uint32_t distance in ULP
+         */
+        void recordUlp(uint32_t ulp) {
+            if(ulp > max_ulp_) {
+                max_ulp_ = ulp;
+            }
+        }
+
+        void reset() {
+            checks_ = 0;
+            failures_ = 0;
+            max_ulp_ = 0;
+            first_failure_ = nullptr;
+            first_failure_step_ = 0;
+        }
+
+        uint32_t getChecks() const { return checks_; }
+        uint32_t getFailures() const { return failures_; }
+        bool passed() const { return failures_ == 0; }
+        uint32_t getMaxUlp() const { return max_ulp_; }
+        const char *getFirstFailure() const { return first_failure_; }
+        size_t getFirstFailureStep() const { return first_failure_step_; }
+
+    private:
+        uint32_t checks_{0};
+        uint32_t failures_{0};
+
+        // Largest difference seen between implementations that are compared with a tolerance
+        uint32_t max_ulp_{0};
+
+        // Name and step of the first failing check
+        const char *first_failure_{nullptr};
+        size_t first_failure_step_{0};
+};
+
+}  // namespace Verify
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_VERIFY_CHECK_REPORT_H
@@ -0,0 +1,851 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Differential checks of the controller implementations
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "differential.h"
+#include <math.h>
+#include <base/controlFaults.h>
+#include <base/numericPolicy.h>
+#include <pid/pidKernels.h>
+#include <pid/proportional.h>
+#include <pid/proportionalBank.h>
+#include <pid/integral.h>
+#include <pid/integralBank.h>
+#include <pid/derivative.h>
+#include <pid/derivativeBank.h>
+#include <pid/weightedProportionalStateless.h>
+#include <pid/weightedProportionalBatch.h>
+#include <pid/weightedDerivativeStateless.h>
+#include <pid/weightedDerivativeBatch.h>
+#include <pid/outputConditioner.h>
+#include <pid/outputConditionerBatch.h>
+#include <pid/outputConditionerStateless.h>
+#include <nonlinear/nonlinearKernels.h>
+#include <nonlinear/slidingMode.h>
+#include <nonlinear/slidingModeBank.h>
+#include <nonlinear/bangBang.h>
+#include <nonlinear/bangBangBank.h>
+#include <monitor/loopMetrics.h>
+#include <monitor/loopMetricsBank.h>
+#include <verify/randomInput.h>
+#include <verify/ulp.h>
+
+namespace ControlAlgorithms {
+
+namespace Verify {
+
+namespace {
+
+const size_t LANES = Differential::LANES;
+
+// Compare a candidate with the reference
+void compare(CheckReport &report, float reference, float candidate, uint32_t tolerance, const char *check, size_t step) {
+    uint32_t ulp = Ulp::distance(reference, candidate);
+    if(ulp != UINT32_MAX) {
+        report.recordUlp(ulp);
+    }
+    report.record(ulp <= tolerance, check, step);
+}
+
+// Clamp invariant; only applies when the limits are in use
+void checkLimits(CheckReport &report, const PID::IntegralSettings &settings, float integrated_error, const char *check,
+                 size_t step) {
+    if(settings.getHasLimits()) {
+        report.record(integrated_error >= settings.getMinLimit() && integrated_error <= settings.getMaxLimit(), check, step);
+    }
+}
+
+// Faults the hardened paths must report
+uint8_t expectedFaults(float error, float delta_t, float max_time_step) {
+    return (isfinite(error) ? 0 : Base::FAULT_ERROR_NOT_FINITE) |
+           (delta_t > 0.0f && delta_t <= max_time_step ? 0 : Base::FAULT_DELTA_T_OUT_OF_RANGE);
+}
+
+// Same sample in every lane, and the lanes visited in reverse for the indexed update
+void fillLanes(float value, float *lanes) {
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        lanes[lane] = value;
+    }
+}
+
+const uint32_t REVERSED[LANES] = {4, 3, 2, 1, 0};
+
+// Every field of two loop metrics states
+void compareMetrics(CheckReport &report, const Monitor::LoopMetricsState &reference,
+                    const Monitor::LoopMetricsState &candidate, uint32_t tolerance, const char *check, size_t step) {
+    compare(report, reference.getElapsed(), candidate.getElapsed(), tolerance, check, step);
+    compare(report, reference.getIae(), candidate.getIae(), tolerance, check, step);
+    compare(report, reference.getIse(), candidate.getIse(), tolerance, check, step);
+    compare(report, reference.getItae(), candidate.getItae(), tolerance, check, step);
+    compare(report, reference.getElapsedCompensation(), candidate.getElapsedCompensation(), tolerance, check, step);
+    compare(report, reference.getIaeCompensation(), candidate.getIaeCompensation(), tolerance, check, step);
+    compare(report, reference.getIseCompensation(), candidate.getIseCompensation(), tolerance, check, step);
+    compare(report, reference.getItaeCompensation(), candidate.getItaeCompensation(), tolerance, check, step);
+    report.record(reference.getSamples() == candidate.getSamples(), check, step);
+    compare(report, reference.getMean(), candidate.getMean(), tolerance, check, step);
+    compare(report, reference.getSumSquares(), candidate.getSumSquares(), tolerance, check, step);
+    compare(report, reference.getSign(), candidate.getSign(), tolerance, check, step);
+    compare(report, reference.getSegmentIae(), candidate.getSegmentIae(), tolerance, check, step);
+    compare(report, reference.getDetections(), candidate.getDetections(), tolerance, check, step);
+    compare(report, reference.getMeanSquare(), candidate.getMeanSquare(), tolerance, check, step);
+}
+
+}  // namespace
+
+void Differential::checkProportional(float gain, const float *error, size_t steps, uint32_t tolerance, CheckReport &report) {
+    Base::ControlSettings settings;
+    settings.setGain(gain);
+
+    PID::Proportional stateful;
+    stateful.setSettings(settings);
+    PID::ProportionalBank<LANES> bank;
+    PID::ProportionalBank<LANES> indexed_bank;
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+        indexed_bank.setSettings(lane, settings);
+    }
+
+    float lane_error[LANES];
+    float lane_delta_t[LANES] = {};
+    for(size_t step = 0; step < steps; ++step) {
+        Base::ControlInput input;
+        input.setError(error[step]);
+        Base::ControlOutput reference;
+        PID::ProportionalStateless::update(input, settings, reference);
+
+        compare(report, reference.getControl(), PID::Kernels::proportional(error[step], gain), tolerance,
+                "proportional kernel", step);
+
+        Base::ControlOutput output;
+        stateful.update(input, output);
+        compare(report, reference.getControl(), output.getControl(), tolerance, "proportional stateful", step);
+
+        fillLanes(error[step], lane_error);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference.getControl(), bank.getControl(lane), tolerance, "proportional bank", step);
+            compare(report, reference.getControl(), indexed_bank.getControl(lane), tolerance,
+                    "proportional bank indexed", step);
+        }
+    }
+}
+
+void Differential::checkIntegral(const PID::IntegralSettings &settings, const float *error, const float *delta_t,
+                                 size_t steps, uint32_t tolerance, CheckReport &report) {
+    PID::Integral stateful;
+    stateful.setSettings(settings);
+    PID::IntegralBank<LANES> bank;
+    PID::IntegralBank<LANES> indexed_bank;
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+        indexed_bank.setSettings(lane, settings);
+    }
+
+    PID::IntegralOutput reference;
+    PID::IntegralOutputT<Base::DoublePolicy> double_output;
+    PID::IntegralOutputT<Base::KahanPolicy> kahan_output;
+    float kernel_integrated_error = 0.0f;
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        PID::IntegralInput input;
+        input.setError(error[step]);
+        input.setDeltaT(delta_t[step]);
+        input.setAccumulator(reference.getAccumulator());
+        PID::IntegralStateless::update(input, settings, reference);
+        checkLimits(report, settings, reference.getIntegratedError(), "integral limits", step);
+
+        kernel_integrated_error = PID::Kernels::integrate(kernel_integrated_error, error[step], delta_t[step],
+                                                          settings.getHasLimits(), settings.getMinLimit(),
+                                                          settings.getMaxLimit());
+        compare(report, reference.getIntegratedError(), kernel_integrated_error, tolerance, "integral kernel", step);
+        compare(report, reference.getControl(), PID::Kernels::integral(kernel_integrated_error, settings.getGain()),
+                tolerance, "integral kernel control", step);
+
+        Base::ControlOutput output;
+        stateful.update(input, output);
+        PID::IntegralOutput stateful_state;
+        stateful.getState(stateful_state);
+        compare(report, reference.getControl(), output.getControl(), tolerance, "integral stateful", step);
+        compare(report, reference.getIntegratedError(), stateful_state.getIntegratedError(), tolerance,
+                "integral stateful state", step);
+
+        fillLanes(error[step], lane_error);
+        fillLanes(delta_t[step], lane_delta_t);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference.getIntegratedError(), bank.getIntegratedError(lane), tolerance, "integral bank", step);
+            compare(report, reference.getControl(), bank.getControl(lane), tolerance, "integral bank control", step);
+            compare(report, reference.getIntegratedError(), indexed_bank.getIntegratedError(lane), tolerance,
+                    "integral bank indexed", step);
+        }
+
+        // The wider policies round differently by design, so only their invariants are checked
+        PID::IntegralInputT<Base::DoublePolicy> double_input;
+        double_input.setError(error[step]);
+        double_input.setDeltaT(delta_t[step]);
+        double_input.setAccumulator(double_output.getAccumulator());
+        PID::IntegralStatelessT<Base::DoublePolicy>::update(double_input, settings, double_output);
+        checkLimits(report, settings, double_output.getIntegratedError(), "integral double policy limits", step);
+
+        PID::IntegralInputT<Base::KahanPolicy> kahan_input;
+        kahan_input.setError(error[step]);
+        kahan_input.setDeltaT(delta_t[step]);
+        kahan_input.setAccumulator(kahan_output.getAccumulator());
+        PID::IntegralStatelessT<Base::KahanPolicy>::update(kahan_input, settings, kahan_output);
+        checkLimits(report, settings, kahan_output.getIntegratedError(), "integral Kahan policy limits", step);
+    }
+}
+
+void Differential::checkDerivative(const PID::DerivativeSettings &settings, const float *error, const float *delta_t,
+                                   size_t steps, uint32_t tolerance, CheckReport &report) {
+    PID::Derivative stateful;
+    stateful.setSettings(settings);
+    PID::DerivativeBank<LANES> bank;
+    PID::DerivativeBank<LANES> indexed_bank;
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+        indexed_bank.setSettings(lane, settings);
+    }
+
+    PID::DerivativeOutput reference;
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        PID::DerivativeInput input;
+        input.setError(error[step]);
+        input.setDeltaT(delta_t[step]);
+        float previous_error = reference.getPreviousError();
+        input.setPreviousError(previous_error);
+        PID::DerivativeStateless::update(input, settings, reference);
+
+        compare(report, reference.getControl(),
+                PID::Kernels::derivative(error[step], previous_error, delta_t[step], settings.getMinTimeStep(),
+                                         settings.getGain()),
+                tolerance, "derivative kernel", step);
+
+        Base::ControlOutput output;
+        stateful.update(input, output);
+        PID::DerivativeOutput stateful_state;
+        stateful.getState(stateful_state);
+        compare(report, reference.getControl(), output.getControl(), tolerance, "derivative stateful", step);
+        compare(report, reference.getPreviousError(), stateful_state.getPreviousError(), tolerance,
+                "derivative stateful state", step);
+
+        fillLanes(error[step], lane_error);
+        fillLanes(delta_t[step], lane_delta_t);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference.getControl(), bank.getControl(lane), tolerance, "derivative bank", step);
+            compare(report, reference.getPreviousError(), bank.getPreviousError(lane), tolerance,
+                    "derivative bank state", step);
+            compare(report, reference.getControl(), indexed_bank.getControl(lane), tolerance,
+                    "derivative bank indexed", step);
+        }
+    }
+}
+
+void Differential::checkWeighted(const PID::WeightedProportionalSettings &p_settings,
+                                 const PID::WeightedDerivativeSettings &d_settings, const float *setpoint,
+                                 const float *measurement, const float *feed_forward, const float *delta_t,
+                                 size_t steps, uint32_t tolerance, CheckReport &report) {
+    // Batch state, all lanes running the same sequence
+    float p_weight[LANES];
+    float p_gain[LANES];
+    float d_weight[LANES];
+    float d_gain[LANES];
+    float d_min_time_step[LANES];
+    fillLanes(p_settings.getSetpointWeight(), p_weight);
+    fillLanes(p_settings.getGain(), p_gain);
+    fillLanes(d_settings.getSetpointWeight(), d_weight);
+    fillLanes(d_settings.getGain(), d_gain);
+    fillLanes(d_settings.getMinTimeStep(), d_min_time_step);
+    float p_control[LANES];
+    float p_indexed_control[LANES];
+    float d_previous_error[LANES] = {};
+    float d_control[LANES];
+    float d_indexed_previous_error[LANES] = {};
+    float d_indexed_control[LANES];
+
+    // Unit weights without feed-forward must match the plain controllers
+    Base::ControlSettings plain_p_settings;
+    plain_p_settings.setGain(p_settings.getGain());
+    PID::DerivativeSettings plain_d_settings;
+    plain_d_settings.copy(d_settings);
+    PID::WeightedProportionalSettings unit_p_settings;
+    unit_p_settings.copy(p_settings);
+    unit_p_settings.setSetpointWeight(1.0f);
+    PID::WeightedDerivativeSettings unit_d_settings;
+    unit_d_settings.copy(d_settings);
+    unit_d_settings.setSetpointWeight(1.0f);
+    PID::DerivativeOutput plain_d;
+    PID::DerivativeOutput unit_d;
+
+    PID::DerivativeOutput reference_d;
+    float lane_setpoint[LANES];
+    float lane_measurement[LANES];
+    float lane_feed_forward[LANES];
+    float lane_delta_t[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        Base::SetpointInput input;
+        input.setSetpoint(setpoint[step]);
+        input.setMeasurement(measurement[step]);
+        input.setFeedForward(feed_forward[step]);
+        Base::ControlOutput reference_p;
+        PID::WeightedProportionalStateless::update(input, p_settings, reference_p);
+
+        PID::WeightedDerivativeInput input_d;
+        input_d.setSetpoint(setpoint[step]);
+        input_d.setMeasurement(measurement[step]);
+        input_d.setDeltaT(delta_t[step]);
+        input_d.setPreviousError(reference_d.getPreviousError());
+        PID::WeightedDerivativeStateless::update(input_d, d_settings, reference_d);
+
+        fillLanes(setpoint[step], lane_setpoint);
+        fillLanes(measurement[step], lane_measurement);
+        fillLanes(feed_forward[step], lane_feed_forward);
+        fillLanes(delta_t[step], lane_delta_t);
+        PID::WeightedProportionalBatch::update(lane_setpoint, lane_measurement, lane_feed_forward, p_weight, p_gain,
+                                               p_control, LANES);
+        PID::WeightedProportionalBatch::updateIndexed(REVERSED, lane_setpoint, lane_measurement, lane_feed_forward,
+                                                      p_weight, p_gain, p_indexed_control, LANES);
+        PID::WeightedDerivativeBatch::update(lane_setpoint, lane_measurement, lane_delta_t, d_weight, d_gain,
+                                             d_min_time_step, d_previous_error, d_control, LANES);
+        PID::WeightedDerivativeBatch::updateIndexed(REVERSED, lane_setpoint, lane_measurement, lane_delta_t, d_weight,
+                                                    d_gain, d_min_time_step, d_indexed_previous_error,
+                                                    d_indexed_control, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference_p.getControl(), p_control[lane], tolerance, "weighted proportional batch", step);
+            compare(report, reference_p.getControl(), p_indexed_control[lane], tolerance,
+                    "weighted proportional batch indexed", step);
+            compare(report, reference_d.getControl(), d_control[lane], tolerance, "weighted derivative batch", step);
+            compare(report, reference_d.getPreviousError(), d_previous_error[lane], tolerance,
+                    "weighted derivative batch state", step);
+            compare(report, reference_d.getControl(), d_indexed_control[lane], tolerance,
+                    "weighted derivative batch indexed", step);
+        }
+
+        // Reduction to the plain controllers
+        input.setFeedForward(0.0f);
+        Base::ControlOutput unit_p;
+        PID::WeightedProportionalStateless::update(input, unit_p_settings, unit_p);
+        Base::ControlOutput plain_p;
+        PID::ProportionalStateless::update(input, plain_p_settings, plain_p);
+        compare(report, plain_p.getControl(), unit_p.getControl(), tolerance, "weighted proportional unit weight", step);
+
+        input_d.setPreviousError(unit_d.getPreviousError());
+        PID::WeightedDerivativeStateless::update(input_d, unit_d_settings, unit_d);
+        PID::DerivativeInput plain_input;
+        plain_input.setError(input_d.getError());
+        plain_input.setDeltaT(delta_t[step]);
+        plain_input.setPreviousError(plain_d.getPreviousError());
+        PID::DerivativeStateless::update(plain_input, plain_d_settings, plain_d);
+        compare(report, plain_d.getControl(), unit_d.getControl(), tolerance, "weighted derivative unit weight", step);
+    }
+}
+
+void Differential::checkIntegralHardened(const PID::IntegralSettings &settings, const float *error, const float *delta_t,
+                                         size_t steps, uint32_t tolerance, CheckReport &report) {
+    PID::Integral stateful;
+    stateful.setSettings(settings);
+    stateful.setHardened(true);
+    PID::IntegralBank<LANES> bank;
+    PID::IntegralBank<LANES> indexed_bank;
+    bank.setHardened(true);
+    indexed_bank.setHardened(true);
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+        indexed_bank.setSettings(lane, settings);
+    }
+
+    PID::IntegralOutput reference;
+    PID::IntegralOutput hardened;
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        uint8_t faults = expectedFaults(error[step], delta_t[step], settings.getMaxTimeStep());
+
+        // An invalid sample is a zero contribution
+        PID::IntegralInput input;
+        input.setError(faults == Base::FAULT_NONE ? error[step] : 0.0f);
+        input.setDeltaT(faults == Base::FAULT_NONE ? delta_t[step] : 0.0f);
+        input.setAccumulator(reference.getAccumulator());
+        PID::IntegralStateless::update(input, settings, reference);
+
+        input.setError(error[step]);
+        input.setDeltaT(delta_t[step]);
+        input.setAccumulator(hardened.getAccumulator());
+        PID::IntegralStateless::updateHardened(input, settings, hardened);
+        compare(report, reference.getIntegratedError(), hardened.getIntegratedError(), tolerance,
+                "integral hardened", step);
+        report.record(hardened.getFaults() == faults, "integral hardened faults", step);
+        checkLimits(report, settings, hardened.getIntegratedError(), "integral hardened limits", step);
+
+        Base::ControlOutput output;
+        stateful.update(input, output);
+        PID::IntegralOutput stateful_state;
+        stateful.getState(stateful_state);
+        compare(report, reference.getControl(), output.getControl(), tolerance, "integral hardened stateful", step);
+        report.record(stateful_state.getFaults() == faults, "integral hardened stateful faults", step);
+
+        fillLanes(error[step], lane_error);
+        fillLanes(delta_t[step], lane_delta_t);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference.getIntegratedError(), bank.getIntegratedError(lane), tolerance,
+                    "integral hardened bank", step);
+            report.record(bank.getFaults(lane) == faults, "integral hardened bank faults", step);
+            compare(report, reference.getIntegratedError(), indexed_bank.getIntegratedError(lane), tolerance,
+                    "integral hardened bank indexed", step);
+            report.record(indexed_bank.getFaults(lane) == faults, "integral hardened bank indexed faults", step);
+        }
+    }
+
+    // Leaving hardened mode clears the faults, which the plain update never reports
+    stateful.setHardened(false);
+    bank.setHardened(false);
+    PID::IntegralOutput plain_state;
+    stateful.getState(plain_state);
+    report.record(plain_state.getFaults() == Base::FAULT_NONE, "integral unhardened stateful faults", steps);
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        report.record(bank.getFaults(lane) == Base::FAULT_NONE, "integral unhardened bank faults", steps);
+    }
+}
+
+void Differential::checkDerivativeHardened(const PID::DerivativeSettings &settings, const float *error,
+                                           const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report) {
+    PID::Derivative stateful;
+    stateful.setSettings(settings);
+    stateful.setHardened(true);
+    PID::DerivativeBank<LANES> bank;
+    PID::DerivativeBank<LANES> indexed_bank;
+    bank.setHardened(true);
+    indexed_bank.setHardened(true);
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+        indexed_bank.setSettings(lane, settings);
+    }
+
+    PID::DerivativeOutput reference;
+    PID::DerivativeOutput hardened;
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        uint8_t faults = expectedFaults(error[step], delta_t[step], settings.getMaxTimeStep());
+
+        // An invalid sample keeps the previous error and gives no control, even with a zero minimum time step
+        PID::DerivativeInput input;
+        input.setError(faults == Base::FAULT_NONE ? error[step] : reference.getPreviousError());
+        input.setDeltaT(faults == Base::FAULT_NONE ? delta_t[step] : settings.getMinTimeStep());
+        input.setPreviousError(reference.getPreviousError());
+        PID::DerivativeStateless::update(input, settings, reference);
+        if(faults != Base::FAULT_NONE) {
+            reference.setControl(0.0f);
+        }
+
+        input.setError(error[step]);
+        input.setDeltaT(delta_t[step]);
+        input.setPreviousError(hardened.getPreviousError());
+        PID::DerivativeStateless::updateHardened(input, settings, hardened);
+        compare(report, reference.getControl(), hardened.getControl(), tolerance, "derivative hardened", step);
+        compare(report, reference.getPreviousError(), hardened.getPreviousError(), tolerance,
+                "derivative hardened state", step);
+        report.record(hardened.getFaults() == faults, "derivative hardened faults", step);
+
+        Base::ControlOutput output;
+        stateful.update(input, output);
+        PID::DerivativeOutput stateful_state;
+        stateful.getState(stateful_state);
+        compare(report, reference.getControl(), output.getControl(), tolerance, "derivative hardened stateful", step);
+        report.record(stateful_state.getFaults() == faults, "derivative hardened stateful faults", step);
+
+        fillLanes(error[step], lane_error);
+        fillLanes(delta_t[step], lane_delta_t);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference.getControl(), bank.getControl(lane), tolerance, "derivative hardened bank", step);
+            report.record(bank.getFaults(lane) == faults, "derivative hardened bank faults", step);
+            compare(report, reference.getControl(), indexed_bank.getControl(lane), tolerance,
+                    "derivative hardened bank indexed", step);
+            report.record(indexed_bank.getFaults(lane) == faults, "derivative hardened bank indexed faults", step);
+        }
+    }
+
+    // Leaving hardened mode clears the faults, which the plain update never reports
+    stateful.setHardened(false);
+    bank.setHardened(false);
+    PID::DerivativeOutput plain_state;
+    stateful.getState(plain_state);
+    report.record(plain_state.getFaults() == Base::FAULT_NONE, "derivative unhardened stateful faults", steps);
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        report.record(bank.getFaults(lane) == Base::FAULT_NONE, "derivative unhardened bank faults", steps);
+    }
+}
+
+void Differential::checkConditioner(const PID::OutputConditionerSettings &settings,
+                                    const PID::IntegralSettings &integral_settings, const float *error,
+                                    const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report) {
+    PID::Integral integral;
+    integral.setSettings(integral_settings);
+    integral.setHardened(true);
+    PID::OutputConditioner conditioner;
+    conditioner.setSettings(settings);
+    PID::IntegralBank<LANES> bank;
+    bank.setHardened(true);
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, integral_settings);
+    }
+
+    // The conditioner batch takes its settings as arrays, one entry per loop
+    uint8_t has_limits[LANES];
+    float min_limit[LANES];
+    float max_limit[LANES];
+    uint8_t has_rate_limit[LANES];
+    float max_rate[LANES];
+    float deadband[LANES];
+    uint8_t anti_windup[LANES];
+    float tracking_gain[LANES];
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        has_limits[lane] = settings.getHasLimits();
+        min_limit[lane] = settings.getMinLimit();
+        max_limit[lane] = settings.getMaxLimit();
+        has_rate_limit[lane] = settings.getHasRateLimit();
+        max_rate[lane] = settings.getMaxRate();
+        deadband[lane] = settings.getDeadband();
+        anti_windup[lane] = settings.getAntiWindup();
+        tracking_gain[lane] = settings.getTrackingGain();
+    }
+
+    PID::IntegralOutput reference;
+    PID::OutputConditionerOutput conditioned;
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    float lane_control[LANES];
+    float lane_conditioned[LANES] = {};
+    float indexed_conditioned[LANES] = {};
+    float lane_excess[LANES];
+    float indexed_excess[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        PID::IntegralInput input;
+        input.setError(error[step]);
+        input.setDeltaT(delta_t[step]);
+        input.setAccumulator(reference.getAccumulator());
+        float held = reference.getIntegratedError();
+        PID::IntegralStateless::updateHardened(input, integral_settings, reference);
+        float requested = reference.getControl() + error[step];
+
+        float previous = conditioned.getControl();
+        PID::OutputConditionerInput conditioner_input;
+        conditioner_input.setControl(requested);
+        conditioner_input.setDeltaT(delta_t[step]);
+        conditioner_input.setPreviousControl(previous);
+        PID::OutputConditionerStateless::update(conditioner_input, settings, conditioned);
+        PID::OutputConditionerStateless::antiWindup(conditioned, settings, input, integral_settings, reference);
+
+        compare(report, conditioned.getControl(),
+                PID::Kernels::condition(requested, previous, delta_t[step], settings.getDeadband(),
+                                        settings.getHasLimits(), settings.getMinLimit(), settings.getMaxLimit(),
+                                        settings.getHasRateLimit(), settings.getMaxRate()),
+                tolerance, "conditioner kernel", step);
+
+        // Invariants: saturation holds the limits, the slew rate limit bounds the step and rejected samples
+        // leave the integrated error alone, apart from the clamp into the integrator limits
+        float output = conditioned.getControl();
+        if(settings.getHasLimits() && !settings.getHasRateLimit()) {
+            report.record(output >= settings.getMinLimit() && output <= settings.getMaxLimit(), "conditioner limits",
+                          step);
+        }
+        if(settings.getHasRateLimit() && isfinite(previous) && isfinite(delta_t[step]) && delta_t[step] >= 0.0f) {
+            report.record(output >= previous - settings.getMaxRate() * delta_t[step] &&
+                          output <= previous + settings.getMaxRate() * delta_t[step], "conditioner slew", step);
+        }
+        if(reference.getFaults() != Base::FAULT_NONE) {
+            float expected = integral_settings.getHasLimits() ? PID::Kernels::limit(held, integral_settings.getMinLimit(),
+                                                                                    integral_settings.getMaxLimit())
+                                                              : held;
+            compare(report, expected, reference.getIntegratedError(), 0, "anti-windup rejected sample", step);
+        }
+        checkLimits(report, integral_settings, reference.getIntegratedError(), "anti-windup limits", step);
+
+        Base::ControlInput stateful_input;
+        stateful_input.setError(error[step]);
+        stateful_input.setDeltaT(delta_t[step]);
+        Base::ControlOutput integral_output;
+        integral.update(stateful_input, integral_output);
+        Base::ControlOutput output_stateful;
+        conditioner.update(integral_output.getControl() + error[step], delta_t[step], output_stateful, integral);
+        PID::IntegralOutput integral_state;
+        integral.getState(integral_state);
+        compare(report, conditioned.getControl(), output_stateful.getControl(), tolerance, "conditioner stateful",
+                step);
+        compare(report, reference.getIntegratedError(), integral_state.getIntegratedError(), tolerance,
+                "anti-windup stateful", step);
+
+        fillLanes(error[step], lane_error);
+        fillLanes(delta_t[step], lane_delta_t);
+        bank.update(lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            lane_control[lane] = bank.getControl(lane) + error[step];
+        }
+        PID::OutputConditionerBatch::update(lane_control, lane_delta_t, has_limits, min_limit, max_limit,
+                                            has_rate_limit, max_rate, deadband, lane_conditioned, lane_excess, LANES);
+        PID::OutputConditionerBatch::updateIndexed(REVERSED, lane_control, lane_delta_t, has_limits, min_limit,
+                                                   max_limit, has_rate_limit, max_rate, deadband, indexed_conditioned,
+                                                   indexed_excess, LANES);
+        PID::OutputConditionerBatch::antiWindup(lane_error, lane_delta_t, bank.getFaultsArray(), lane_excess,
+                                                anti_windup, tracking_gain, bank.getGainArray(),
+                                                bank.getHasLimitsArray(), bank.getMinLimitArray(),
+                                                bank.getMaxLimitArray(), bank.getIntegratedErrorArray(), LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, conditioned.getControl(), lane_conditioned[lane], tolerance, "conditioner batch", step);
+            compare(report, conditioned.getExcess(), lane_excess[lane], tolerance, "conditioner batch excess", step);
+            compare(report, conditioned.getControl(), indexed_conditioned[lane], tolerance,
+                    "conditioner batch indexed", step);
+            compare(report, reference.getIntegratedError(), bank.getIntegratedError(lane), tolerance,
+                    "anti-windup batch", step);
+        }
+    }
+}
+
+void Differential::checkAntiWindup(CheckReport &report) {
+    // A unit error the output limits cannot follow: the PI request is integral + error, saturated at +-1
+    const size_t steps = 1000;
+    const float delta_t = 0.01f;
+    PID::IntegralSettings integral_settings;
+    integral_settings.setGain(1.0f);
+    integral_settings.setHasLimits(false);
+    PID::OutputConditionerSettings settings;
+    settings.setHasLimits(true);
+    settings.setMinLimit(-1.0f);
+    settings.setMaxLimit(1.0f);
+    settings.setTrackingGain(1.0f);
+
+    const uint8_t modes[3] = {PID::ANTI_WINDUP_NONE, PID::ANTI_WINDUP_CLAMP, PID::ANTI_WINDUP_BACK_CALCULATION};
+    for(size_t mode = 0; mode < 3; ++mode) {
+        settings.setAntiWindup(modes[mode]);
+        PID::Integral integral;
+        integral.setSettings(integral_settings);
+        integral.setHardened(true);
+        PID::OutputConditioner conditioner;
+        conditioner.setSettings(settings);
+
+        Base::ControlInput input;
+        input.setError(1.0f);
+        input.setDeltaT(delta_t);
+        Base::ControlOutput integral_output;
+        Base::ControlOutput output;
+        for(size_t step = 0; step < steps; ++step) {
+            integral.update(input, integral_output);
+            conditioner.update(integral_output.getControl() + input.getError(), delta_t, output, integral);
+        }
+        PID::IntegralOutput state;
+        integral.getState(state);
+        float wound = state.getIntegratedError();
+        // Without anti-windup the integrated error is steps * delta_t = 10; the clamp holds it near zero and back
+        // calculation settles where the error and the tracking term balance, at 1
+        if(modes[mode] == PID::ANTI_WINDUP_NONE) {
+            report.record(wound > 9.0f, "anti-windup none winds up", mode);
+        } else {
+            report.record(wound < 1.5f, "anti-windup bounded", mode);
+        }
+
+        // A rejected sample in saturation must not move the integrated error, whatever the mode
+        input.setError(NAN);
+        integral.update(input, integral_output);
+        conditioner.update(integral_output.getControl() + input.getError(), delta_t, output, integral);
+        integral.getState(state);
+        report.record(state.getIntegratedError() == wound, "anti-windup rejected sample", mode);
+        input.setError(1.0f);
+    }
+}
+
+void Differential::checkSlidingMode(const Nonlinear::SlidingModeSettings &settings, const float *error,
+                                    const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report) {
+    Nonlinear::SlidingMode stateful;
+    stateful.setSettings(settings);
+    Nonlinear::SlidingModeBank<LANES> bank;
+    Nonlinear::SlidingModeBank<LANES> indexed_bank;
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+        indexed_bank.setSettings(lane, settings);
+    }
+
+    Nonlinear::SlidingModeOutput reference;
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        Nonlinear::SlidingModeInput input;
+        input.setError(error[step]);
+        input.setDeltaT(delta_t[step]);
+        input.setPreviousError(reference.getPreviousError());
+        Nonlinear::SlidingModeStateless::update(input, settings, reference);
+
+        float surface = Nonlinear::Kernels::slidingSurface(error[step], input.getPreviousError(), delta_t[step],
+                                                           settings.getMinTimeStep(), settings.getSlope());
+        compare(report, reference.getSurface(), surface, tolerance, "sliding mode surface kernel", step);
+        compare(report, reference.getControl(),
+                Nonlinear::Kernels::slidingMode(surface, settings.getBoundaryLayer(), settings.getGain()), tolerance,
+                "sliding mode kernel", step);
+        // The saturation bounds the control by the gain even for a non-finite surface
+        report.record(fabsf(reference.getControl()) <= fabsf(settings.getGain()), "sliding mode bound", step);
+
+        Base::ControlOutput output;
+        stateful.update(input, output);
+        compare(report, reference.getControl(), output.getControl(), tolerance, "sliding mode stateful", step);
+
+        fillLanes(error[step], lane_error);
+        fillLanes(delta_t[step], lane_delta_t);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference.getControl(), bank.getControl(lane), tolerance, "sliding mode bank", step);
+            compare(report, reference.getSurface(), bank.getSurface(lane), tolerance, "sliding mode bank surface",
+                    step);
+            compare(report, reference.getControl(), indexed_bank.getControl(lane), tolerance,
+                    "sliding mode bank indexed", step);
+        }
+    }
+}
+
+void Differential::checkBangBang(const Nonlinear::BangBangSettings &settings, const float *error, size_t steps,
+                                 uint32_t tolerance, CheckReport &report) {
+    Nonlinear::BangBang stateful;
+    stateful.setSettings(settings);
+    Nonlinear::BangBangBank<LANES> bank;
+    Nonlinear::BangBangBank<LANES> indexed_bank;
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+        indexed_bank.setSettings(lane, settings);
+    }
+
+    Nonlinear::BangBangOutput reference;
+    float lane_error[LANES];
+    float lane_delta_t[LANES] = {};
+    for(size_t step = 0; step < steps; ++step) {
+        Nonlinear::BangBangInput input;
+        input.setError(error[step]);
+        input.setOn(reference.getOn());
+        Nonlinear::BangBangStateless::update(input, settings, reference);
+
+        uint8_t on = Nonlinear::Kernels::bangBang(error[step], settings.getHysteresis(), input.getOn() ? 1 : 0);
+        report.record(reference.getOn() == (on != 0), "bang-bang kernel", step);
+        // A NaN error compares false both ways, so the switch holds
+        if(isnan(error[step])) {
+            report.record(reference.getOn() == input.getOn(), "bang-bang holds on NaN", step);
+        }
+        report.record(reference.getControl() == (reference.getOn() ? settings.getGain() : settings.getOffOutput()),
+                      "bang-bang output", step);
+
+        Base::ControlOutput output;
+        stateful.update(input, output);
+        compare(report, reference.getControl(), output.getControl(), tolerance, "bang-bang stateful", step);
+
+        fillLanes(error[step], lane_error);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            compare(report, reference.getControl(), bank.getControl(lane), tolerance, "bang-bang bank", step);
+            compare(report, reference.getControl(), indexed_bank.getControl(lane), tolerance,
+                    "bang-bang bank indexed", step);
+        }
+    }
+}
+
+void Differential::checkLoopMetrics(const Monitor::LoopMetricsSettings &settings, const float *error,
+                                    const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report) {
+    Monitor::LoopMetrics stateful;
+    stateful.setSettings(settings);
+    Monitor::LoopMetricsBank<LANES> bank;
+    Monitor::LoopMetricsBank<LANES> indexed_bank;
+    bank.setSettings(settings);
+    indexed_bank.setSettings(settings);
+
+    Monitor::LoopMetricsState reference;
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    float health[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        Base::ControlInput input;
+        input.setError(error[step]);
+        input.setDeltaT(delta_t[step]);
+        Monitor::LoopMetricsStateless::update(input, settings, reference);
+        float reference_health = Monitor::LoopMetricsStateless::health(reference, settings);
+
+        stateful.update(input);
+        compareMetrics(report, reference, stateful.getState(), tolerance, "loop metrics stateful", step);
+        compare(report, reference_health, stateful.getHealth(), tolerance, "loop metrics stateful health", step);
+
+        fillLanes(error[step], lane_error);
+        fillLanes(delta_t[step], lane_delta_t);
+        bank.update(lane_error, lane_delta_t, LANES);
+        indexed_bank.updateIndexed(REVERSED, lane_error, lane_delta_t, LANES);
+        bank.health(health, LANES);
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            Monitor::LoopMetricsState state;
+            bank.getState(lane, state);
+            compareMetrics(report, reference, state, tolerance, "loop metrics bank", step);
+            compare(report, reference_health, health[lane], tolerance, "loop metrics bank health", step);
+            indexed_bank.getState(lane, state);
+            compareMetrics(report, reference, state, tolerance, "loop metrics bank indexed", step);
+        }
+    }
+}
+
+void Differential::checkLoopMetricsDrift(uint32_t seed, uint32_t samples, CheckReport &report) {
+    // A plain float sum of a million millisecond steps is off by about 1e-4 relative; compensated, the criteria
+    // stay within a few float roundings of the double sums
+    const double relative_tolerance = 1.0e-6;
+    RandomInput random(seed);
+    Monitor::LoopMetricsSettings settings;
+    Monitor::LoopMetricsState state;
+    double elapsed = 0.0;
+    double iae = 0.0;
+    double ise = 0.0;
+    for(uint32_t sample = 0; sample < samples; ++sample) {
+        Base::ControlInput input;
+        input.setError(random.uniform(-1.0f, 1.0f));
+        input.setDeltaT(random.uniform(0.0005f, 0.0015f));
+        Monitor::LoopMetricsStateless::update(input, settings, state);
+        elapsed += (double)input.getDeltaT();
+        iae += fabs((double)input.getError()) * (double)input.getDeltaT();
+        ise += (double)input.getError() * (double)input.getError() * (double)input.getDeltaT();
+    }
+    report.record(fabs(state.getElapsed() - elapsed) <= relative_tolerance * elapsed, "loop metrics elapsed drift",
+                  samples);
+    report.record(fabs(state.getIae() - iae) <= relative_tolerance * iae, "loop metrics IAE drift", samples);
+    report.record(fabs(state.getIse() - ise) <= relative_tolerance * ise, "loop metrics ISE drift", samples);
+    report.record(state.getSamples() == samples, "loop metrics samples", samples);
+}
+
+}  // namespace Verify
+}  // namespace ControlAlgorithms
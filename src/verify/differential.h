@@ -0,0 +1,189 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Differential checks of every controller implementation against the stateless reference. One error/time step
+ * sequence is run through the stateless update, the constexpr kernels, the stateful wrapper and a bank (batch
+ * and indexed), and every step is compared within a ULP tolerance. Invariants are checked alongside: the
+ * integrated error of every implementation, including the double and Kahan policies, stays inside the limits,
+ * and the hardened paths hold state and raise the right fault flags on invalid samples. The setpoint weighted
+ * controllers are checked the same way, and so are the output conditioner with its anti-windup feedback, the
+ * sliding mode and bang-bang controllers and the loop metrics.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_VERIFY_DIFFERENTIAL_H
+#define CONTROLALGORITHMS_VERIFY_DIFFERENTIAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pid/integralSettings.h>
+#include <pid/derivativeSettings.h>
+#include <pid/weightedProportionalSettings.h>
+#include <pid/weightedDerivativeSettings.h>
+#include <pid/outputConditionerSettings.h>
+#include <nonlinear/slidingModeSettings.h>
+#include <nonlinear/bangBangSettings.h>
+#include <monitor/loopMetricsSettings.h>
+#include <verify/checkReport.h>
+
+namespace ControlAlgorithms {
+namespace Verify {
+
+class Differential {
+    public:
+        // Loops in the banks under test; odd so vectorized kernels also run their remainder
+        static const size_t LANES = 5;
+
+        /**
+         * Check the proportional implementations
+         * @param gain [in]: float controller gain
+         * @param error [in]: float[steps] error sequence
+         * @param steps [in]: size_t sequence length
+         * @param tolerance [in]: uint32_t allowed difference from the reference in ULP
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkProportional(float gain, const float *error, size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the integral implementations, with the clamp invariant for every numeric policy
+         * @param settings [in]: PID::IntegralSettings settings, min limit <= max limit
+         * @param error [in]: float[steps] error sequence
+         * @param delta_t [in]: float[steps] time step sequence
+         * @param steps [in]: size_t sequence length
+         * @param tolerance [in]: uint32_t allowed difference from the reference in ULP
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkIntegral(const PID::IntegralSettings &settings, const float *error, const float *delta_t,
+                                  size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the derivative implementations
+         * @param settings [in]: PID::DerivativeSettings settings
+         * @param error [in]: float[steps] error sequence
+         * @param delta_t [in]: float[steps] time step sequence
+         * @param steps [in]: size_t sequence length
+         * @param tolerance [in]: uint32_t allowed difference from the reference in ULP
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkDerivative(const PID::DerivativeSettings &settings, const float *error, const float *delta_t,
+                                    size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the setpoint weighted (2-DOF) proportional and derivative implementations, and that unit weights
+         * with no feed-forward reduce them to the plain controllers
+         * @param p_settings [in]: PID::WeightedProportionalSettings proportional settings
+         * @param d_settings [in]: PID::WeightedDerivativeSettings derivative settings
+         * @param setpoint [in]: float[steps] setpoint sequence
+         * @param measurement [in]: float[steps] measurement sequence
+         * @param feed_forward [in]: float[steps] feed-forward sequence
+         * @param delta_t [in]: float[steps] time step sequence
+         * @param steps [in]: size_t sequence length
+         * @param tolerance [in]: uint32_t allowed difference from the reference in ULP
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkWeighted(const PID::WeightedProportionalSettings &p_settings,
+                                  const PID::WeightedDerivativeSettings &d_settings, const float *setpoint,
+                                  const float *measurement, const float *feed_forward, const float *delta_t,
+                                  size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the hardened integral implementations on any input. Valid samples must match the plain update and
+         * invalid ones must act as a zero contribution and set the fault flags.
+         * Parameters as in checkIntegral; error and delta_t may be non-finite.
+         */
+        static void checkIntegralHardened(const PID::IntegralSettings &settings, const float *error, const float *delta_t,
+                                          size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the hardened derivative implementations on any input. Invalid samples must hold the previous error,
+         * give no control and set the fault flags.
+         * Parameters as in checkDerivative; error and delta_t may be non-finite.
+         */
+        static void checkDerivativeHardened(const PID::DerivativeSettings &settings, const float *error,
+                                            const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the output conditioner implementations (deadband, saturation and slew rate limit) and their
+         * anti-windup feedback into a hardened integral. The requested control is the integral control plus the
+         * error. Conditioned outputs must stay within the limits and the slew step, and a rejected sample must
+         * leave the integrated error as it was.
+         * @param settings [in]: PID::OutputConditionerSettings conditioner settings, min limit <= max limit
+         * @param integral_settings [in]: PID::IntegralSettings settings of the integral being corrected
+         * Remaining parameters as in checkIntegral; error and delta_t may be non-finite.
+         */
+        static void checkConditioner(const PID::OutputConditionerSettings &settings,
+                                     const PID::IntegralSettings &integral_settings, const float *error,
+                                     const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check that anti-windup works: under sustained saturation the clamp and back calculation keep the
+         * integrated error bounded where no anti-windup lets it grow, and a rejected sample changes nothing
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkAntiWindup(CheckReport &report);
+
+        /**
+         * Check the sliding mode implementations, with the control bounded by the gain
+         * @param settings [in]: Nonlinear::SlidingModeSettings settings
+         * Remaining parameters as in checkIntegral; error and delta_t may be non-finite.
+         */
+        static void checkSlidingMode(const Nonlinear::SlidingModeSettings &settings, const float *error,
+                                     const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the bang-bang implementations, with the control always one of the two outputs
+         * @param settings [in]: Nonlinear::BangBangSettings settings
+         * Remaining parameters as in checkProportional; error may be non-finite.
+         */
+        static void checkBangBang(const Nonlinear::BangBangSettings &settings, const float *error, size_t steps,
+                                  uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check the loop metrics implementations: every field of the stateful and bank (batch and indexed) state,
+         * and the health score, against the stateless update
+         * @param settings [in]: Monitor::LoopMetricsSettings settings
+         * Remaining parameters as in checkIntegral.
+         */
+        static void checkLoopMetrics(const Monitor::LoopMetricsSettings &settings, const float *error,
+                                     const float *delta_t, size_t steps, uint32_t tolerance, CheckReport &report);
+
+        /**
+         * Check that the compensated integral criteria keep their accuracy over a long run: elapsed time, IAE and
+         * ISE against double sums of the same samples
+         * @param seed [in]: uint32_t seed of the random error and time step sequence
+         * @param samples [in]: uint32_t run length
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkLoopMetricsDrift(uint32_t seed, uint32_t samples, CheckReport &report);
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Differential() {};
+};
+
+}  // namespace Verify
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_VERIFY_DIFFERENTIAL_H
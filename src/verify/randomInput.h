@@ -0,0 +1,190 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Reproducible random controller inputs and settings for property based checks. Most values are drawn from
+ * operating ranges, with a share of edge values (zeros, subnormals, very large values, limits at the boundary)
+ * where implementations are most likely to disagree.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_VERIFY_RANDOM_INPUT_H
+#define CONTROLALGORITHMS_VERIFY_RANDOM_INPUT_H
+
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <pid/integralSettings.h>
+#include <pid/derivativeSettings.h>
+#include <pid/outputConditionerSettings.h>
+#include <nonlinear/slidingModeSettings.h>
+#include <nonlinear/bangBangSettings.h>
+#include <monitor/loopMetricsSettings.h>
+
+namespace ControlAlgorithms {
+namespace Verify {
+
+class RandomInput {
+    public:
+        RandomInput(uint32_t seed): state_(seed == 0 ? 1 : seed) {};
+        virtual ~RandomInput() {};
+
+        /**
+         * Next raw value (xorshift32)
+         * @return uint32_t random bits
+         */
+        uint32_t nextBits() {
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 17;
+            state_ ^= state_ << 5;
+            return state_;
+        }
+
+        /**
+         * @return float uniform in [min_value, max_value)
+         */
+        float uniform(float min_value, float max_value) {
+            return min_value + (max_value - min_value) * (float)(nextBits() >> 8) * (1.0f / 16777216.0f);
+        }
+
+        /**
+         * An error signal: finite, mostly moderate, sometimes an edge value
+         * @return float error
+         */
+        float error() {
+            switch(nextBits() % 16) {
+                case 0: return 0.0f;
+                case 1: return -0.0f;
+                case 2: return FLT_MIN * 0.5f;
+                case 3: return uniform(-1.0e30f, 1.0e30f);
+                default: return uniform(-1000.0f, 1000.0f);
+            }
+        }
+
+        /**
+         * A time step: positive and finite, sometimes tiny or zero
+         * @return float delta_t
+         */
+        float deltaT() {
+            switch(nextBits() % 16) {
+                case 0: return 0.0f;
+                case 1: return 1.0e-9f;
+                default: return uniform(1.0e-5f, 0.1f);
+            }
+        }
+
+        /**
+         * A sample the hardened paths must reject: non-finite error
+         * @return float NaN or +/-infinity
+         */
+        float nonFinite() {
+            switch(nextBits() % 3) {
+                case 0: return NAN;
+                case 1: return INFINITY;
+                default: return -INFINITY;
+            }
+        }
+
+        /**
+         * Random integral settings with min_limit <= max_limit
+         * @param settings [out]: PID::IntegralSettings settings
+         */
+        void integralSettings(PID::IntegralSettings &settings) {
+            settings.setGain(uniform(-10.0f, 10.0f));
+            settings.setHasLimits((nextBits() & 3) != 0);
+            float a = uniform(-100.0f, 100.0f);
+            float b = (nextBits() % 8) == 0 ? a : uniform(-100.0f, 100.0f);
+            settings.setMinLimit(a < b ? a : b);
+            settings.setMaxLimit(a < b ? b : a);
+            settings.setMaxTimeStep(uniform(0.01f, 1.0f));
+        }
+
+        /**
+         * Random derivative settings
+         * @param settings [out]: PID::DerivativeSettings settings
+         */
+        void derivativeSettings(PID::DerivativeSettings &settings) {
+            settings.setGain(uniform(-10.0f, 10.0f));
+            settings.setMinTimeStep((nextBits() & 1) ? 0.0000001f : uniform(1.0e-6f, 1.0e-3f));
+            settings.setMaxTimeStep(uniform(0.01f, 1.0f));
+        }
+
+        /**
+         * Random output conditioner settings; every stage and anti-windup mode is drawn
+         * @param settings [out]: PID::OutputConditionerSettings settings
+         */
+        void conditionerSettings(PID::OutputConditionerSettings &settings) {
+            settings.setHasLimits((nextBits() & 3) != 0);
+            float a = uniform(-100.0f, 100.0f);
+            float b = uniform(-100.0f, 100.0f);
+            settings.setMinLimit(a < b ? a : b);
+            settings.setMaxLimit(a < b ? b : a);
+            settings.setHasRateLimit((nextBits() & 1) != 0);
+            settings.setMaxRate(uniform(0.0f, 1000.0f));
+            settings.setDeadband((nextBits() & 1) ? 0.0f : uniform(0.0f, 10.0f));
+            settings.setAntiWindup((uint8_t)(nextBits() % 3));
+            settings.setTrackingGain(uniform(0.0f, 10.0f));
+        }
+
+        /**
+         * Random sliding mode settings; a quarter have a zero boundary layer, the pure switch
+         * @param settings [out]: Nonlinear::SlidingModeSettings settings
+         */
+        void slidingModeSettings(Nonlinear::SlidingModeSettings &settings) {
+            settings.setGain(uniform(-10.0f, 10.0f));
+            settings.setSlope(uniform(0.0f, 10.0f));
+            settings.setBoundaryLayer((nextBits() & 3) == 0 ? 0.0f : uniform(0.0f, 10.0f));
+            settings.setMinTimeStep((nextBits() & 1) ? 0.0000001f : uniform(1.0e-6f, 1.0e-3f));
+        }
+
+        /**
+         * Random bang-bang settings; a quarter have no hysteresis
+         * @param settings [out]: Nonlinear::BangBangSettings settings
+         */
+        void bangBangSettings(Nonlinear::BangBangSettings &settings) {
+            settings.setGain(uniform(-10.0f, 10.0f));
+            settings.setOffOutput(uniform(-10.0f, 10.0f));
+            settings.setHysteresis((nextBits() & 3) == 0 ? 0.0f : uniform(0.0f, 10.0f));
+        }
+
+        /**
+         * Random loop metrics settings
+         * @param settings [out]: Monitor::LoopMetricsSettings settings
+         */
+        void loopMetricsSettings(Monitor::LoopMetricsSettings &settings) {
+            settings.setErrorTolerance(uniform(0.1f, 10.0f));
+            settings.setHysteresis(uniform(0.0f, 1.0f));
+            settings.setIaeLimit(uniform(0.0f, 10.0f));
+            settings.setSupervisionTime(uniform(0.1f, 100.0f));
+            settings.setDetectionLimit(uniform(1.0f, 10.0f));
+        }
+
+    private:
+        uint32_t state_;
+};
+
+}  // namespace Verify
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_VERIFY_RANDOM_INPUT_H
@@ -0,0 +1,177 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Validation checks of the snapshot format
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#include "snapshotChecks.h"
+#include <string.h>
+#include <persist/config.h>
+#include <persist/snapshot.h>
+#include <pid/integralBank.h>
+
+namespace ControlAlgorithms {
+
+namespace Verify {
+
+namespace {
+
+const size_t LANES = SnapshotChecks::LANES;
+
+// Room for an integral image of LANES loops; checked against Snapshot::imageSize below
+const size_t IMAGE_WORDS = 64;
+
+// The damaged image must not open
+void checkRejected(CheckReport &report, const void *image, size_t size, const char *check) {
+    Persist::SnapshotView view;
+    report.record(!view.open(image, size) && !view.isOpen(), check, 0);
+}
+
+// The damaged config must not open, even without the checksum
+void checkConfigRejected(CheckReport &report, const void *image, size_t size, const char *check) {
+    Persist::ConfigView view;
+    report.record(!view.open(image, size, false), check, 0);
+}
+
+}  // namespace
+
+void SnapshotChecks::checkValidation(const PID::IntegralSettings &settings, const float *error, const float *delta_t,
+                                     size_t steps, CheckReport &report) {
+    PID::IntegralBank<LANES> bank;
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        bank.setSettings(lane, settings);
+    }
+    float lane_error[LANES];
+    float lane_delta_t[LANES];
+    for(size_t step = 0; step < steps; ++step) {
+        for(size_t lane = 0; lane < LANES; ++lane) {
+            lane_error[lane] = error[step];
+            lane_delta_t[lane] = delta_t[step];
+        }
+        bank.update(lane_error, lane_delta_t, LANES);
+    }
+
+    uint32_t image[IMAGE_WORDS];
+    uint32_t damaged[IMAGE_WORDS];
+    size_t size = Persist::Snapshot::write(bank, LANES, image, sizeof(image));
+    if(!report.record(size > 0 && size <= sizeof(image), "snapshot write", 0)) {
+        return;
+    }
+
+    // Round trip
+    Persist::SnapshotView view;
+    report.record(view.open(image, size), "snapshot open", 0);
+    PID::IntegralBank<LANES> restored;
+    report.record(view.isOpen() && Persist::Snapshot::restore(view, restored), "snapshot restore", 0);
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        report.record(restored.getIntegratedError(lane) == bank.getIntegratedError(lane) &&
+                      restored.getControl(lane) == bank.getControl(lane), "snapshot round trip", lane);
+    }
+
+    // Truncated
+    checkRejected(report, image, size - 1, "snapshot truncated");
+    checkRejected(report, image, sizeof(Persist::SnapshotHeader) - 1, "snapshot header truncated");
+
+    // Unknown kind with a self consistent empty layout: no sections, image size 0
+    Persist::SnapshotHeader header;
+    memcpy(&header, image, sizeof(header));
+    header.kind = 99;
+    header.section_count = 0;
+    header.image_size = 0;
+    memcpy(damaged, &header, sizeof(header));
+    checkRejected(report, damaged, sizeof(header), "snapshot unknown kind");
+
+    // Image size smaller than the header
+    memcpy(&header, image, sizeof(header));
+    header.image_size = sizeof(header) - 4;
+    memcpy(damaged, image, size);
+    memcpy(damaged, &header, sizeof(header));
+    checkRejected(report, damaged, size, "snapshot image size below header");
+
+    // A count whose image size wraps a 32 bit size_t sizes to nothing, so the header cannot match it
+    report.record(Persist::Snapshot::imageSize(Persist::SNAPSHOT_INTEGRAL, 0x40000000u) == 0, "snapshot size bound", 0);
+    memcpy(&header, image, sizeof(header));
+    header.count = 0x40000000u;
+    memcpy(damaged, image, size);
+    memcpy(damaged, &header, sizeof(header));
+    checkRejected(report, damaged, size, "snapshot count wrapping size");
+
+    // Wrong magic
+    memcpy(damaged, image, size);
+    damaged[0] ^= 1;
+    checkRejected(report, damaged, size, "snapshot magic");
+
+    // Corrupted payload
+    memcpy(damaged, image, size);
+    damaged[size / sizeof(uint32_t) - 1] ^= 0x00010000;
+    checkRejected(report, damaged, size, "snapshot checksum");
+}
+
+void SnapshotChecks::checkConfigValidation(CheckReport &report) {
+    uint32_t image[IMAGE_WORDS];
+    Persist::ConfigWriter writer;
+    bool written = writer.begin(image, sizeof(image)) && writer.addBlock(Persist::SNAPSHOT_PROPORTIONAL, LANES);
+    if(!report.record(written, "config write", 0)) {
+        return;
+    }
+    float *gain = static_cast<float *>(writer.getSection(Persist::CONFIG_PROPORTIONAL_GAIN));
+    for(size_t lane = 0; lane < LANES; ++lane) {
+        gain[lane] = (float)lane;
+    }
+    size_t size = writer.finish();
+    Persist::ConfigView view;
+    report.record(view.open(image, size) && view.getBlockCount() == 1, "config open", 0);
+
+    // The first block follows the header, both aligned to 8 bytes
+    const size_t block_offset = (sizeof(Persist::ConfigHeader) + 7) & ~(size_t)7;
+    Persist::ConfigHeader header;
+    Persist::ConfigBlockHeader block;
+    uint32_t damaged[IMAGE_WORDS];
+
+    // A count larger than the image
+    memcpy(damaged, image, size);
+    memcpy(&block, reinterpret_cast<uint8_t *>(damaged) + block_offset, sizeof(block));
+    block.count = (uint32_t)(size / sizeof(float));
+    memcpy(reinterpret_cast<uint8_t *>(damaged) + block_offset, &block, sizeof(block));
+    checkConfigRejected(report, damaged, size, "config count beyond image");
+
+    // 0x40000000 floats is 2^32 bytes, so with a 32 bit size_t the block sizes to its header alone. The block and
+    // image sizes are made to agree with that wrapped size.
+    memcpy(damaged, image, size);
+    memcpy(&block, reinterpret_cast<uint8_t *>(damaged) + block_offset, sizeof(block));
+    block.count = 0x40000000u;
+    block.block_size = (uint32_t)((sizeof(Persist::ConfigBlockHeader) + 7) & ~(size_t)7);
+    memcpy(reinterpret_cast<uint8_t *>(damaged) + block_offset, &block, sizeof(block));
+    memcpy(&header, damaged, sizeof(header));
+    header.image_size = (uint32_t)(block_offset + block.block_size);
+    memcpy(damaged, &header, sizeof(header));
+    checkConfigRejected(report, damaged, header.image_size, "config count wrapping size");
+    report.record(Persist::Config::blockSize(Persist::SNAPSHOT_INTEGRAL, 0x40000000u) == 0, "config block size bound", 0);
+}
+
+}  // namespace Verify
+
+}  // namespace ControlAlgorithms
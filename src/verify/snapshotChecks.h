@@ -0,0 +1,74 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Validation checks of the snapshot format. A bank is run, written and read back, and damaged copies of the image
+ * (truncated, unknown kind, image size below the header, oversized count, wrong magic, corrupted payload) must all
+ * be rejected by SnapshotView::open without reading outside the image. The config format, which shares the
+ * snapshot kinds and checksum, is checked the same way through ConfigView::open.
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_VERIFY_SNAPSHOT_CHECKS_H
+#define CONTROLALGORITHMS_VERIFY_SNAPSHOT_CHECKS_H
+
+#include <stddef.h>
+#include <pid/integralSettings.h>
+#include <verify/checkReport.h>
+
+namespace ControlAlgorithms {
+namespace Verify {
+
+class SnapshotChecks {
+    public:
+        // Loops in the bank under test
+        static const size_t LANES = 5;
+
+        /**
+         * Check the round trip and the rejection of damaged images
+         * @param settings [in]: PID::IntegralSettings settings of every loop
+         * @param error [in]: float[steps] error sequence run before the snapshot
+         * @param delta_t [in]: float[steps] time step sequence
+         * @param steps [in]: size_t sequence length
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkValidation(const PID::IntegralSettings &settings, const float *error, const float *delta_t,
+                                    size_t steps, CheckReport &report);
+
+        /**
+         * Check that ConfigView::open accepts a written config and rejects blocks whose count the image cannot
+         * hold, including counts whose size would wrap a 32 bit size_t
+         * @param report [in/out]: CheckReport tally
+         */
+        static void checkConfigValidation(CheckReport &report);
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        SnapshotChecks() {};
+};
+
+}  // namespace Verify
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_VERIFY_SNAPSHOT_CHECKS_H
@@ -0,0 +1,84 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2022 Joel Dunham
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ * Distance between floats in units in the last place, for comparing implementations that may round differently
+ *
+ * @author Joel Dunham <joel.ph.dunham@gmail.com>
+ * @date 2026/10/19
+ */
+
+#ifndef CONTROLALGORITHMS_VERIFY_ULP_H
+#define CONTROLALGORITHMS_VERIFY_ULP_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ControlAlgorithms {
+namespace Verify {
+
+class Ulp {
+    public:
+        /**
+         * Number of representable floats between two values. Zeros of either sign are equal and two NaNs are equal;
+         * a NaN against a number is as far apart as possible.
+         * @param a [in]: float first value
+         * @param b [in]: float second value
+         * @return uint32_t distance in ULP
+         */
+        static uint32_t distance(float a, float b) {
+            bool a_nan = a != a;
+            bool b_nan = b != b;
+            if(a_nan || b_nan) {
+                return a_nan && b_nan ? 0 : UINT32_MAX;
+            }
+            int64_t ordered_a = ordered(a);
+            int64_t ordered_b = ordered(b);
+            int64_t difference = ordered_a > ordered_b ? ordered_a - ordered_b : ordered_b - ordered_a;
+            return difference > (int64_t)UINT32_MAX ? UINT32_MAX : (uint32_t)difference;
+        }
+
+        /**
+         * Whether two values are within a tolerance
+         * @param a [in]: float first value
+         * @param b [in]: float second value
+         * @param tolerance [in]: uint32_t allowed distance in ULP
+         * @return bool true if distance(a, b) <= tolerance
+         */
+        static bool within(float a, float b, uint32_t tolerance) { return distance(a, b) <= tolerance; }
+
+    private:
+        // Private constructor to ensure only the static functions are used.
+        Ulp() {};
+
+        // Map the float bit patterns onto a line where adjacent floats differ by one and both zeros meet
+        static int64_t ordered(float value) {
+            int32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return bits < 0 ? -(int64_t)(bits & 0x7FFFFFFF) : (int64_t)bits;
+        }
+};
+
+}  // namespace Verify
+}  // namespace ControlAlgorithms
+
+#endif  // CONTROLALGORITHMS_VERIFY_ULP_H